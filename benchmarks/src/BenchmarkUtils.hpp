@@ -0,0 +1,36 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string_view>
+
+namespace obe::Benchmarks
+{
+    /**
+     * \brief Runs a function once and measures how many operations per second
+     *        it performed
+     * \param operations Amount of operations done by one call of func
+     * \param func Function to measure
+     * \return The amount of operations per second
+     */
+    template <class Func> double measureRate(std::size_t operations, Func&& func)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const std::chrono::duration<double> elapsed
+            = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(operations) / elapsed.count();
+    }
+
+    /**
+     * \brief Prints a benchmark result line
+     * \param name Name of the measured case
+     * \param value Measured value
+     * \param unit Unit of the measured value
+     */
+    inline void report(std::string_view name, double value, std::string_view unit)
+    {
+        std::cout << "  " << name << " : " << value << " " << unit << std::endl;
+    }
+} // namespace obe::Benchmarks
@@ -0,0 +1,129 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Collision/BroadPhase.hpp>
+#include <Collision/PolygonalCollider.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t LevelWidth = 100;
+    constexpr std::size_t LevelHeight = 100;
+    constexpr double TileSpacing = 0.1;
+    constexpr double TileSize = 0.08;
+    constexpr std::size_t AgentsAmount = 1000;
+    constexpr double AgentSize = 0.04;
+
+    std::unique_ptr<Collision::PolygonalCollider> makeSquare(
+        const std::string& id, double x, double y, double size)
+    {
+        auto collider = std::make_unique<Collision::PolygonalCollider>(id);
+        collider->addPoint(Transform::UnitVector(x, y));
+        collider->addPoint(Transform::UnitVector(x + size, y));
+        collider->addPoint(Transform::UnitVector(x + size, y + size));
+        collider->addPoint(Transform::UnitVector(x, y + size));
+        return collider;
+    }
+
+    struct Level
+    {
+        std::vector<std::unique_ptr<Collision::PolygonalCollider>> tiles;
+        std::vector<std::unique_ptr<Collision::PolygonalCollider>> agents;
+        std::vector<Transform::UnitVector> velocities;
+        std::unique_ptr<Collision::BroadPhase> broadPhase;
+
+        explicit Level(Collision::BroadPhaseType type)
+            : broadPhase(Collision::makeBroadPhase(type))
+        {
+            Transform::UnitVector::Init(1000, 1000);
+            Transform::UnitVector::View = { 10, 10, 0, 0 };
+            std::mt19937 generator(42);
+            std::uniform_real_distribution<double> position(
+                0.0, LevelWidth * TileSpacing);
+            std::uniform_real_distribution<double> speed(-0.02, 0.02);
+
+            tiles.reserve(LevelWidth * LevelHeight);
+            for (std::size_t x = 0; x < LevelWidth; x++)
+            {
+                for (std::size_t y = 0; y < LevelHeight; y++)
+                {
+                    tiles.push_back(makeSquare("tile_" + std::to_string(tiles.size()),
+                        x * TileSpacing, y * TileSpacing, TileSize));
+                    tiles.back()->attachBroadPhase(broadPhase.get());
+                }
+            }
+            agents.reserve(AgentsAmount);
+            for (std::size_t i = 0; i < AgentsAmount; i++)
+            {
+                agents.push_back(makeSquare("agent_" + std::to_string(i),
+                    position(generator), position(generator), AgentSize));
+                agents.back()->attachBroadPhase(broadPhase.get());
+                velocities.emplace_back(speed(generator), speed(generator));
+            }
+        }
+
+        ~Level()
+        {
+            // Colliders have to unregister before the BroadPhase is destroyed
+            tiles.clear();
+            agents.clear();
+        }
+
+        std::size_t step()
+        {
+            std::size_t contacts = 0;
+            for (std::size_t i = 0; i < agents.size(); i++)
+            {
+                contacts += agents[i]->doesCollide(velocities[i]).colliders.size();
+                agents[i]->move(velocities[i]);
+            }
+            return contacts;
+        }
+
+        std::vector<std::size_t> collectContacts()
+        {
+            std::vector<std::size_t> contacts;
+            contacts.reserve(agents.size());
+            for (std::size_t i = 0; i < agents.size(); i++)
+            {
+                const auto collision = agents[i]->doesCollide(velocities[i]);
+                contacts.push_back(collision.colliders.size());
+            }
+            return contacts;
+        }
+    };
+}
+
+TEST_CASE("Moving 1000 agents through a level of 10000 colliders",
+    "[obe.Collision.BroadPhase][!benchmark]")
+{
+    // Only one Level can be alive at a time as all colliders share the same Pool
+    std::vector<std::size_t> bruteForceContacts;
+    {
+        Level level(Collision::BroadPhaseType::None);
+        bruteForceContacts = level.collectContacts();
+        const double rate
+            = Benchmarks::measureRate(AgentsAmount, [&level]() { level.step(); });
+        Benchmarks::report("Brute force (Pool)", rate, "queries/sec");
+    }
+
+    for (const auto& [name, type] :
+        { std::make_pair("AABBTree", Collision::BroadPhaseType::AABBTree),
+            std::make_pair("UniformGrid", Collision::BroadPhaseType::UniformGrid) })
+    {
+        Level level(type);
+        REQUIRE(level.collectContacts() == bruteForceContacts);
+
+        constexpr std::size_t Frames = 60;
+        const double rate = Benchmarks::measureRate(AgentsAmount * Frames, [&level]() {
+            for (std::size_t frame = 0; frame < Frames; frame++)
+                level.step();
+        });
+        Benchmarks::report(name, rate, "queries/sec");
+    }
+}
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Collision/PolygonalCollider.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t PolygonsAmount = 300;
+    constexpr double Pi = 3.14159265358979323846;
+
+    // Point-in-polygon implementation previously used by doesCollide
+    bool legacyDoesCollide(Collision::PolygonalCollider& first,
+        Collision::PolygonalCollider& second, const Transform::UnitVector& offset)
+    {
+        std::vector<Transform::UnitVector> pSet1;
+        pSet1.reserve(first.getPointsAmount());
+        std::vector<Transform::UnitVector> pSet2;
+        pSet2.reserve(second.getPointsAmount());
+
+        for (const auto& point : first.getAllPoints())
+            pSet1.push_back(*point);
+        for (const auto& point : second.getAllPoints())
+            pSet2.push_back(*point);
+        for (auto& applyOffset : pSet1)
+            applyOffset += offset;
+        const auto pointInPolygon = [](const std::vector<Transform::UnitVector>& poly,
+                                        Transform::UnitVector& pTest) -> bool {
+            int i, j, c = 0;
+            const int nPt = poly.size();
+            for (i = 0, j = nPt - 1; i < nPt; j = i++)
+            {
+                if (((poly[i].y > pTest.y) != (poly[j].y > pTest.y))
+                    && (pTest.x < (poly[j].x - poly[i].x) * (pTest.y - poly[i].y)
+                                / (poly[j].y - poly[i].y)
+                            + poly[i].x))
+                    c = !c;
+            }
+            return c;
+        };
+        for (Transform::UnitVector& pTest : pSet1)
+        {
+            if (pointInPolygon(pSet2, pTest))
+                return true;
+        }
+        for (auto& pTest : pSet2)
+        {
+            if (pointInPolygon(pSet1, pTest))
+                return true;
+        }
+        return false;
+    }
+
+    std::vector<std::unique_ptr<Collision::PolygonalCollider>> makeConvexPolygons(
+        std::mt19937& generator)
+    {
+        std::uniform_real_distribution<double> position(0.0, 2.0);
+        std::uniform_real_distribution<double> radius(0.05, 0.2);
+        std::uniform_real_distribution<double> angle(0.0, 2 * Pi);
+        std::uniform_int_distribution<int> pointsAmount(3, 10);
+
+        std::vector<std::unique_ptr<Collision::PolygonalCollider>> polygons;
+        for (std::size_t i = 0; i < PolygonsAmount; i++)
+        {
+            auto polygon = std::make_unique<Collision::PolygonalCollider>(
+                "polygon_" + std::to_string(i));
+            const double centerX = position(generator);
+            const double centerY = position(generator);
+            const double polygonRadius = radius(generator);
+            // Points sorted by angle on a circle always form a convex polygon
+            std::vector<double> angles(pointsAmount(generator));
+            for (double& pointAngle : angles)
+                pointAngle = angle(generator);
+            std::sort(angles.begin(), angles.end());
+            for (const double pointAngle : angles)
+            {
+                polygon->addPoint(
+                    Transform::UnitVector(centerX + std::cos(pointAngle) * polygonRadius,
+                        centerY + std::sin(pointAngle) * polygonRadius));
+            }
+            polygons.push_back(std::move(polygon));
+        }
+        return polygons;
+    }
+}
+
+TEST_CASE("Narrow-phase tests between random convex polygons",
+    "[obe.Collision.NarrowPhase][!benchmark]")
+{
+    Transform::UnitVector::Init(1000, 1000);
+    Transform::UnitVector::View = { 2, 2, 0, 0 };
+    std::mt19937 generator(42);
+    const auto polygons = makeConvexPolygons(generator);
+    const Transform::UnitVector offset(0.01, -0.01);
+    constexpr std::size_t Tests = PolygonsAmount * PolygonsAmount;
+
+    std::size_t legacyHits = 0;
+    std::size_t satHits = 0;
+    for (const auto& first : polygons)
+    {
+        for (const auto& second : polygons)
+        {
+            const bool legacy = legacyDoesCollide(*first, *second, offset);
+            const bool sat = first->doesCollide(*second, offset);
+            legacyHits += legacy;
+            satHits += sat;
+            // Point-in-polygon can miss edge crossings but never invents overlaps
+            if (legacy)
+                REQUIRE(sat);
+        }
+    }
+    Benchmarks::report("Overlaps found by point-in-polygon", legacyHits, "pairs");
+    Benchmarks::report("Overlaps found by SAT", satHits, "pairs");
+
+    std::size_t sink = 0;
+    const double legacyRate = Benchmarks::measureRate(Tests, [&]() {
+        for (const auto& first : polygons)
+        {
+            for (const auto& second : polygons)
+                sink += legacyDoesCollide(*first, *second, offset);
+        }
+    });
+    Benchmarks::report("Point-in-polygon (legacy)", legacyRate, "tests/sec");
+
+    const double satRate = Benchmarks::measureRate(Tests, [&]() {
+        for (const auto& first : polygons)
+        {
+            for (const auto& second : polygons)
+                sink += first->doesCollide(*second, offset);
+        }
+    });
+    Benchmarks::report("SAT", satRate, "tests/sec");
+
+    Collision::Penetration penetration;
+    const double penetrationRate = Benchmarks::measureRate(Tests, [&]() {
+        for (const auto& first : polygons)
+        {
+            for (const auto& second : polygons)
+                penetration = first->getPenetration(*second, offset);
+        }
+    });
+    Benchmarks::report("SAT with penetration", penetrationRate, "tests/sec");
+    REQUIRE(sink == legacyHits + satHits);
+}
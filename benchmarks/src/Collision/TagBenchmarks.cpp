@@ -0,0 +1,103 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Collision/PolygonalCollider.hpp>
+#include <Utils/VectorUtils.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t CollidersAmount = 500;
+    constexpr std::size_t TagsAmount = 24;
+
+    // String-based filter previously used by PolygonalCollider::checkTags
+    bool legacyCheckTags(const Collision::PolygonalCollider& self,
+        const Collision::PolygonalCollider& other)
+    {
+        const auto doesHaveAnyTag = [&self](Collision::ColliderTagType tagType,
+                                        const std::vector<std::string>& tags) {
+            for (const std::string& tag : tags)
+            {
+                if (Utils::Vector::contains(tag, self.getAllTags(tagType)))
+                    return true;
+            }
+            return false;
+        };
+        if (doesHaveAnyTag(Collision::ColliderTagType::Rejected,
+                other.getAllTags(Collision::ColliderTagType::Tag)))
+            return false;
+        if (!self.getAllTags(Collision::ColliderTagType::Accepted).empty()
+            && !doesHaveAnyTag(Collision::ColliderTagType::Accepted,
+                other.getAllTags(Collision::ColliderTagType::Tag)))
+            return false;
+        return true;
+    }
+}
+
+TEST_CASE("Filtering collider pairs using tags", "[obe.Collision.Tags][!benchmark]")
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> tag(0, TagsAmount - 1);
+    std::uniform_int_distribution<int> amount(0, 3);
+    const auto randomTag = [&]() { return "tag_" + std::to_string(tag(generator)); };
+
+    std::vector<std::unique_ptr<Collision::PolygonalCollider>> colliders;
+    for (std::size_t i = 0; i < CollidersAmount; i++)
+    {
+        auto collider = std::make_unique<Collision::PolygonalCollider>(
+            "collider_" + std::to_string(i));
+        for (const auto tagType : { Collision::ColliderTagType::Tag,
+                 Collision::ColliderTagType::Accepted,
+                 Collision::ColliderTagType::Rejected })
+        {
+            const int tags = (tagType == Collision::ColliderTagType::Tag)
+                ? amount(generator) + 1
+                : amount(generator);
+            for (int t = 0; t < tags; t++)
+            {
+                const std::string name = randomTag();
+                if (!collider->doesHaveTag(tagType, name))
+                    collider->addTag(tagType, name);
+            }
+        }
+        colliders.push_back(std::move(collider));
+    }
+
+    std::size_t legacyAccepted = 0;
+    std::size_t maskAccepted = 0;
+    for (const auto& first : colliders)
+    {
+        for (const auto& second : colliders)
+        {
+            const bool legacy = legacyCheckTags(*first, *second);
+            REQUIRE(legacy == first->checkTags(*second));
+            legacyAccepted += legacy;
+        }
+    }
+
+    constexpr std::size_t Pairs = CollidersAmount * CollidersAmount;
+    const double legacyRate = Benchmarks::measureRate(Pairs, [&]() {
+        legacyAccepted = 0;
+        for (const auto& first : colliders)
+        {
+            for (const auto& second : colliders)
+                legacyAccepted += legacyCheckTags(*first, *second);
+        }
+    });
+    Benchmarks::report("String tags (legacy)", 1e9 / legacyRate, "ns/pair");
+
+    const double maskRate = Benchmarks::measureRate(Pairs, [&]() {
+        for (const auto& first : colliders)
+        {
+            for (const auto& second : colliders)
+                maskAccepted += first->checkTags(*second);
+        }
+    });
+    Benchmarks::report("Interned tag masks", 1e9 / maskRate, "ns/pair");
+    REQUIRE(legacyAccepted == maskAccepted);
+}
@@ -0,0 +1,55 @@
+#include <catch/catch.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Debug/Profiler.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t FramesAmount = 100;
+    // Roughly the amount of zones of a frame with a few hundred GameObjects
+    constexpr std::size_t ZonesPerFrame = 1000;
+
+    // Records FramesAmount frames of ZonesPerFrame zones nested two by two
+    double measureZones(Debug::Profiler& profiler)
+    {
+        const Debug::ProfilerZoneId outer = profiler.getZoneId("Outer");
+        const Debug::ProfilerZoneId inner = profiler.getZoneId("Inner");
+        return Benchmarks::measureRate(FramesAmount * ZonesPerFrame, [&]() {
+            for (std::size_t frame = 0; frame < FramesAmount; frame++)
+            {
+                Debug::ProfilerFrameGuard frameGuard(profiler);
+                for (std::size_t i = 0; i < ZonesPerFrame / 2; i++)
+                {
+                    Debug::ProfilerZoneGuard outerGuard(profiler, outer);
+                    Debug::ProfilerZoneGuard innerGuard(profiler, inner);
+                }
+            }
+        });
+    }
+}
+
+TEST_CASE("Cost of a profiled zone", "[obe.Debug.Profiler][!benchmark]")
+{
+    Debug::Profiler profiler(FramesAmount);
+    const double disabledRate = measureZones(profiler);
+    REQUIRE(profiler.getFrameCount() == 0);
+
+    profiler.setEnabled(true);
+    // First pass grows the zone buffers of every frame of the ring
+    measureZones(profiler);
+    const double enabledRate = measureZones(profiler);
+    REQUIRE(profiler.getFrameCount() == FramesAmount);
+    REQUIRE(profiler.getFrame().zones.size() == ZonesPerFrame);
+    const Debug::ProfilerFrame& frame = profiler.getFrame();
+    REQUIRE(frame.zones[1].depth == 1);
+    REQUIRE(frame.zones.front().start >= frame.start);
+    REQUIRE(frame.zones.back().end <= frame.end);
+
+    const std::string trace = profiler.toChromeTrace();
+
+    Benchmarks::report("Disabled zone", 1e9 / disabledRate, "ns/zone");
+    Benchmarks::report("Enabled zone", 1e9 / enabledRate, "ns/zone");
+    Benchmarks::report("Chrome trace", trace.size() / 1e6, "MB");
+}
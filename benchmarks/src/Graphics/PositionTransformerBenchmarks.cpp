@@ -0,0 +1,71 @@
+#include <random>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Graphics/PositionTransformers.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t VerticesAmount = 200000;
+    constexpr int LayersAmount = 5;
+    constexpr std::size_t PassesAmount = 50;
+}
+
+TEST_CASE(
+    "Transforming Sprite vertices", "[obe.Graphics.PositionTransformer][!benchmark]")
+{
+    Graphics::InitPositionTransformer();
+    // Same functions as the built-in ones but registered under other names so
+    // they go through std::function
+    Graphics::Transformers["CustomParallax"] = Graphics::Parallax;
+    Graphics::Transformers["CustomCamera"] = Graphics::Camera;
+    Transform::UnitVector::Init(1920, 1080);
+    Transform::UnitVector::View = { 3.55, 2, 0, 0 };
+
+    std::mt19937 generator(5);
+    std::uniform_real_distribution<double> coordinate(-10, 10);
+    std::vector<double> x(VerticesAmount);
+    std::vector<double> y(VerticesAmount);
+    for (std::size_t i = 0; i < VerticesAmount; i++)
+    {
+        x[i] = coordinate(generator);
+        y[i] = coordinate(generator);
+    }
+    std::vector<float> transformedX(VerticesAmount);
+    std::vector<float> transformedY(VerticesAmount);
+    const Transform::UnitVector camera(-300, 120, Transform::Units::ScenePixels);
+
+    // Vertices are split in one batch per layer, like the Sprites of a Scene
+    const std::size_t layerSize = VerticesAmount / LayersAmount;
+    const auto transformAll = [&](const Graphics::PositionTransformer& transformer) {
+        for (std::size_t pass = 0; pass < PassesAmount; pass++)
+        {
+            for (int layer = 0; layer < LayersAmount; layer++)
+            {
+                const std::size_t begin = layer * layerSize;
+                transformer.transform(&x[begin], &y[begin], &transformedX[begin],
+                    &transformedY[begin], layerSize, camera, layer + 1);
+            }
+        }
+    };
+    const Graphics::PositionTransformer custom("CustomParallax", "CustomCamera");
+    const double customRate = Benchmarks::measureRate(
+        VerticesAmount * PassesAmount, [&]() { transformAll(custom); });
+    const float customLast = transformedX.back();
+    const Graphics::PositionTransformer kernels("Parallax", "Camera");
+    const double kernelRate = Benchmarks::measureRate(
+        VerticesAmount * PassesAmount, [&]() { transformAll(kernels); });
+    REQUIRE(transformedX.back() == Approx(customLast));
+
+    Benchmarks::report("Vertices", VerticesAmount, "vertices");
+    Benchmarks::report("std::function", 1e3 * VerticesAmount / customRate, "ms/pass");
+    Benchmarks::report("Kernels", 1e3 * VerticesAmount / kernelRate, "ms/pass");
+    Benchmarks::report("Speedup", kernelRate / customRate, "x");
+
+    Graphics::Transformers.erase("CustomParallax");
+    Graphics::Transformers.erase("CustomCamera");
+}
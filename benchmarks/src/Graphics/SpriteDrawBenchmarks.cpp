@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <catch/catch.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteBatch.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t SpritesAmount = 50000;
+    constexpr std::size_t FramesAmount = 100;
+    constexpr unsigned int TargetWidth = 1920;
+    constexpr unsigned int TargetHeight = 1080;
+}
+
+TEST_CASE("Drawing static Sprites", "[obe.Graphics.Sprite][!benchmark]")
+{
+    Graphics::InitPositionTransformer();
+    Transform::UnitVector::Init(TargetWidth, TargetHeight);
+    Transform::UnitVector::View = { 2 * TargetWidth / double(TargetHeight), 2, 0, 0 };
+
+    sf::RenderTexture renderTexture;
+    REQUIRE(renderTexture.create(TargetWidth, TargetHeight));
+    Graphics::RenderTarget target(renderTexture);
+    sf::Image image;
+    image.create(32, 32, sf::Color::White);
+    Graphics::Texture texture;
+    REQUIRE(texture.loadFromImage(image));
+
+    // Rotated Sprites spread over a few screens, on every layer and
+    // PositionTransformer the Scene handles
+    std::mt19937 generator(21);
+    std::uniform_real_distribution<double> position(-4, 4);
+    std::uniform_real_distribution<double> size(0.02, 0.2);
+    std::uniform_real_distribution<double> angle(0, 360);
+    std::uniform_int_distribution<int> layer(1, 5);
+    const std::vector<std::string> transformers = { "Camera", "Parallax", "Position" };
+    std::uniform_int_distribution<std::size_t> transformer(0, transformers.size() - 1);
+    std::vector<std::unique_ptr<Graphics::Sprite>> sprites;
+    sprites.reserve(SpritesAmount);
+    for (std::size_t i = 0; i < SpritesAmount; i++)
+    {
+        auto sprite = std::make_unique<Graphics::Sprite>("sprite" + std::to_string(i));
+        sprite->setTexture(texture);
+        sprite->setPosition(
+            Transform::UnitVector(position(generator), position(generator)));
+        sprite->setSize(Transform::UnitVector(size(generator), size(generator)));
+        sprite->setRotation(angle(generator));
+        sprite->setLayer(layer(generator));
+        sprite->setPositionTransformer(Graphics::PositionTransformer(
+            transformers[transformer(generator)], transformers[transformer(generator)]));
+        sprites.push_back(std::move(sprite));
+    }
+
+    // Drawn in layer order like the Scene does
+    std::vector<Graphics::Sprite*> drawOrder;
+    for (const auto& sprite : sprites)
+        drawOrder.push_back(sprite.get());
+    std::stable_sort(drawOrder.begin(), drawOrder.end(),
+        [](Graphics::Sprite* first, Graphics::Sprite* second) {
+            return first->getLayer() < second->getLayer();
+        });
+
+    Graphics::SpriteBatch batch;
+    const Transform::UnitVector camera(-200, -100, Transform::Units::ScenePixels);
+    const auto buildBatch = [&]() {
+        batch.clear();
+        batch.addSprites(drawOrder, camera);
+    };
+    const double verticesRate = Benchmarks::measureRate(FramesAmount, [&]() {
+        for (std::size_t frame = 0; frame < FramesAmount; frame++)
+            buildBatch();
+    });
+    const double frameRate = Benchmarks::measureRate(FramesAmount, [&]() {
+        for (std::size_t frame = 0; frame < FramesAmount; frame++)
+        {
+            renderTexture.clear();
+            buildBatch();
+            batch.draw(target);
+        }
+    });
+    renderTexture.display();
+    REQUIRE(batch.getSpriteCount() == SpritesAmount);
+
+    Benchmarks::report("Sprites", SpritesAmount, "sprites");
+    Benchmarks::report("Sprite vertices", 1e3 / verticesRate, "ms/frame");
+    Benchmarks::report("Sprite drawing", 1e3 / frameRate, "ms/frame");
+    Benchmarks::report("Per Sprite", 1e9 / (frameRate * SpritesAmount), "ns/sprite");
+}
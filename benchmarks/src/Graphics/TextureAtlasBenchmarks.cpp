@@ -0,0 +1,100 @@
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+#include <catch/catch.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Graphics/TextureAtlas.hpp>
+#include <Utils/FileUtils.hpp>
+#include <Utils/StringUtils.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr int PageSize = 2048;
+    constexpr int Padding = 1;
+    constexpr std::size_t GeneratedImagesAmount = 5000;
+
+    // Sizes of the images in OBE_ATLAS_BENCHMARK_DIR, random sprite-like
+    // sizes when the variable is not set
+    std::vector<sf::Vector2i> getImageSizes()
+    {
+        std::vector<sf::Vector2i> sizes;
+        if (const char* directory = std::getenv("OBE_ATLAS_BENCHMARK_DIR"))
+        {
+            for (const std::string& filename : Utils::File::getFileList(directory))
+            {
+                if (!Utils::String::endsWith(filename, ".png"))
+                    continue;
+                sf::Image image;
+                if (image.loadFromFile(std::string(directory) + "/" + filename))
+                    sizes.emplace_back(image.getSize().x, image.getSize().y);
+            }
+            return sizes;
+        }
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> tile(1, 8);
+        std::uniform_int_distribution<int> anySize(8, 256);
+        for (std::size_t i = 0; i < GeneratedImagesAmount; i++)
+        {
+            // Mostly tiles and animation frames with a few odd sizes
+            if (i % 4)
+                sizes.emplace_back(tile(generator) * 16, tile(generator) * 16);
+            else
+                sizes.emplace_back(anySize(generator), anySize(generator));
+        }
+        return sizes;
+    }
+}
+
+TEST_CASE(
+    "Packing images in texture atlas pages", "[obe.Graphics.TextureAtlas][!benchmark]")
+{
+    const std::vector<sf::Vector2i> sizes = getImageSizes();
+    REQUIRE(!sizes.empty());
+
+    std::size_t imagesArea = 0;
+    for (const sf::Vector2i& size : sizes)
+    {
+        if (size.x + Padding <= PageSize && size.y + Padding <= PageSize)
+            imagesArea += static_cast<std::size_t>(size.x) * size.y;
+    }
+
+    std::vector<Graphics::SkylinePacker> pages;
+    std::size_t skipped = 0;
+    const double rate = Benchmarks::measureRate(sizes.size(), [&]() {
+        for (const sf::Vector2i& size : sizes)
+        {
+            const int width = size.x + Padding;
+            const int height = size.y + Padding;
+            if (width > PageSize || height > PageSize)
+            {
+                skipped++;
+                continue;
+            }
+            bool packed = false;
+            for (Graphics::SkylinePacker& page : pages)
+            {
+                if (page.insert(width, height))
+                {
+                    packed = true;
+                    break;
+                }
+            }
+            if (!packed)
+            {
+                pages.emplace_back(PageSize, PageSize);
+                REQUIRE(pages.back().insert(width, height));
+            }
+        }
+    });
+
+    const double pagesArea = static_cast<double>(pages.size()) * PageSize * PageSize;
+    Benchmarks::report("Images", sizes.size() - skipped, "images");
+    Benchmarks::report("Pages", pages.size(), "pages");
+    Benchmarks::report("Pack ratio", imagesArea / pagesArea * 100, "%");
+    Benchmarks::report("Packing time", 1e6 / rate, "us/image");
+}
@@ -0,0 +1,82 @@
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Jobs/TaskGraph.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t TasksAmount = 1000000;
+    constexpr std::size_t ElementsAmount = 4000000;
+    constexpr std::size_t GraphLayers = 100;
+    constexpr std::size_t TasksPerLayer = 100;
+
+    // A few hundred nanoseconds of work, about the cost of a small update
+    float work(float value)
+    {
+        for (int i = 0; i < 16; i++)
+            value = std::sqrt(value * value + 1.f);
+        return value;
+    }
+}
+
+TEST_CASE("Job system throughput", "[obe.Jobs][!benchmark]")
+{
+    Jobs::ThreadPool pool;
+
+    std::atomic<std::size_t> done = 0;
+    const double submitRate = Benchmarks::measureRate(TasksAmount, [&]() {
+        for (std::size_t i = 0; i < TasksAmount; i++)
+            pool.submit([&done]() { done++; });
+        while (done != TasksAmount)
+        {
+            if (!pool.runPendingTask())
+                std::this_thread::yield();
+        }
+    });
+
+    std::vector<float> elements(ElementsAmount, 1.f);
+    const double serialRate = Benchmarks::measureRate(ElementsAmount, [&]() {
+        for (float& element : elements)
+            element = work(element);
+    });
+    const double parallelRate = Benchmarks::measureRate(ElementsAmount, [&]() {
+        pool.parallelForEach(
+            elements, 1024, [](float& element) { element = work(element); });
+    });
+
+    // Each task of a layer waits for two tasks of the previous layer
+    Jobs::TaskGraph graph;
+    std::vector<float> results(GraphLayers * TasksPerLayer, 1.f);
+    for (std::size_t layer = 0; layer < GraphLayers; layer++)
+    {
+        for (std::size_t i = 0; i < TasksPerLayer; i++)
+        {
+            const std::size_t index = layer * TasksPerLayer + i;
+            const Jobs::TaskGraph::TaskId task = graph.add([index, &results]() {
+                for (int j = 0; j < 64; j++)
+                    results[index] = work(results[index]);
+            });
+            if (layer > 0)
+            {
+                const std::size_t previous = (layer - 1) * TasksPerLayer;
+                graph.precede(previous + i, task);
+                graph.precede(previous + (i + 1) % TasksPerLayer, task);
+            }
+        }
+    }
+    const double graphRate
+        = Benchmarks::measureRate(graph.size(), [&]() { graph.run(pool); });
+
+    Benchmarks::report("Threads", pool.getWorkerCount() + 1, "threads");
+    Benchmarks::report("Submitted tasks", submitRate / 1e6, "M tasks/s");
+    Benchmarks::report("Serial loop", serialRate / 1e6, "M elements/s");
+    Benchmarks::report("parallelForEach", parallelRate / 1e6, "M elements/s");
+    Benchmarks::report("TaskGraph", graphRate / 1e3, "k tasks/s");
+}
@@ -0,0 +1,130 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <SFML/Graphics/Image.hpp>
+#include <catch/catch.hpp>
+#include <sol/sol.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Debug/Logger.hpp>
+#include <Engine/ResourceManager.hpp>
+#include <Jobs/ThreadPool.hpp>
+#include <Scene/Scene.hpp>
+#include <System/MountablePath.hpp>
+#include <Time/TimeUtils.hpp>
+#include <Triggers/TriggerManager.hpp>
+#include <Utils/FileUtils.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t ObjectsAmount = 20000;
+    constexpr std::size_t FramesAmount = 200;
+    constexpr std::size_t AnimationFrames = 4;
+    constexpr const char* BenchmarkDirectory = "obe_gameobject_benchmark";
+
+    // An object type with a Sprite and an Animator looping on a new texture
+    // every frame (its Sprite is resized to fit each texture)
+    constexpr const char* ObjectDefinition = R"(
+Animated:
+    Sprite:
+        rect: {x: 0.0, y: 0.0, width: 0.1, height: 0.1}
+    Animator:
+        path: "Sprites/Animated"
+        default: "Idle"
+)";
+    constexpr const char* AnimationDefinition = R"(
+Meta:
+    name: "Idle"
+    clock: 0.0
+    mode: Loop
+Images:
+    images: ["0.png", "1.png", "2.png", "3.png"]
+Groups:
+    main:
+        content: [0, 1, 2, 3]
+Animation:
+    code: [play_group {group: "main", repeat: 1}]
+)";
+
+    void writeFile(const std::string& path, const char* content)
+    {
+        std::ofstream file(path);
+        file << content;
+    }
+
+    void createObjectFiles()
+    {
+        const std::string base = BenchmarkDirectory;
+        for (const std::string& directory : { "", "/Data", "/Data/GameObjects",
+                 "/Data/GameObjects/Animated", "/Sprites", "/Sprites/Animated",
+                 "/Sprites/Animated/Idle" })
+        {
+            Utils::File::createDirectory(base + directory);
+        }
+        const std::string animation = base + "/Sprites/Animated/Idle/";
+        writeFile(
+            base + "/Data/GameObjects/Animated/Animated.obj.vili", ObjectDefinition);
+        writeFile(animation + "Idle.ani.vili", AnimationDefinition);
+        for (std::size_t i = 0; i < AnimationFrames; i++)
+        {
+            sf::Image image;
+            image.create(16 + 8 * i, 16, sf::Color(64 * i, 128, 255 - 64 * i));
+            image.saveToFile(animation + std::to_string(i) + ".png");
+        }
+    }
+
+    double measureFrames(Scene::Scene& scene)
+    {
+        return Benchmarks::measureRate(FramesAmount, [&scene]() {
+            for (std::size_t frame = 0; frame < FramesAmount; frame++)
+            {
+                Time::advanceFrame();
+                scene.update();
+            }
+        });
+    }
+}
+
+TEST_CASE("Updating animated GameObjects", "[obe.Scene.GameObjects][!benchmark]")
+{
+    if (!Debug::Log)
+        Debug::Log = std::make_shared<spdlog::logger>("Log");
+    createObjectFiles();
+    const System::MountablePath mount(
+        System::MountablePathType::Path, BenchmarkDirectory, 100);
+    System::MountablePath::Mount(mount);
+
+    sol::state lua;
+    lua["__TRIGGERS"].get_or_create<sol::table>();
+    Triggers::TriggerManager triggers(lua);
+    triggers.createNamespace("Event");
+    Engine::ResourceManager resources;
+    Scene::Scene scene(triggers, lua);
+    scene.attachResourceManager(resources);
+    for (std::size_t i = 0; i < ObjectsAmount; i++)
+        scene.createGameObject("Animated", "object" + std::to_string(i));
+    // First update initializes the GameObjects
+    scene.update();
+    REQUIRE(scene.getGameObjectAmount() == ObjectsAmount);
+
+    const double serialRate = measureFrames(scene);
+    Jobs::ThreadPool threadPool;
+    scene.attachThreadPool(&threadPool);
+    const double parallelRate = measureFrames(scene);
+    scene.attachThreadPool(nullptr);
+
+    Benchmarks::report("GameObjects", ObjectsAmount, "objects");
+    Benchmarks::report("Workers", threadPool.getWorkerCount() + 1, "threads");
+    Benchmarks::report("Serial update", 1e3 / serialRate, "ms/frame");
+    Benchmarks::report("Parallel update", 1e3 / parallelRate, "ms/frame");
+    Benchmarks::report("Speedup", parallelRate / serialRate, "x");
+
+    scene.clear();
+    scene.update();
+    Script::GameObjectDatabase::Clear();
+    System::MountablePath::Unmount(mount);
+    std::filesystem::remove_all(BenchmarkDirectory);
+}
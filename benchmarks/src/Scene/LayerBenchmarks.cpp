@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+#include <sol/sol.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Debug/Logger.hpp>
+#include <Scene/Scene.hpp>
+#include <Triggers/TriggerManager.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t SpritesAmount = 10000;
+    constexpr std::size_t ChangedSpritesPerFrame = SpritesAmount / 100;
+    constexpr std::size_t FramesAmount = 200;
+    constexpr int LayersAmount = 8;
+
+    bool isSorted(Scene::Scene& scene)
+    {
+        const std::vector<Graphics::Sprite*> sprites = scene.getAllSprites();
+        return std::is_sorted(sprites.begin(), sprites.end(),
+            [](const Graphics::Sprite* sprite1, const Graphics::Sprite* sprite2) {
+                if (sprite1->getLayer() == sprite2->getLayer())
+                    return sprite1->getZDepth() > sprite2->getZDepth();
+                return sprite1->getLayer() > sprite2->getLayer();
+            });
+    }
+
+    // Changes the layer of 1% of the Sprites then reorders them, once per frame
+    template <class Reorganize>
+    double measureFrames(
+        Scene::Scene& scene, std::mt19937& generator, Reorganize&& reorganize)
+    {
+        const std::vector<Graphics::Sprite*> sprites = scene.getAllSprites();
+        std::uniform_int_distribution<std::size_t> sprite(0, sprites.size() - 1);
+        std::uniform_int_distribution<int> layer(1, LayersAmount);
+        return Benchmarks::measureRate(FramesAmount, [&]() {
+            for (std::size_t frame = 0; frame < FramesAmount; frame++)
+            {
+                for (std::size_t i = 0; i < ChangedSpritesPerFrame; i++)
+                    sprites[sprite(generator)]->setLayer(layer(generator));
+                reorganize();
+            }
+        });
+    }
+}
+
+TEST_CASE("Reordering Sprites when 1% of them change layer every frame",
+    "[obe.Scene.Layers][!benchmark]")
+{
+    if (!Debug::Log)
+        Debug::Log = std::make_shared<spdlog::logger>("Log");
+    sol::state lua;
+    lua["__TRIGGERS"].get_or_create<sol::table>();
+    Triggers::TriggerManager triggers(lua);
+    triggers.createNamespace("Event");
+    Scene::Scene scene(triggers, lua);
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> layer(1, LayersAmount);
+    std::uniform_int_distribution<int> zdepth(0, 100);
+    const double spawnRate = Benchmarks::measureRate(SpritesAmount, [&]() {
+        for (std::size_t i = 0; i < SpritesAmount; i++)
+        {
+            Graphics::Sprite& sprite
+                = scene.createSprite("sprite" + std::to_string(i), false);
+            sprite.setLayer(layer(generator));
+            sprite.setZDepth(zdepth(generator));
+        }
+        scene.reorganizeChangedLayers();
+    });
+    REQUIRE(isSorted(scene));
+
+    // Cost of setLayer itself, included in the two measures below
+    const double changeRate = measureFrames(scene, generator, []() {});
+    scene.reorganizeLayers();
+    const double sortRate
+        = measureFrames(scene, generator, [&scene]() { scene.reorganizeLayers(); });
+    REQUIRE(isSorted(scene));
+    const double incrementalRate = measureFrames(
+        scene, generator, [&scene]() { scene.reorganizeChangedLayers(); });
+    REQUIRE(isSorted(scene));
+
+    Benchmarks::report("Sprites", SpritesAmount, "sprites");
+    Benchmarks::report("Spawning", 1e6 / spawnRate, "us/sprite");
+    Benchmarks::report("Layer changes only", 1e6 / changeRate, "us/frame");
+    Benchmarks::report("Full sort", 1e6 / sortRate, "us/frame");
+    Benchmarks::report("Incremental ordering", 1e6 / incrementalRate, "us/frame");
+}
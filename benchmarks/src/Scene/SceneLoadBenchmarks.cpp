@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <catch/catch.hpp>
+#include <sol/sol.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Config/CompiledFile.hpp>
+#include <Config/Templates/Scene.hpp>
+#include <Debug/Logger.hpp>
+#include <Engine/ResourceManager.hpp>
+#include <Jobs/ThreadPool.hpp>
+#include <Scene/Scene.hpp>
+#include <System/MountablePath.hpp>
+#include <Triggers/TriggerManager.hpp>
+#include <Utils/FileUtils.hpp>
+
+#include <vili/node.hpp>
+#include <vili/parser/parser.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t SpritesAmount = 20000;
+    constexpr std::size_t ObjectsAmount = 5000;
+    constexpr std::size_t LoadsAmount = 5;
+    constexpr const char* BenchmarkDirectory = "obe_scene_load_benchmark";
+    constexpr const char* SceneFile = "Data/Maps/Benchmark.map.vili";
+
+    // An object type with only a Sprite so loading it does not run any Lua
+    constexpr const char* ObjectDefinition = R"(
+Block:
+    Sprite:
+        rect: {x: 0.0, y: 0.0, width: 0.1, height: 0.1}
+)";
+
+    vili::node makeSceneData()
+    {
+        vili::node data = vili::object {};
+        data["Meta"] = vili::object { { "name", "Benchmark" } };
+        data["View"] = vili::object { { "size", 1.0 },
+            { "position", vili::object { { "x", 0.0 }, { "y", 0.0 } } } };
+        data["Sprites"] = vili::object {};
+        for (std::size_t i = 0; i < SpritesAmount; i++)
+        {
+            // Tiles of a 200 x 100 grid
+            const double x = static_cast<double>(i % 200) / 10;
+            const double y = static_cast<double>(i / 200) / 10;
+            data["Sprites"]["sprite" + std::to_string(i)] = vili::object {
+                { "rect",
+                    vili::object { { "x", x }, { "y", y }, { "width", 0.1 },
+                        { "height", 0.1 } } },
+                { "layer", static_cast<vili::integer>(i % 5) }
+            };
+        }
+        data["GameObjects"] = vili::object {};
+        for (std::size_t i = 0; i < ObjectsAmount; i++)
+        {
+            data["GameObjects"]["object" + std::to_string(i)]
+                = vili::object { { "type", "Block" } };
+        }
+        return data;
+    }
+
+    void createFiles()
+    {
+        const std::string base = BenchmarkDirectory;
+        for (const std::string& directory : { "", "/Data", "/Data/GameObjects",
+                 "/Data/GameObjects/Block", "/Data/Maps" })
+        {
+            Utils::File::createDirectory(base + directory);
+        }
+        std::ofstream(base + "/Data/GameObjects/Block/Block.obj.vili")
+            << ObjectDefinition;
+        // The root of a vili file is not indented, unlike the ones dumped
+        const vili::node data = makeSceneData();
+        std::ofstream scene(base + "/" + SceneFile);
+        for (const auto& [key, value] : data.items())
+            scene << key << ": " << value.dump() << std::endl;
+    }
+
+    struct LoadTimes
+    {
+        double total = 0;
+        double longestUpdate = 0;
+        std::size_t updates = 0;
+    };
+
+    // Updates the Scene like the Engine does until the Scene file is loaded
+    LoadTimes measureLoad(Scene::Scene& scene, Jobs::ThreadPool& threadPool)
+    {
+        using Clock = std::chrono::steady_clock;
+        LoadTimes times;
+        scene.setFutureLoadFromFile(SceneFile);
+        const auto start = Clock::now();
+        do
+        {
+            const auto updateStart = Clock::now();
+            threadPool.runMainThreadTasks();
+            scene.update();
+            const std::chrono::duration<double> update = Clock::now() - updateStart;
+            times.longestUpdate = std::max(times.longestUpdate, update.count());
+            times.updates++;
+        } while (scene.isLoading());
+        times.total = std::chrono::duration<double>(Clock::now() - start).count();
+        return times;
+    }
+}
+
+TEST_CASE("Loading a large Scene", "[obe.Scene.Load][!benchmark]")
+{
+    if (!Debug::Log)
+        Debug::Log = std::make_shared<spdlog::logger>("Log");
+    createFiles();
+    const System::MountablePath mount(
+        System::MountablePathType::Path, BenchmarkDirectory, 100);
+    System::MountablePath::Mount(mount);
+
+    sol::state lua;
+    lua["__TRIGGERS"].get_or_create<sol::table>();
+    Triggers::TriggerManager triggers(lua);
+    triggers.createNamespace("Event");
+    Engine::ResourceManager resources;
+    Scene::Scene scene(triggers, lua);
+    scene.attachResourceManager(resources);
+
+    vili::node data = makeSceneData();
+    const double loadRate = Benchmarks::measureRate(LoadsAmount, [&]() {
+        for (std::size_t i = 0; i < LoadsAmount; i++)
+        {
+            scene.clear();
+            scene.load(data);
+        }
+    });
+    REQUIRE(scene.getSpriteAmount() == SpritesAmount + ObjectsAmount);
+    REQUIRE(scene.getGameObjectAmount() == ObjectsAmount);
+
+    // Scripts and triggers look elements up by id all the time
+    std::size_t found = 0;
+    const double lookupRate
+        = Benchmarks::measureRate(SpritesAmount + ObjectsAmount, [&]() {
+              for (std::size_t i = 0; i < SpritesAmount; i++)
+                  found += scene.doesSpriteExists("sprite" + std::to_string(i));
+              for (std::size_t i = 0; i < ObjectsAmount; i++)
+                  found += scene.doesGameObjectExists("object" + std::to_string(i));
+          });
+    REQUIRE(found == SpritesAmount + ObjectsAmount);
+
+    Benchmarks::report("Sprites", SpritesAmount, "sprites");
+    Benchmarks::report("GameObjects", ObjectsAmount, "objects");
+    Benchmarks::report("Scene load", 1e3 / loadRate, "ms/load");
+    Benchmarks::report("Id lookups", lookupRate / 1e6, "M lookups/s");
+
+    scene.clear();
+    Script::GameObjectDatabase::Clear();
+    System::MountablePath::Unmount(mount);
+    std::filesystem::remove_all(BenchmarkDirectory);
+}
+
+TEST_CASE("Loading a large Scene in the background", "[obe.Scene.Load][!benchmark]")
+{
+    if (!Debug::Log)
+        Debug::Log = std::make_shared<spdlog::logger>("Log");
+    createFiles();
+    const System::MountablePath mount(
+        System::MountablePathType::Path, BenchmarkDirectory, 100);
+    System::MountablePath::Mount(mount);
+
+    sol::state lua;
+    lua["__TRIGGERS"].get_or_create<sol::table>();
+    Triggers::TriggerManager triggers(lua);
+    triggers.createNamespace("Event");
+    Engine::ResourceManager resources;
+    Scene::Scene scene(triggers, lua);
+    scene.attachResourceManager(resources);
+    Jobs::ThreadPool threadPool;
+
+    const LoadTimes blocking = measureLoad(scene, threadPool);
+    REQUIRE(scene.getGameObjectAmount() == ObjectsAmount);
+    scene.attachThreadPool(&threadPool);
+    const LoadTimes background = measureLoad(scene, threadPool);
+    REQUIRE(scene.getSpriteAmount() == SpritesAmount + ObjectsAmount);
+    REQUIRE(scene.getGameObjectAmount() == ObjectsAmount);
+    scene.attachThreadPool(nullptr);
+
+    Benchmarks::report("Elements", SpritesAmount + ObjectsAmount, "elements");
+    Benchmarks::report("Loading budget", scene.getLoadingBudget() * 1e3, "ms");
+    Benchmarks::report("Blocking load", blocking.total * 1e3, "ms");
+    Benchmarks::report("Background load", background.total * 1e3, "ms");
+    Benchmarks::report("Background updates", background.updates, "updates");
+    Benchmarks::report(
+        "Longest background update", background.longestUpdate * 1e3, "ms");
+
+    scene.clear();
+    Script::GameObjectDatabase::Clear();
+    System::MountablePath::Unmount(mount);
+    std::filesystem::remove_all(BenchmarkDirectory);
+}
+
+TEST_CASE("Loading a large Scene from a compiled file", "[obe.Scene.Load][!benchmark]")
+{
+    if (!Debug::Log)
+        Debug::Log = std::make_shared<spdlog::logger>("Log");
+    createFiles();
+    const System::MountablePath mount(
+        System::MountablePathType::Path, BenchmarkDirectory, 100);
+    System::MountablePath::Mount(mount);
+
+    sol::state lua;
+    lua["__TRIGGERS"].get_or_create<sol::table>();
+    Triggers::TriggerManager triggers(lua);
+    triggers.createNamespace("Event");
+    Engine::ResourceManager resources;
+    Scene::Scene scene(triggers, lua);
+    scene.attachResourceManager(resources);
+
+    const std::string path = std::string(BenchmarkDirectory) + "/" + SceneFile;
+    const auto loadAll = [&]() {
+        for (std::size_t i = 0; i < LoadsAmount; i++)
+            scene.loadFromFile(SceneFile);
+    };
+    const double parseRate = Benchmarks::measureRate(LoadsAmount, [&]() {
+        for (std::size_t i = 0; i < LoadsAmount; i++)
+            vili::parser::from_file(path, Config::Templates::getSceneTemplates());
+    });
+    const double textLoadRate = Benchmarks::measureRate(LoadsAmount, loadAll);
+
+    // What ObEngineCompiler does to .map.vili files
+    const std::string compiledPath = Config::GetCompiledPath(path);
+    const std::string compiled = Config::CompileNode(
+        vili::parser::from_file(path, Config::Templates::getSceneTemplates()));
+    std::ofstream(compiledPath, std::ios::binary) << compiled;
+    REQUIRE(Config::OpenCompiledFile(path) != nullptr);
+    const double readRate = Benchmarks::measureRate(LoadsAmount, [&]() {
+        for (std::size_t i = 0; i < LoadsAmount; i++)
+            Config::LoadFile(path);
+    });
+    const double compiledLoadRate = Benchmarks::measureRate(LoadsAmount, loadAll);
+    REQUIRE(scene.getSpriteAmount() == SpritesAmount + ObjectsAmount);
+    REQUIRE(scene.getGameObjectAmount() == ObjectsAmount);
+
+    Benchmarks::report("Elements", SpritesAmount + ObjectsAmount, "elements");
+    Benchmarks::report(
+        "Vili file", std::filesystem::file_size(path) / 1024.0, "KiB");
+    Benchmarks::report("Compiled file", compiled.size() / 1024.0, "KiB");
+    Benchmarks::report("Parsing the vili file", 1e3 / parseRate, "ms/load");
+    Benchmarks::report("Reading the compiled file", 1e3 / readRate, "ms/load");
+    Benchmarks::report("Scene load from vili", 1e3 / textLoadRate, "ms/load");
+    Benchmarks::report("Scene load from compiled", 1e3 / compiledLoadRate, "ms/load");
+
+    scene.clear();
+    Script::GameObjectDatabase::Clear();
+    System::MountablePath::Unmount(mount);
+    std::filesystem::remove_all(BenchmarkDirectory);
+}
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+#include <sol/sol.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Debug/Logger.hpp>
+#include <Script/GarbageCollector.hpp>
+#include <Triggers/TriggerManager.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t ObjectsAmount = 100;
+    constexpr std::size_t FramesAmount = 600;
+
+    // Every object keeps 2000 tables alive (replacing one of them each frame)
+    // and creates 50 short-lived tables and strings per Update
+    constexpr const char* ObjectScript = R"(
+        local state = {};
+        for i = 1, 2000 do
+            state[i] = { x = i, y = i * 2, name = "item" .. i };
+        end
+        local frame = 0;
+        function Update(dt)
+            frame = frame + 1;
+            local garbage = {};
+            for i = 1, 50 do
+                garbage[i] = { dt = dt, label = "frame" .. frame .. ":" .. i };
+            end
+            local index = frame % #state + 1;
+            state[index] = { x = frame, y = #garbage, name = "item" .. frame };
+        end
+    )";
+
+    struct FrameTimes
+    {
+        double median;
+        double p99;
+        double max;
+    };
+
+    FrameTimes measureFrames(Script::GarbageCollectorMode mode)
+    {
+        sol::state lua;
+        lua.open_libraries(sol::lib::base, sol::lib::string, sol::lib::table);
+        lua["__TRIGGERS"].get_or_create<sol::table>();
+        Triggers::TriggerManager triggers(lua);
+        triggers.createNamespace("Event");
+        Triggers::TriggerGroupPtr game = triggers.createTriggerGroup("Event", "Game");
+        game->add("Update");
+
+        std::deque<bool> active(ObjectsAmount, true);
+        for (std::size_t i = 0; i < ObjectsAmount; i++)
+        {
+            sol::environment environment(lua, sol::create, lua.globals());
+            environment["__TRIGGERS"] = lua["__TRIGGERS"];
+            lua.safe_script(ObjectScript, environment);
+            game->get("Update").lock()->registerEnvironment(
+                "object" + std::to_string(i), environment, "Update", &active[i]);
+        }
+
+        Script::GarbageCollector garbageCollector(lua);
+        garbageCollector.setMode(mode);
+        std::vector<double> frameTimes;
+        frameTimes.reserve(FramesAmount);
+        for (std::size_t frame = 0; frame < FramesAmount; frame++)
+        {
+            const double frameRate = Benchmarks::measureRate(1, [&]() {
+                game->pushParameter("Update", "dt", 1.0 / 60.0);
+                game->trigger("Update");
+                garbageCollector.update();
+            });
+            frameTimes.push_back(1e3 / frameRate);
+        }
+        // Garbage must not pile up whatever the mode
+        garbageCollector.collect();
+        const std::size_t liveMemory = garbageCollector.getMemoryUsage();
+        for (std::size_t frame = 0; frame < 60; frame++)
+        {
+            game->pushParameter("Update", "dt", 1.0 / 60.0);
+            game->trigger("Update");
+            garbageCollector.update();
+        }
+        REQUIRE(garbageCollector.getMemoryUsage() < liveMemory * 4);
+
+        std::sort(frameTimes.begin(), frameTimes.end());
+        return FrameTimes { frameTimes[frameTimes.size() / 2],
+            frameTimes[frameTimes.size() * 99 / 100], frameTimes.back() };
+    }
+}
+
+TEST_CASE("Frame times of Lua allocating heavily from triggers",
+    "[obe.Script.GarbageCollector][!benchmark]")
+{
+    if (!Debug::Log)
+        Debug::Log = std::make_shared<spdlog::logger>("Log");
+
+    const auto report = [](const std::string& name, const FrameTimes& times) {
+        Benchmarks::report(name + " median", times.median, "ms/frame");
+        Benchmarks::report(name + " p99", times.p99, "ms/frame");
+        Benchmarks::report(name + " max", times.max, "ms/frame");
+    };
+    report("Full collection", measureFrames(Script::GarbageCollectorMode::Full));
+    report("Incremental steps",
+        measureFrames(Script::GarbageCollectorMode::Incremental));
+    report("Generational steps",
+        measureFrames(Script::GarbageCollectorMode::Generational));
+}
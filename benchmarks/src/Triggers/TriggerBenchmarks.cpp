@@ -0,0 +1,238 @@
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+#include <sol/sol.hpp>
+
+#include <BenchmarkUtils.hpp>
+#include <Debug/Logger.hpp>
+#include <Time/TimeUtils.hpp>
+#include <Triggers/TriggerManager.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr std::size_t ObjectsAmount = 5000;
+    constexpr std::size_t FramesAmount = 200;
+    constexpr std::size_t FiresAmount = 200000;
+    constexpr std::size_t TimersAmount = 100000;
+    constexpr std::size_t UpdatesAmount = 1000;
+
+    constexpr const char* ObjectScript = R"(
+        elapsed = 0;
+        function Update(dt)
+            elapsed = elapsed + dt;
+        end
+    )";
+
+    std::size_t LuaAllocations = 0;
+
+    // Same as the default allocator of Lua, counting the (re)allocations
+    void* countingAllocator(void*, void* block, std::size_t oldSize, std::size_t newSize)
+    {
+        if (newSize == 0)
+        {
+            std::free(block);
+            return nullptr;
+        }
+        if (!block || newSize > oldSize)
+            LuaAllocations++;
+        return std::realloc(block, newSize);
+    }
+
+    // Update of the CallbackSchedulers before the timing wheel, every pending
+    // scheduler was checked (sampling the clock) on each update
+    struct ScannedScheduler
+    {
+        Time::TimeUnit start;
+        Time::TimeUnit after;
+        bool done = false;
+    };
+
+    void scanSchedulers(std::vector<std::unique_ptr<ScannedScheduler>>& schedulers,
+        std::size_t& executions)
+    {
+        for (auto& scheduler : schedulers)
+        {
+            if (Time::epoch() - scheduler->start >= scheduler->after)
+            {
+                scheduler->done = true;
+                executions++;
+            }
+        }
+        schedulers.erase(std::remove_if(schedulers.begin(), schedulers.end(),
+                             [](auto& scheduler) { return scheduler->done; }),
+            schedulers.end());
+    }
+}
+
+TEST_CASE("Allocations of a Trigger with many subscribers",
+    "[obe.Triggers.Trigger][!benchmark]")
+{
+    if (!Debug::Log)
+        Debug::Log = std::make_shared<spdlog::logger>("Log");
+
+    sol::state lua(sol::default_at_panic, countingAllocator);
+    lua.open_libraries(sol::lib::base);
+    lua["__TRIGGERS"].get_or_create<sol::table>();
+    Triggers::TriggerManager triggers(lua);
+    triggers.createNamespace("Event");
+    Triggers::TriggerGroupPtr game = triggers.createTriggerGroup("Event", "Game");
+    game->add("Update");
+
+    std::deque<bool> active(ObjectsAmount, true);
+    std::deque<sol::environment> environments;
+    for (std::size_t i = 0; i < ObjectsAmount; i++)
+    {
+        sol::environment& environment
+            = environments.emplace_back(lua, sol::create, lua.globals());
+        environment["__TRIGGERS"] = lua["__TRIGGERS"];
+        lua.safe_script(ObjectScript, environment);
+        game->get("Update").lock()->registerEnvironment(
+            "object" + std::to_string(i), environment, "Update", &active[i]);
+    }
+
+    const auto frame = [&game]() {
+        game->pushParameter("Update", "dt", 1.0 / 60.0);
+        game->trigger("Update");
+    };
+    // First frame creates the callbacks of every environment
+    frame();
+    lua.collect_garbage();
+
+    const std::size_t allocationsBefore = LuaAllocations;
+    const double frameRate = Benchmarks::measureRate(FramesAmount, [&]() {
+        for (std::size_t i = 0; i < FramesAmount; i++)
+            frame();
+    });
+    const double allocationsPerFrame
+        = static_cast<double>(LuaAllocations - allocationsBefore) / FramesAmount;
+
+    const double expected = (FramesAmount + 1) / 60.0;
+    REQUIRE(environments.front()["elapsed"].get<double>() == Approx(expected));
+    REQUIRE(environments.back()["elapsed"].get<double>() == Approx(expected));
+
+    Benchmarks::report("Update", 1e6 / frameRate, "us/frame");
+    Benchmarks::report("Lua allocations", allocationsPerFrame, "allocations/frame");
+}
+
+TEST_CASE("Cost of firing a Trigger by name and by handle",
+    "[obe.Triggers.TriggerManager][!benchmark]")
+{
+    if (!Debug::Log)
+        Debug::Log = std::make_shared<spdlog::logger>("Log");
+
+    sol::state lua;
+    lua.open_libraries(sol::lib::base);
+    lua["__TRIGGERS"].get_or_create<sol::table>();
+    Triggers::TriggerManager triggers(lua);
+    triggers.createNamespace("Event");
+    Triggers::TriggerGroupPtr game = triggers.createTriggerGroup("Event", "Game");
+    game->add("Start").add("End").add("Update").add("Render");
+
+    bool active = true;
+    sol::environment environment(lua, sol::create, lua.globals());
+    lua.safe_script(ObjectScript, environment);
+    game->get("Update").lock()->registerEnvironment(
+        "object", environment, "Update", &active);
+
+    const Triggers::TriggerHandle handle
+        = triggers.getTriggerHandle("Event", "Game", "Update");
+    const std::size_t dt = triggers.getTrigger(handle).getArgumentId("dt");
+    REQUIRE(&triggers.getTrigger(handle)
+        == triggers.getTrigger("Event", "Game", "Update").lock().get());
+
+    const double lookupByNameRate = Benchmarks::measureRate(FiresAmount, [&]() {
+        for (std::size_t i = 0; i < FiresAmount; i++)
+            triggers.getTrigger("Event", "Game", "Update").lock()->getState();
+    });
+    const double lookupByHandleRate = Benchmarks::measureRate(FiresAmount, [&]() {
+        for (std::size_t i = 0; i < FiresAmount; i++)
+            triggers.getTrigger(handle).getState();
+    });
+    const double fireByNameRate = Benchmarks::measureRate(FiresAmount, [&]() {
+        for (std::size_t i = 0; i < FiresAmount; i++)
+        {
+            game->pushParameter("Update", "dt", 1.0);
+            game->trigger("Update");
+        }
+    });
+    const double fireByHandleRate = Benchmarks::measureRate(FiresAmount, [&]() {
+        for (std::size_t i = 0; i < FiresAmount; i++)
+        {
+            triggers.pushParameter(handle, dt, 1.0);
+            triggers.trigger(handle);
+        }
+    });
+    REQUIRE(environment["elapsed"].get<double>() == Approx(FiresAmount * 2));
+
+    // Handles of removed Triggers are never given to another Trigger
+    game->remove("Update");
+    REQUIRE_THROWS(triggers.getTrigger(handle));
+    game->add("Update");
+    REQUIRE(triggers.getTriggerHandle("Event", "Game", "Update") != handle);
+
+    Benchmarks::report("Lookup by name", 1e9 / lookupByNameRate, "ns/lookup");
+    Benchmarks::report("Lookup by handle", 1e9 / lookupByHandleRate, "ns/lookup");
+    Benchmarks::report("Fire by name", 1e9 / fireByNameRate, "ns/fire");
+    Benchmarks::report("Fire by handle", 1e9 / fireByHandleRate, "ns/fire");
+}
+
+TEST_CASE("Update of the TriggerManager with many pending CallbackSchedulers",
+    "[obe.Triggers.CallbackScheduler][!benchmark]")
+{
+    if (!Debug::Log)
+        Debug::Log = std::make_shared<spdlog::logger>("Log");
+
+    sol::state lua;
+    Triggers::TriggerManager triggers(lua);
+    std::size_t executions = 0;
+    const auto count = [&executions]() { executions++; };
+
+    std::vector<Triggers::CallbackHandle> handles;
+    handles.reserve(TimersAmount);
+    const double scheduleRate = Benchmarks::measureRate(TimersAmount, [&]() {
+        for (std::size_t i = 0; i < TimersAmount; i++)
+        {
+            // Spread over one hour so that timers are stored in every level
+            handles.push_back(triggers.schedule()
+                                  .after(3600.0 * (i + 1) / TimersAmount + 60)
+                                  .run(count));
+        }
+    });
+    triggers.schedule().every(0).run(count);
+    const double updateRate = Benchmarks::measureRate(UpdatesAmount, [&]() {
+        for (std::size_t i = 0; i < UpdatesAmount; i++)
+            triggers.update();
+    });
+    REQUIRE(executions == UpdatesAmount);
+    REQUIRE(triggers.getScheduledAmount() == TimersAmount + 1);
+    const double cancelRate = Benchmarks::measureRate(TimersAmount, [&]() {
+        for (const Triggers::CallbackHandle handle : handles)
+            triggers.cancel(handle);
+    });
+    REQUIRE(triggers.getScheduledAmount() == 1);
+
+    std::vector<std::unique_ptr<ScannedScheduler>> scanned;
+    for (std::size_t i = 0; i < TimersAmount; i++)
+    {
+        scanned.push_back(std::make_unique<ScannedScheduler>(
+            ScannedScheduler { Time::epoch(), 3600.0 * (i + 1) / TimersAmount + 60 }));
+    }
+    std::size_t scannedExecutions = 0;
+    const double scanRate = Benchmarks::measureRate(UpdatesAmount / 10, [&]() {
+        for (std::size_t i = 0; i < UpdatesAmount / 10; i++)
+            scanSchedulers(scanned, scannedExecutions);
+    });
+    REQUIRE(scannedExecutions == 0);
+
+    Benchmarks::report("Schedule", 1e9 / scheduleRate, "ns/timer");
+    Benchmarks::report("Cancel", 1e9 / cancelRate, "ns/timer");
+    Benchmarks::report("Update (timing wheel)", 1e6 / updateRate, "us/update");
+    Benchmarks::report("Update (linear scan)", 1e6 / scanRate, "us/update");
+}
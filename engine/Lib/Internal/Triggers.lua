@@ -82,29 +82,3 @@ function LuaCore.FuncInjector(env, funcToCall, triggerRegisterName)
         funcToCall(ArgMirror.Unpack(Lua_Func_CallArgs));
     end
 end
-
-function LuaCore.MakeCallback(trigger, callback, callbackName)
-    local ArgMirror = require('Lib/Internal/ArgMirror');
-    local argTable = "__TRIGGERS[\"%s\"][\"ArgTable\"][\"%s\"]"
-    local argStringList = {};
-
-    local argList = ArgMirror.GetArgs(callback);
-    for k, v in pairs(argList) do
-        table.insert(argStringList, argTable:format(trigger, v));
-    end
-    local funcCall = callbackName .. "(" .. table.concat(argStringList, ", ") ..
-                         ")";
-
-    local func, err = load("return function() " .. funcCall .. " end",
-                           callbackName, "t", _ENV);
-    if func then
-        local ok, callbackGetter = pcall(func);
-        if ok then
-            return callbackGetter;
-        else
-            print("MakeCallback Execution error: ", callbackGetter);
-        end
-    else
-        print("MakeCallback Compilation error:", err);
-    end
-end
@@ -72,8 +72,10 @@ namespace vili::utils::string
         std::from_chars(input.data(), input.data() + input.size(), data_out);
         return data_out;
 #else
+        // The input is a view in the parsed content, it is not null-terminated
         const char* num = input.data();
-        if (!num || !*num)
+        const char* end = input.data() + input.size();
+        if (num == end)
         {
             return 0;
         }
@@ -94,7 +96,7 @@ namespace vili::utils::string
             ++num;
         }
 
-        while (*num != '\0')
+        while (num != end)
         {
             if (*num >= '0' && *num <= '9')
             {
@@ -117,7 +119,7 @@ namespace vili::utils::string
         {
             double fractionExpo = 0.1;
 
-            while (*num != '\0')
+            while (num != end)
             {
                 if (*num >= '0' && *num <= '9')
                 {
@@ -144,12 +146,19 @@ namespace vili::utils::string
         return data_out;
 #else
         long long data_out = 0;
-        const char* str = input.data();
-        while (*str)
+        long long sign = 1;
+        std::size_t index = 0;
+        if (!input.empty() && (input[0] == '-' || input[0] == '+'))
         {
-            data_out = data_out * 10 + (*str++ - '0');
+            sign = (input[0] == '-') ? -1 : 1;
+            index++;
         }
-        return data_out;
+        for (; index < input.size() && input[index] >= '0' && input[index] <= '9';
+             index++)
+        {
+            data_out = data_out * 10 + (input[index] - '0');
+        }
+        return sign * data_out;
 #endif
     }
 
@@ -14,7 +14,7 @@ namespace obe::Animation
     {
     private:
         /**
-         * \brief Stores the last epoch to wait until the AnimationGroup delay
+         * \brief Stores the last frame time to wait until the AnimationGroup delay
          */
         Time::TimeUnit m_groupClock = 0;
         /**
@@ -6,9 +6,12 @@ namespace sol
 };
 namespace obe::Collision::Bindings
 {
+    void LoadClassCastResult(sol::state_view state);
     void LoadClassCollisionData(sol::state_view state);
+    void LoadClassPenetration(sol::state_view state);
     void LoadClassPolygonalCollider(sol::state_view state);
     void LoadClassTrajectory(sol::state_view state);
     void LoadClassTrajectoryNode(sol::state_view state);
+    void LoadEnumBroadPhaseType(sol::state_view state);
     void LoadEnumColliderTagType(sol::state_view state);
 };
\ No newline at end of file
@@ -6,6 +6,10 @@ namespace sol
 };
 namespace obe::Debug::Bindings
 {
+    void LoadClassProfiler(sol::state_view state);
+    void LoadClassProfilerCounter(sol::state_view state);
+    void LoadClassProfilerFrame(sol::state_view state);
+    void LoadClassProfilerZone(sol::state_view state);
     void LoadFunctionInitLogger(sol::state_view state);
     void LoadFunctionTrace(sol::state_view state);
     void LoadFunctionDebug(sol::state_view state);
@@ -14,4 +18,5 @@ namespace obe::Debug::Bindings
     void LoadFunctionError(sol::state_view state);
     void LoadFunctionCritical(sol::state_view state);
     void LoadGlobalLog(sol::state_view state);
+    void LoadGlobalEngineProfiler(sol::state_view state);
 };
\ No newline at end of file
@@ -13,6 +13,8 @@ namespace obe::Graphics::Bindings
     void LoadClassRichText(sol::state_view state);
     void LoadClassShader(sol::state_view state);
     void LoadClassSprite(sol::state_view state);
+    void LoadClassSpriteBatch(sol::state_view state);
+    void LoadClassSpriteBatchRun(sol::state_view state);
     void LoadClassSpriteHandlePoint(sol::state_view state);
     void LoadClassText(sol::state_view state);
     void LoadClassTexture(sol::state_view state);
@@ -10,5 +10,6 @@ namespace obe::Script::Exceptions::Bindings
     void LoadClassObjectDefinitionBlockNotFound(sol::state_view state);
     void LoadClassObjectDefinitionNotFound(sol::state_view state);
     void LoadClassScriptFileNotFound(sol::state_view state);
+    void LoadClassUnknownGarbageCollectorMode(sol::state_view state);
     void LoadClassWrongSourceAttributeType(sol::state_view state);
 };
\ No newline at end of file
@@ -8,4 +8,7 @@ namespace obe::Script::Bindings
 {
     void LoadClassGameObject(sol::state_view state);
     void LoadClassGameObjectDatabase(sol::state_view state);
+    void LoadClassGarbageCollector(sol::state_view state);
+    void LoadEnumGarbageCollectorMode(sol::state_view state);
+    void LoadFunctionStringToGarbageCollectorMode(sol::state_view state);
 };
\ No newline at end of file
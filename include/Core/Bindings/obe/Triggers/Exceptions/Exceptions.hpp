@@ -13,5 +13,6 @@ namespace obe::Triggers::Exceptions::Bindings
     void LoadClassTriggerNamespaceAlreadyExists(sol::state_view state);
     void LoadClassUnknownTrigger(sol::state_view state);
     void LoadClassUnknownTriggerGroup(sol::state_view state);
+    void LoadClassUnknownTriggerHandle(sol::state_view state);
     void LoadClassUnknownTriggerNamespace(sol::state_view state);
 };
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Collision/BroadPhase.hpp>
+
+namespace obe::Collision
+{
+    /**
+     * \brief Dynamic bounding volume hierarchy of fattened AABB
+     *
+     * Leaves store a slightly enlarged version of the collider bounds so that
+     * small movements do not require any restructuring, the tree is kept
+     * balanced using rotations on insertion and removal.
+     */
+    class AABBTree : public BroadPhase
+    {
+    private:
+        struct Node
+        {
+            AABB bounds;
+            PolygonalCollider* collider = nullptr;
+            int parent = NullProxy;
+            int left = NullProxy;
+            int right = NullProxy;
+            // Leaves have height 0, free nodes have height -1
+            int height = -1;
+            [[nodiscard]] bool isLeaf() const;
+        };
+
+        std::vector<Node> m_nodes;
+        int m_root = NullProxy;
+        int m_freeList = NullProxy;
+        std::size_t m_leafCount = 0;
+        double m_margin;
+        mutable std::vector<int> m_stack;
+
+        int allocateNode();
+        void freeNode(int node);
+        void insertLeaf(int leaf);
+        void removeLeaf(int leaf);
+        int balance(int node);
+        [[nodiscard]] AABB fatten(const AABB& bounds) const;
+
+    public:
+        /**
+         * \brief Default margin used to fatten leaves (ratio of the bounds size)
+         */
+        static constexpr double DefaultMargin = 0.1;
+        /**
+         * \brief Creates an empty AABBTree
+         * \param margin Ratio of the bounds size added on each side of the leaves
+         */
+        explicit AABBTree(double margin = DefaultMargin);
+
+        ProxyId insert(PolygonalCollider& collider, const AABB& bounds) override;
+        bool update(ProxyId proxy, const AABB& bounds) override;
+        void remove(ProxyId proxy) override;
+        void query(
+            const AABB& area, std::vector<PolygonalCollider*>& result) const override;
+        [[nodiscard]] std::size_t size() const override;
+        [[nodiscard]] BroadPhaseType getType() const override;
+        /**
+         * \brief Gets the height of the tree (0 for a single leaf)
+         */
+        [[nodiscard]] int getHeight() const;
+    };
+} // namespace obe::Collision
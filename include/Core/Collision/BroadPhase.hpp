@@ -0,0 +1,130 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace obe::Collision
+{
+    class PolygonalCollider;
+
+    /**
+     * \brief Axis-aligned bounding box used by the broad-phase (in SceneUnits)
+     */
+    class AABB
+    {
+    public:
+        double minX = 0;
+        double minY = 0;
+        double maxX = 0;
+        double maxY = 0;
+
+        AABB() = default;
+        AABB(double minX, double minY, double maxX, double maxY);
+        /**
+         * \brief Checks if two AABB overlap (touching edges count as overlap)
+         * \param other The other AABB to test
+         * \return true if both AABB overlap, false otherwise
+         */
+        [[nodiscard]] bool intersects(const AABB& other) const;
+        /**
+         * \brief Checks if the AABB fully contains another one
+         * \param other The AABB that should be contained
+         * \return true if other is inside the AABB, false otherwise
+         */
+        [[nodiscard]] bool contains(const AABB& other) const;
+        /**
+         * \brief Gets the smallest AABB containing both AABB
+         * \param other The other AABB to merge with
+         * \return The merged AABB
+         */
+        [[nodiscard]] AABB merge(const AABB& other) const;
+        /**
+         * \brief Gets the AABB grown by the given amount on each side
+         * \param x Amount to add on the left and on the right
+         * \param y Amount to add on the top and on the bottom
+         * \return The inflated AABB
+         */
+        [[nodiscard]] AABB inflate(double x, double y) const;
+        /**
+         * \brief Gets the AABB swept along a displacement
+         * \param dx Displacement along x axis
+         * \param dy Displacement along y axis
+         * \return An AABB containing both the original and the moved AABB
+         */
+        [[nodiscard]] AABB sweep(double dx, double dy) const;
+        /**
+         * \brief Gets the perimeter of the AABB (used as insertion cost)
+         * \return The perimeter of the AABB
+         */
+        [[nodiscard]] double getPerimeter() const;
+    };
+
+    /**
+     * \brief Kinds of broad-phase a Scene can use to index its colliders
+     * \bind{BroadPhaseType}
+     */
+    enum class BroadPhaseType
+    {
+        // No spatial index, every query walks the whole collider pool
+        None,
+        // Dynamic AABB tree with fattened leaves, good default for most scenes
+        AABBTree,
+        // Uniform hash grid, good for dense levels made of same-sized tiles
+        UniformGrid
+    };
+
+    using ProxyId = int;
+    constexpr ProxyId NullProxy = -1;
+
+    /**
+     * \brief Spatial index used to find colliders whose bounds may overlap a
+     *        region before running any narrow-phase test
+     */
+    class BroadPhase
+    {
+    public:
+        virtual ~BroadPhase() = default;
+        /**
+         * \brief Adds a collider to the index
+         * \param collider Collider to index
+         * \param bounds Current bounds of the collider
+         * \return Identifier of the created proxy
+         */
+        virtual ProxyId insert(PolygonalCollider& collider, const AABB& bounds) = 0;
+        /**
+         * \brief Updates the bounds of an indexed collider
+         * \param proxy Proxy returned by insert
+         * \param bounds New bounds of the collider
+         * \return true if the index had to be modified, false otherwise
+         */
+        virtual bool update(ProxyId proxy, const AABB& bounds) = 0;
+        /**
+         * \brief Removes a collider from the index
+         * \param proxy Proxy returned by insert
+         */
+        virtual void remove(ProxyId proxy) = 0;
+        /**
+         * \brief Finds all colliders whose indexed bounds overlap the given area
+         * \param area Area to look into
+         * \param result Vector where the found colliders are appended (each
+         *        collider appears once)
+         */
+        virtual void query(
+            const AABB& area, std::vector<PolygonalCollider*>& result) const = 0;
+        /**
+         * \brief Gets how many colliders are indexed
+         */
+        [[nodiscard]] virtual std::size_t size() const = 0;
+        /**
+         * \brief Gets the type of the BroadPhase
+         */
+        [[nodiscard]] virtual BroadPhaseType getType() const = 0;
+    };
+
+    /**
+     * \brief Creates a BroadPhase of the given type
+     * \param type Type of BroadPhase to create
+     * \return The new BroadPhase or nullptr when type is BroadPhaseType::None
+     */
+    std::unique_ptr<BroadPhase> makeBroadPhase(BroadPhaseType type);
+} // namespace obe::Collision
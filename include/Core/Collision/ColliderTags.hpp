@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace obe::Collision
+{
+    using TagId = std::size_t;
+
+    /**
+     * \nobind
+     * \brief Global registry giving a unique index to each collider tag so
+     *        tags can be compared without any string comparison
+     */
+    class TagRegistry
+    {
+    public:
+        /**
+         * \brief Gets the index of a tag, registering it if needed
+         * \param tag Name of the tag
+         * \return The index of the tag
+         */
+        static TagId intern(const std::string& tag);
+        /**
+         * \brief Gets the index of a tag without registering it
+         * \param tag Name of the tag
+         * \return The index of the tag if it has already been registered
+         */
+        static std::optional<TagId> find(const std::string& tag);
+        /**
+         * \brief Gets the name of a registered tag
+         * \param id Index of the tag
+         * \return The name of the tag
+         */
+        static const std::string& getName(TagId id);
+        /**
+         * \brief Gets how many tags have been registered
+         * \return The amount of registered tags
+         */
+        static std::size_t size();
+    };
+
+    /**
+     * \nobind
+     * \brief Set of interned tags stored as a bitset, the first 64 tags are
+     *        stored inline and the bitset grows when more tags are registered
+     */
+    class TagMask
+    {
+    private:
+        std::uint64_t m_bits = 0;
+        std::vector<std::uint64_t> m_extraBits;
+
+    public:
+        /**
+         * \brief Adds a tag to the set
+         * \param id Index of the tag to add
+         */
+        void set(TagId id);
+        /**
+         * \brief Removes a tag from the set
+         * \param id Index of the tag to remove
+         */
+        void reset(TagId id);
+        /**
+         * \brief Removes all the tags from the set
+         */
+        void clear();
+        /**
+         * \brief Checks if the set contains a tag
+         * \param id Index of the tag to check
+         * \return true if the tag is in the set, false otherwise
+         */
+        [[nodiscard]] bool test(TagId id) const;
+        /**
+         * \brief Checks if the set contains no tag
+         * \return true if the set is empty, false otherwise
+         */
+        [[nodiscard]] bool empty() const;
+        /**
+         * \brief Checks if both sets have at least one tag in common
+         * \param other The other set of tags
+         * \return true if a tag is in both sets, false otherwise
+         */
+        [[nodiscard]] bool intersects(const TagMask& other) const;
+    };
+} // namespace obe::Collision
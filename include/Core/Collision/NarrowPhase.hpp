@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <Transform/UnitVector.hpp>
+
+namespace obe::Collision
+{
+    /**
+     * \brief Result of a narrow-phase test between two colliders
+     * \bind{Penetration}
+     */
+    class Penetration
+    {
+    public:
+        /**
+         * \brief true if both shapes are overlapping
+         */
+        bool colliding = false;
+        /**
+         * \brief Penetration depth along the normal (in ScenePixels)
+         */
+        double depth = 0;
+        /**
+         * \brief Unit-length contact normal (in ScenePixels space) pointing
+         *        towards the tested collider, moving it by normal * depth
+         *        separates both shapes
+         */
+        Transform::UnitVector normal = Transform::UnitVector(
+            0, 0, Transform::Units::ScenePixels);
+    };
+
+    /**
+     * \nobind
+     * \brief Convex polygon stored as contiguous coordinates (SoA) along with
+     *        its unit-length edge normals, used by the narrow-phase
+     */
+    class ConvexVertices
+    {
+    public:
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> normalX;
+        std::vector<double> normalY;
+
+        /**
+         * \brief Removes all the vertices (keeps the allocated memory)
+         */
+        void clear();
+        /**
+         * \brief Adds a vertex at the end of the polygon
+         */
+        void push(double vx, double vy);
+        /**
+         * \brief Computes the edge normals, must be called once all vertices
+         *        have been pushed
+         */
+        void computeNormals();
+        [[nodiscard]] std::size_t size() const;
+    };
+
+    /**
+     * \nobind
+     * \brief Time of impact between two convex polygons found by castConvex
+     */
+    class ImpactData
+    {
+    public:
+        /**
+         * \brief Fraction of the displacement travelled before the impact
+         */
+        double time = 1;
+        /**
+         * \brief Unit-length normal of the hit surface, pointing towards the
+         *        moving polygon
+         */
+        double normalX = 0;
+        double normalY = 0;
+    };
+
+    /**
+     * \nobind
+     * \brief Checks if a polygon is convex (collinear points are allowed)
+     * \param x Abscissas of the vertices
+     * \param y Ordinates of the vertices
+     * \return true if the polygon is convex, false otherwise
+     */
+    bool isConvex(const std::vector<double>& x, const std::vector<double>& y);
+
+    /**
+     * \nobind
+     * \brief Separating Axis Test between two convex polygons, stops at the
+     *        first separating axis found
+     * \param first First polygon (moved by offset)
+     * \param second Second polygon
+     * \param offsetX Offset applied to the first polygon along x axis
+     * \param offsetY Offset applied to the first polygon along y axis
+     * \param result Optional Penetration filled with the depth and normal of
+     *        the overlap (the normal pushes first away from second)
+     * \return true if both polygons overlap, false otherwise
+     */
+    bool testSeparatingAxes(const ConvexVertices& first, const ConvexVertices& second,
+        double offsetX, double offsetY, Penetration* result = nullptr);
+
+    /**
+     * \nobind
+     * \brief Casts a convex polygon along a displacement against another one by
+     *        casting a ray against their Minkowski difference, O(n + m)
+     * \param first Polygon being moved
+     * \param second Static polygon
+     * \param dx Displacement of the first polygon along x axis
+     * \param dy Displacement of the first polygon along y axis
+     * \param buffer Buffer used to store the Minkowski difference
+     * \param impact Filled with the time of impact and normal when hit
+     * \return true if first hits second before the end of the displacement
+     *         (polygons that are already deeply overlapping are ignored so they
+     *         can be moved apart), a null displacement only hits touching
+     *         polygons at time 0 with the normal of the touching edges
+     */
+    bool castConvex(const ConvexVertices& first, const ConvexVertices& second,
+        double dx, double dy, ConvexVertices& buffer, ImpactData& impact);
+} // namespace obe::Collision
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <array>
 #include <unordered_map>
 
+#include <Collision/BroadPhase.hpp>
+#include <Collision/ColliderTags.hpp>
+#include <Collision/NarrowPhase.hpp>
 #include <Component/Component.hpp>
 #include <Transform/Polygon.hpp>
 #include <Transform/UnitBasedObject.hpp>
@@ -48,6 +52,40 @@ namespace obe::Collision
         Transform::UnitVector offset;
     };
 
+    /**
+     * \brief Result of a swept query made with PolygonalCollider::castCollider
+     * \bind{CastResult}
+     */
+    class CastResult
+    {
+    public:
+        /**
+         * \brief First collider hit during the movement (nullptr if none)
+         */
+        PolygonalCollider* collider = nullptr;
+        /**
+         * \brief Fraction of the offset travelled before the impact (1 if no
+         *        collider was hit)
+         */
+        double timeOfImpact = 1;
+        /**
+         * \brief Unit-length normal of the hit surface (in ScenePixels space),
+         *        pointing towards the moving collider
+         */
+        Transform::UnitVector normal = Transform::UnitVector(
+            0, 0, Transform::Units::ScenePixels);
+        /**
+         * \brief Distance that can be travelled before the impact
+         */
+        Transform::UnitVector offset;
+        /**
+         * \brief Remaining movement after the impact projected along the hit
+         *        surface (null if no collider was hit)
+         */
+        Transform::UnitVector slide = Transform::UnitVector(
+            0, 0, Transform::Units::ScenePixels);
+    };
+
     /**
      * \brief Class used for all Collisions in the engine, it's a Polygon
      * containing n points
@@ -65,9 +103,36 @@ namespace obe::Collision
             { ColliderTagType::Accepted, {} },
             { ColliderTagType::Rejected, {} },
         };
+        // Same tags as m_tags interned in the TagRegistry (indexed by ColliderTagType)
+        std::array<TagMask, 3> m_tagMasks;
+
+        BroadPhase* m_broadPhase = nullptr;
+        ProxyId m_proxy = NullProxy;
+        // Colliders created outside of a Scene (from C++ or Lua) share this one
+        static BroadPhase& GetDefaultBroadPhase();
+
+        mutable ConvexVertices m_hull;
+        mutable std::size_t m_hullRevision = 0;
+        mutable ConvexVertices m_castBuffer;
 
         void resetUnit(Transform::Units unit) override;
-        [[nodiscard]] bool checkTags(const PolygonalCollider& collider) const;
+        void onPointsChanged() override;
+        /**
+         * \brief Gets the colliders of the same BroadPhase that may collide
+         *        with this one when moved by offset
+         * \param offset The offset to apply to the source collider
+         * \param candidates Buffer used to store the BroadPhase results
+         * \return A reference to candidates
+         */
+        const std::vector<PolygonalCollider*>& getCollisionCandidates(
+            const Transform::UnitVector& offset,
+            std::vector<PolygonalCollider*>& candidates) const;
+        /**
+         * \brief Gets the convex hull of the collider in ScenePixels, rebuilt
+         *        only when the cached vertices of the Polygon changed
+         * \return A reference to the cached convex vertices
+         */
+        const ConvexVertices& getConvexVertices() const;
 
     public:
         /**
@@ -80,6 +145,29 @@ namespace obe::Collision
          *        example)
          */
         explicit PolygonalCollider(const std::string& id);
+        ~PolygonalCollider() override;
+        /**
+         * \nobind
+         * \brief Registers the collider in a BroadPhase used to speed-up queries
+         *        (detaches it from the previous one), a collider only collides
+         *        with the colliders of its BroadPhase
+         * \param broadPhase BroadPhase to register in, nullptr to go back to the
+         *        BroadPhase shared by the colliders outside of a Scene
+         */
+        void attachBroadPhase(BroadPhase* broadPhase);
+        /**
+         * \nobind
+         * \brief Gets the BroadPhase the collider is registered in
+         * \return A pointer to the BroadPhase or nullptr if the collider uses the
+         *         BroadPhase shared by the colliders outside of a Scene
+         */
+        [[nodiscard]] BroadPhase* getBroadPhase() const;
+        /**
+         * \nobind
+         * \brief Gets the axis-aligned bounds of the collider in SceneUnits
+         * \return An AABB containing all the points of the collider
+         */
+        [[nodiscard]] AABB getBounds() const;
         // Tags
         /**
          * \brief Adds a Tag to the Collider
@@ -89,6 +177,20 @@ namespace obe::Collision
          */
         void addTag(ColliderTagType tagType, const std::string& tag);
 
+        /**
+         * \brief Checks if the Tags of another Collider pass the Accepted and
+         *        Rejected filters of this one
+         * \param collider The other Collider to check
+         * \return true if both colliders can collide, false otherwise
+         */
+        [[nodiscard]] bool checkTags(const PolygonalCollider& collider) const;
+        /**
+         * \nobind
+         * \brief Gets one of the Lists of Tags as a set of interned tags
+         * \param tagType List to get (Tag / Accepted / Rejected)
+         * \return A TagMask containing all the Tags of the chosen List
+         */
+        [[nodiscard]] const TagMask& getTagMask(ColliderTagType tagType) const;
         /**
          * \brief Clears Tags of the Collider
          * \param tagType List you want to clear (Tag / Accepted /Rejected)
@@ -109,6 +211,23 @@ namespace obe::Collision
          */
         bool doesCollide(
             PolygonalCollider& collider, const Transform::UnitVector& offset) const;
+        /**
+         * \brief Gets how deep two polygons are overlapping (concave polygons
+         *        are approximated by their convex hull)
+         * \param collider The other collider to test
+         * \param offset The offset to apply to the source collider
+         * \return A Penetration containing the depth and the contact normal
+         */
+        [[nodiscard]] Penetration getPenetration(
+            PolygonalCollider& collider, const Transform::UnitVector& offset) const;
+        /**
+         * \brief Moves the collider along offset (without actually moving it)
+         *        and finds the first collider it would hit
+         * \param offset The movement to test
+         * \return CastResult containing the hit collider, the time of impact,
+         *         the contact normal and the sliding movement
+         */
+        [[nodiscard]] CastResult castCollider(const Transform::UnitVector& offset) const;
         /**
          * \brief Check if the Collider contains one of the Tag in parameter
          * \param tagType List from where you want to check the Tags existence
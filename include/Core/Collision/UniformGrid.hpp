@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <Collision/BroadPhase.hpp>
+
+namespace obe::Collision
+{
+    /**
+     * \brief Sparse uniform grid where each collider is registered in every
+     *        cell its bounds overlap
+     */
+    class UniformGrid : public BroadPhase
+    {
+    private:
+        struct CellRange
+        {
+            std::int64_t minX = 0;
+            std::int64_t minY = 0;
+            std::int64_t maxX = -1;
+            std::int64_t maxY = -1;
+            bool operator==(const CellRange& other) const;
+            [[nodiscard]] std::size_t getCellCount() const;
+        };
+        struct Proxy
+        {
+            PolygonalCollider* collider = nullptr;
+            AABB bounds;
+            CellRange cells;
+            ProxyId nextFree = NullProxy;
+        };
+
+        double m_cellSize;
+        std::vector<Proxy> m_proxies;
+        ProxyId m_freeList = NullProxy;
+        std::size_t m_proxyCount = 0;
+        std::unordered_map<std::uint64_t, std::vector<ProxyId>> m_cells;
+        // Colliders covering too many cells are kept out of the grid
+        std::vector<ProxyId> m_largeProxies;
+        mutable std::vector<unsigned int> m_queryStamps;
+        mutable unsigned int m_currentStamp = 0;
+
+        [[nodiscard]] CellRange getCellRange(const AABB& bounds) const;
+        static std::uint64_t getCellKey(std::int64_t x, std::int64_t y);
+        void addToCells(ProxyId proxy, const CellRange& cells);
+        void removeFromCells(ProxyId proxy, const CellRange& cells);
+
+    public:
+        /**
+         * \brief Default size of a cell (in SceneUnits)
+         */
+        static constexpr double DefaultCellSize = 0.25;
+        /**
+         * \brief Colliders covering more cells are not stored in the grid
+         */
+        static constexpr std::size_t MaxCellsPerProxy = 64;
+        /**
+         * \brief Creates an empty UniformGrid
+         * \param cellSize Size of a cell (in SceneUnits)
+         */
+        explicit UniformGrid(double cellSize = DefaultCellSize);
+
+        ProxyId insert(PolygonalCollider& collider, const AABB& bounds) override;
+        bool update(ProxyId proxy, const AABB& bounds) override;
+        void remove(ProxyId proxy) override;
+        void query(
+            const AABB& area, std::vector<PolygonalCollider*>& result) const override;
+        [[nodiscard]] std::size_t size() const override;
+        [[nodiscard]] BroadPhaseType getType() const override;
+        /**
+         * \brief Gets the size of a cell (in SceneUnits)
+         */
+        [[nodiscard]] double getCellSize() const;
+    };
+} // namespace obe::Collision
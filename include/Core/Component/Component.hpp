@@ -33,12 +33,23 @@ namespace obe::Component
 
     template <class T> class Component : public ComponentBase
     {
+    private:
+        static constexpr std::size_t NotInPool = static_cast<std::size_t>(-1);
+        // Position in Pool so removing a Component does not search for it
+        std::size_t m_poolIndex = NotInPool;
+        void removeFromPool();
+
     public:
         /**
          * \nobind
          */
         static constexpr std::string_view ComponentType = "Component";
         explicit Component(const std::string& id);
+        // A copy would share the Pool position of the original
+        Component(const Component&) = delete;
+        Component(Component&&) = delete;
+        Component& operator=(const Component&) = delete;
+        Component& operator=(Component&&) = delete;
         ~Component() override;
 
         static std::vector<T*> Pool;
@@ -59,14 +70,26 @@ namespace obe::Component
     Component<T>::Component(const std::string& id)
         : ComponentBase(id)
     {
+        m_poolIndex = Pool.size();
         Pool.emplace_back(static_cast<T*>(this));
     }
 
     template <class T> Component<T>::~Component()
     {
-        Pool.erase(std::remove_if(Pool.begin(), Pool.end(),
-                       [&](T* ptr) -> bool { return (this == ptr); }),
-            Pool.end());
+        this->removeFromPool();
+    }
+
+    template <class T> void Component<T>::removeFromPool()
+    {
+        if (m_poolIndex == NotInPool)
+            return;
+        // The order of the Pool does not matter, the last Component takes the
+        // place of the removed one
+        Component<T>* last = Pool.back();
+        Pool[m_poolIndex] = static_cast<T*>(last);
+        last->m_poolIndex = m_poolIndex;
+        Pool.pop_back();
+        m_poolIndex = NotInPool;
     }
 
     /*template<class T>
@@ -91,9 +114,7 @@ namespace obe::Component
     template <class T> void Component<T>::remove()
     {
         RemoveComponent(this);
-        T::Pool.erase(std::remove_if(T::Pool.begin(), T::Pool.end(),
-                          [&](auto& elem) { return (this == elem); }),
-            T::Pool.end());
+        this->removeFromPool();
     }
 
     template <class T> std::vector<T*> Component<T>::Pool;
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <System/MappedFile.hpp>
+#include <System/Path.hpp>
+
+#include <vili/node.hpp>
+#include <vili/parser/parser_state.hpp>
+
+namespace obe::Config
+{
+    /**
+     * \brief Version of the compiled layout, compiled files of another version
+     *        are ignored and their vili file is parsed instead
+     */
+    constexpr std::uint32_t CompiledFileVersion = 1;
+    /**
+     * \brief Extension replacing the ".vili" one of compiled files
+     */
+    constexpr std::string_view CompiledFileExtension = ".vilc";
+
+    class CompiledFile;
+
+    /**
+     * \brief A node of a CompiledFile, read straight from the mapped file
+     * \nobind
+     */
+    class CompiledNode
+    {
+    private:
+        const CompiledFile* m_file;
+        const char* m_record;
+        void build(vili::node& node) const;
+
+    public:
+        CompiledNode(const CompiledFile& file, std::uint32_t index);
+        [[nodiscard]] vili::node_type getType() const;
+        /**
+         * \brief Get the key of the node in its parent object (empty in arrays)
+         */
+        [[nodiscard]] std::string_view getKey() const;
+        /**
+         * \brief Get the amount of children of an array or object node
+         */
+        [[nodiscard]] std::size_t size() const;
+        /**
+         * \brief Get a child of an array or object node, in the order of the file
+         */
+        [[nodiscard]] CompiledNode getChild(std::size_t index) const;
+        /**
+         * \brief Value accessors, the type of the node is not checked
+         */
+        [[nodiscard]] vili::integer asInteger() const;
+        [[nodiscard]] vili::number asNumber() const;
+        [[nodiscard]] vili::boolean asBoolean() const;
+        [[nodiscard]] std::string_view asString() const;
+        /**
+         * \brief Builds the vili tree of the node and all its children
+         */
+        [[nodiscard]] vili::node toNode() const;
+    };
+
+    /**
+     * \brief A compiled vili file mapped in memory
+     *
+     * The file is a flat, position independent layout (all integers are little
+     * endian) :
+     * - a header : "OBEC" magic, version, node count and string table size
+     *   (4 bytes each)
+     * - the node table : 16 bytes per node (type, key offset, value), children
+     *   of a container are contiguous and always placed after it, the root is
+     *   the first node
+     * - the string table : strings prefixed by their size, keys are stored once
+     * \nobind
+     */
+    class CompiledFile
+    {
+    private:
+        friend class CompiledNode;
+        System::MappedFile m_file;
+        std::uint32_t m_nodeCount = 0;
+        const char* m_nodes = nullptr;
+        const char* m_strings = nullptr;
+        std::uint32_t m_stringsSize = 0;
+        void validate() const;
+
+    public:
+        /**
+         * \brief Maps and checks the compiled file at the given path
+         * \throws obe::Config::Exceptions::InvalidCompiledFile if the file is
+         *         truncated, corrupted or of another CompiledFileVersion
+         * \throws obe::System::Exceptions::FileMappingFailed if the file can not
+         *         be mapped
+         */
+        explicit CompiledFile(const std::string& path);
+        [[nodiscard]] const std::string& getPath() const;
+        [[nodiscard]] std::size_t getNodeCount() const;
+        [[nodiscard]] CompiledNode getRoot() const;
+    };
+
+    /**
+     * \brief Serializes a vili tree to the layout of a CompiledFile
+     */
+    std::string CompileNode(const vili::node& data);
+    /**
+     * \brief Get the path of the compiled version of a vili file
+     *        ("Data/Maps/Level.map.vili" becomes "Data/Maps/Level.map.vilc")
+     */
+    std::string GetCompiledPath(const std::string& path);
+    /**
+     * \brief Finds a vili file in the MountablePaths, a compiled version of the
+     *        file is looked up first and found even if the vili file is missing
+     * \param path Path of the vili file
+     * \return Path of the vili file on the disk (next to its compiled version
+     *         when there is one, the vili file may not exist then), an empty
+     *         string if neither of them are found
+     */
+    std::string FindFile(const System::Path& path);
+    /**
+     * \brief Opens the compiled version of a vili file if there is one that is
+     *        valid and not older than the vili file
+     * \param path Path of the vili file on the disk
+     * \return The compiled file or nullptr if the vili file has to be parsed
+     */
+    std::unique_ptr<CompiledFile> OpenCompiledFile(const std::string& path);
+    /**
+     * \brief Loads a vili file from its compiled version when possible and
+     *        parses it otherwise
+     * \param path Path of the vili file on the disk
+     * \param templates Templates used when the vili file is parsed, compiled
+     *        files already have them applied
+     */
+    vili::node LoadFile(
+        const std::string& path, vili::parser::state templates = vili::parser::state {});
+}
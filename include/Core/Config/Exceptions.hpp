@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Exception.hpp>
+
+namespace obe::Config::Exceptions
+{
+    class InvalidCompiledFile : public Exception
+    {
+    public:
+        InvalidCompiledFile(
+            std::string_view path, std::string_view reason, DebugInfo info)
+            : Exception("InvalidCompiledFile", info)
+        {
+            this->error("Compiled file at path '{}' is invalid : {}", path, reason);
+            this->hint("Compile the file again with ObEngineCompiler");
+        }
+    };
+}
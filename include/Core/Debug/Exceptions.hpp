@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Exception.hpp>
+
+namespace obe::Debug::Exceptions
+{
+    class UnknownProfilerFrame : public Exception
+    {
+    public:
+        UnknownProfilerFrame(std::size_t age, std::size_t frameCount, DebugInfo info)
+            : Exception("UnknownProfilerFrame", info)
+        {
+            this->error("Impossible to get the profiled frame {} frames ago", age);
+            this->hint("The Profiler only holds the last {} frames", frameCount);
+        }
+    };
+
+    class UnknownProfilerZone : public Exception
+    {
+    public:
+        UnknownProfilerZone(std::size_t zone, std::size_t zoneCount, DebugInfo info)
+            : Exception("UnknownProfilerZone", info)
+        {
+            this->error("Profiler has no zone with id {}", zone);
+            this->hint("The Profiler only knows {} zones", zoneCount);
+        }
+    };
+
+    class ProfilerTraceWriteError : public Exception
+    {
+    public:
+        ProfilerTraceWriteError(std::string_view path, DebugInfo info)
+            : Exception("ProfilerTraceWriteError", info)
+        {
+            this->error("Impossible to write the profiler trace to '{}'", path);
+        }
+    };
+} // namespace obe::Debug::Exceptions
@@ -0,0 +1,349 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define OBE_PROFILER_USE_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define OBE_PROFILER_USE_TSC
+#endif
+
+namespace obe::Debug
+{
+    using ProfilerZoneId = std::uint32_t;
+
+    /**
+     * \brief A timed zone recorded by the Profiler
+     * \bind{ProfilerZone}
+     */
+    struct ProfilerZone
+    {
+        /**
+         * \brief Identifier of the name of the zone (see Profiler::getZoneName)
+         */
+        ProfilerZoneId id;
+        /**
+         * \brief Amount of zones the zone is nested in
+         */
+        std::uint32_t depth;
+        /**
+         * \brief Start of the zone (in nanoseconds since the Profiler creation)
+         */
+        std::int64_t start;
+        /**
+         * \brief End of the zone (in nanoseconds since the Profiler creation)
+         */
+        std::int64_t end;
+    };
+
+    /**
+     * \brief A value sampled by the Profiler (memory usage, collected bytes...)
+     * \bind{ProfilerCounter}
+     */
+    struct ProfilerCounter
+    {
+        /**
+         * \brief Identifier of the name of the counter (see Profiler::getZoneName)
+         */
+        ProfilerZoneId id;
+        /**
+         * \brief Time of the sample (in nanoseconds since the Profiler creation)
+         */
+        std::int64_t time;
+        double value;
+    };
+
+    /**
+     * \brief All the zones recorded during a frame
+     * \bind{ProfilerFrame}
+     */
+    struct ProfilerFrame
+    {
+        /**
+         * \brief Index of the frame since the Profiler creation
+         */
+        std::uint64_t index = 0;
+        std::int64_t start = 0;
+        std::int64_t end = 0;
+        /**
+         * \brief Zones of the frame, in the order they were entered
+         */
+        std::vector<ProfilerZone> zones;
+        /**
+         * \brief Counter samples of the frame, in the order they were recorded
+         */
+        std::vector<ProfilerCounter> counters;
+    };
+
+    /**
+     * \brief Records nested timed zones in a ring buffer of frames
+     *
+     * The Profiler is disabled by default, a disabled Profiler only costs a
+     * branch per zone. Zones are only recorded between beginFrame and endFrame
+     * and from the thread running the frames.
+     * \bind{Profiler}
+     */
+    class Profiler
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        bool m_enabled = false;
+        // Frame being recorded, nullptr outside of a frame
+        ProfilerFrame* m_frame = nullptr;
+        Clock::time_point m_epoch = Clock::now();
+        std::vector<std::string> m_zoneNames;
+        std::unordered_map<std::string, ProfilerZoneId> m_zoneIds;
+        std::vector<ProfilerFrame> m_frames;
+        std::size_t m_currentFrame = 0;
+        std::size_t m_recordedFrames = 0;
+        std::uint64_t m_frameIndex = 0;
+        std::uint32_t m_depth = 0;
+        std::int64_t m_frameStartTicks = 0;
+
+        [[nodiscard]] std::int64_t now() const;
+        // Zones of the current frame are timed with a cheap tick counter (the
+        // CPU timestamp counter when available), converted to nanoseconds by
+        // endFrame
+        static std::int64_t ticks()
+        {
+#if defined(OBE_PROFILER_USE_TSC)
+            return static_cast<std::int64_t>(__rdtsc());
+#else
+            return Clock::now().time_since_epoch().count();
+#endif
+        }
+        [[nodiscard]] std::vector<const ProfilerFrame*> getRecordedFrames() const;
+
+    public:
+        /**
+         * \brief Value returned by beginZone when nothing is recorded
+         */
+        static constexpr std::size_t NoZone = std::numeric_limits<std::size_t>::max();
+        /**
+         * \brief Amount of frames kept by default
+         */
+        static constexpr std::size_t DefaultFrameCapacity = 120;
+        /**
+         * \brief Creates a new disabled Profiler
+         * \param frameCapacity Amount of frames kept in the ring buffer
+         */
+        explicit Profiler(std::size_t frameCapacity = DefaultFrameCapacity);
+        /**
+         * \brief Enables or disables the recording of frames (disabling it
+         *        drops the frame being recorded)
+         * \param enabled true to record the zones, false otherwise
+         */
+        void setEnabled(bool enabled);
+        [[nodiscard]] bool isEnabled() const;
+        /**
+         * \brief Changes the amount of frames kept (clears the recorded frames)
+         * \param frameCapacity Amount of frames kept in the ring buffer
+         */
+        void setFrameCapacity(std::size_t frameCapacity);
+        [[nodiscard]] std::size_t getFrameCapacity() const;
+        /**
+         * \brief Gets the identifier of a zone name, registering it if needed
+         * \param name Name of the zone
+         * \return The identifier of the zone name
+         */
+        ProfilerZoneId getZoneId(const std::string& name);
+        /**
+         * \brief Gets the name of a zone
+         * \param id Identifier returned by getZoneId
+         * \return The name of the zone
+         */
+        [[nodiscard]] const std::string& getZoneName(ProfilerZoneId id) const;
+        /**
+         * \brief Starts recording a new frame (overwrites the oldest one when
+         *        the ring buffer is full)
+         */
+        void beginFrame();
+        /**
+         * \brief Stops recording the current frame
+         */
+        void endFrame();
+        /**
+         * \brief Enters a zone
+         * \param id Identifier of the name of the zone
+         * \return Index of the zone to give to endZone
+         */
+        std::size_t beginZone(ProfilerZoneId id)
+        {
+            if (!m_frame)
+                return NoZone;
+            m_frame->zones.push_back(ProfilerZone { id, m_depth++, ticks(), 0 });
+            return m_frame->zones.size() - 1;
+        }
+        /**
+         * \brief Leaves a zone
+         * \param zone Index returned by beginZone
+         */
+        void endZone(std::size_t zone)
+        {
+            if (!m_frame || zone >= m_frame->zones.size())
+                return;
+            m_frame->zones[zone].end = ticks();
+            m_depth--;
+        }
+        /**
+         * \brief Records a sample of a counter in the current frame
+         * \param id Identifier of the name of the counter (see getZoneId)
+         * \param value Value of the counter
+         */
+        void setCounter(ProfilerZoneId id, double value)
+        {
+            if (m_frame)
+                m_frame->counters.push_back(ProfilerCounter { id, ticks(), value });
+        }
+        /**
+         * \brief Gets how many complete frames are held by the Profiler
+         */
+        [[nodiscard]] std::size_t getFrameCount() const;
+        /**
+         * \brief Gets a complete frame
+         * \param age 0 for the last complete frame, 1 for the one before...
+         * \return The recorded frame
+         */
+        [[nodiscard]] const ProfilerFrame& getFrame(std::size_t age = 0) const;
+        /**
+         * \brief Gets the duration of a frame
+         * \param age 0 for the last complete frame, 1 for the one before...
+         * \return The duration of the frame in milliseconds
+         */
+        [[nodiscard]] double getFrameDuration(std::size_t age = 0) const;
+        /**
+         * \brief Gets the time spent in all the zones with a given name
+         *        during a frame (nested zones with the same name are only
+         *        counted once)
+         * \param name Name of the zone
+         * \param age 0 for the last complete frame, 1 for the one before...
+         * \return The time spent in the zone in milliseconds
+         */
+        [[nodiscard]] double getZoneDuration(
+            const std::string& name, std::size_t age = 0) const;
+        /**
+         * \brief Gets the average time spent in a zone per frame over all the
+         *        recorded frames
+         * \param name Name of the zone
+         * \return The average time spent in the zone in milliseconds
+         */
+        [[nodiscard]] double getAverageZoneDuration(const std::string& name) const;
+        /**
+         * \brief Gets the last value of a counter during a frame
+         * \param name Name of the counter
+         * \param age 0 for the last complete frame, 1 for the one before...
+         * \return The last sample of the counter, 0 if it was not recorded
+         */
+        [[nodiscard]] double getCounterValue(
+            const std::string& name, std::size_t age = 0) const;
+        /**
+         * \brief Removes all the recorded frames
+         */
+        void clear();
+        /**
+         * \brief Exports the recorded frames in the Chrome trace event format
+         *        (chrome://tracing or https://ui.perfetto.dev)
+         * \return The JSON content of the trace
+         */
+        [[nodiscard]] std::string toChromeTrace() const;
+        /**
+         * \brief Writes the recorded frames to a Chrome trace file
+         * \param path Path of the JSON file to write
+         */
+        void saveChromeTrace(const std::string& path) const;
+    };
+
+    /**
+     * \brief Profiler used by the Engine main loop
+     * \bind{EngineProfiler}
+     */
+    extern Profiler EngineProfiler;
+
+    /**
+     * \nobind
+     * \brief Records a frame of the EngineProfiler until destroyed
+     */
+    class ProfilerFrameGuard
+    {
+    private:
+        Profiler& m_profiler;
+
+    public:
+        explicit ProfilerFrameGuard(Profiler& profiler)
+            : m_profiler(profiler)
+        {
+            m_profiler.beginFrame();
+        }
+        ~ProfilerFrameGuard()
+        {
+            m_profiler.endFrame();
+        }
+        ProfilerFrameGuard(const ProfilerFrameGuard&) = delete;
+        ProfilerFrameGuard& operator=(const ProfilerFrameGuard&) = delete;
+    };
+
+    /**
+     * \nobind
+     * \brief Records a zone until destroyed
+     */
+    class ProfilerZoneGuard
+    {
+    private:
+        Profiler& m_profiler;
+        std::size_t m_zone;
+
+    public:
+        ProfilerZoneGuard(Profiler& profiler, ProfilerZoneId id)
+            : m_profiler(profiler)
+            , m_zone(profiler.beginZone(id))
+        {
+        }
+        ~ProfilerZoneGuard()
+        {
+            if (m_zone != Profiler::NoZone)
+                m_profiler.endZone(m_zone);
+        }
+        ProfilerZoneGuard(const ProfilerZoneGuard&) = delete;
+        ProfilerZoneGuard& operator=(const ProfilerZoneGuard&) = delete;
+    };
+} // namespace obe::Debug
+
+#define OBE_PROFILER_CONCAT_IMPL(a, b) a##b
+#define OBE_PROFILER_CONCAT(a, b) OBE_PROFILER_CONCAT_IMPL(a, b)
+
+// Profiling macros are removed from the build when OBE_ENABLE_PROFILER is
+// not defined (ENABLE_PROFILER CMake option)
+#if defined(OBE_ENABLE_PROFILER)
+#define OBE_PROFILE_FRAME()                                                              \
+    obe::Debug::ProfilerFrameGuard OBE_PROFILER_CONCAT(obeProfilerFrame, __LINE__)(     \
+        obe::Debug::EngineProfiler)
+#define OBE_PROFILE_ZONE(name)                                                           \
+    static const obe::Debug::ProfilerZoneId OBE_PROFILER_CONCAT(                        \
+        obeProfilerZoneId, __LINE__)                                                     \
+        = obe::Debug::EngineProfiler.getZoneId(name);                                    \
+    obe::Debug::ProfilerZoneGuard OBE_PROFILER_CONCAT(obeProfilerZone, __LINE__)(       \
+        obe::Debug::EngineProfiler, OBE_PROFILER_CONCAT(obeProfilerZoneId, __LINE__))
+#define OBE_PROFILE_ZONE_ID(id)                                                          \
+    obe::Debug::ProfilerZoneGuard OBE_PROFILER_CONCAT(obeProfilerZone, __LINE__)(       \
+        obe::Debug::EngineProfiler, id)
+#define OBE_PROFILE_COUNTER(name, value)                                                 \
+    do                                                                                   \
+    {                                                                                    \
+        static const obe::Debug::ProfilerZoneId obeProfilerCounterId                     \
+            = obe::Debug::EngineProfiler.getZoneId(name);                                \
+        obe::Debug::EngineProfiler.setCounter(obeProfilerCounterId, value);              \
+    } while (false)
+#else
+#define OBE_PROFILE_FRAME()
+#define OBE_PROFILE_ZONE(name)
+#define OBE_PROFILE_ZONE_ID(id)
+#define OBE_PROFILE_COUNTER(name, value)
+#endif
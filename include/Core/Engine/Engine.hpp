@@ -4,7 +4,9 @@
 #include <Config/Config.hpp>
 #include <Engine/ResourceManager.hpp>
 #include <Input/InputManager.hpp>
+#include <Jobs/ThreadPool.hpp>
 #include <Scene/Scene.hpp>
+#include <Script/GarbageCollector.hpp>
 #include <System/Cursor.hpp>
 #include <System/Plugin.hpp>
 #include <System/Window.hpp>
@@ -25,6 +27,7 @@ namespace obe::Engine
         bool m_initialized = false;
         std::vector<std::unique_ptr<System::Plugin>> m_plugins;
         std::unique_ptr<sol::state> m_lua;
+        std::unique_ptr<Script::GarbageCollector> m_garbageCollector;
         std::unique_ptr<Scene::Scene> m_scene;
         std::unique_ptr<System::Cursor> m_cursor;
         std::unique_ptr<System::Window> m_window;
@@ -36,9 +39,13 @@ namespace obe::Engine
         std::unique_ptr<Input::InputManager> m_input {};
         std::unique_ptr<Time::FramerateManager> m_framerate;
         std::unique_ptr<Triggers::TriggerManager> m_triggers;
+        std::unique_ptr<Jobs::ThreadPool> m_threadPool;
 
         // TriggerGroups
         Triggers::TriggerGroupPtr t_game {};
+        Triggers::TriggerHandle m_updateTrigger = 0;
+        Triggers::TriggerHandle m_renderTrigger = 0;
+        std::size_t m_updateDtArgument = 0;
 
         // Initialization
         void initConfig();
@@ -48,6 +55,7 @@ namespace obe::Engine
         void initInput();
         void initFramerate();
         void initResources();
+        void initJobs();
         void initWindow();
         void initCursor();
         void initPlugins();
@@ -55,6 +63,7 @@ namespace obe::Engine
 
         // Main loop
         void handleWindowEvents() const;
+        void step() const;
         void update() const;
         void render();
 
@@ -115,5 +124,15 @@ namespace obe::Engine
          * \asproperty
          */
         System::Window& getWindow() const;
+        /**
+         * \bind{GarbageCollector}
+         * \asproperty
+         */
+        Script::GarbageCollector& getGarbageCollector() const;
+        /**
+         * \nobind
+         * \brief Gets the ThreadPool running the jobs of the Engine
+         */
+        Jobs::ThreadPool& getThreadPool() const;
     };
 }
\ No newline at end of file
@@ -2,11 +2,14 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
 
 #include <Graphics/Font.hpp>
 #include <Graphics/Texture.hpp>
+#include <Graphics/TextureAtlas.hpp>
 #include <Triggers/TriggerGroup.hpp>
 
 namespace obe::Engine
@@ -23,6 +26,19 @@ namespace obe::Engine
         Triggers::TriggerGroupPtr t_resources;
         ResourceStore<std::shared_ptr<Graphics::Font>> m_fonts;
         ResourceStore<TexturePair> m_textures;
+        ResourceStore<std::unique_ptr<sf::Image>> m_preloadedImages;
+        std::pair<std::unique_ptr<Graphics::TextureAtlas>,
+            std::unique_ptr<Graphics::TextureAtlas>>
+            m_atlases;
+        // Textures packed in each page of the atlases (path and anti-aliasing)
+        std::unordered_map<const sf::Texture*,
+            std::vector<std::pair<std::string, bool>>>
+            m_packedTextures;
+        unsigned int m_atlasThreshold = 0;
+        unsigned int m_atlasPageSize = 2048;
+
+        std::unique_ptr<Graphics::Texture> loadTexture(
+            const std::string& path, bool antiAliasing);
 
     public:
         bool defaultAntiAliasing;
@@ -39,7 +55,39 @@ namespace obe::Engine
          */
         const Graphics::Texture& getTexture(const std::string& path, bool antiAliasing);
         const Graphics::Texture& getTexture(const std::string& path);
-
+        /**
+         * \nobind
+         * \brief Gives the image of a texture decoded beforehand (on another
+         *        thread for instance), it is used instead of reading the file
+         *        when the texture is first loaded
+         * \param path Path of the texture, as given to getTexture
+         * \param image Decoded image of the texture
+         */
+        void preloadImage(const std::string& path, std::unique_ptr<sf::Image> image);
+        /**
+         * \brief Packs the small textures loaded afterwards in shared pages so
+         *        the Sprites using them can be batched together
+         * \param threshold Maximum width and height (in pixels) of the textures
+         *        to pack
+         * \param pageSize Width and height (in pixels) of the shared pages
+         */
+        void enableTextureAtlas(
+            unsigned int threshold = 256, unsigned int pageSize = 2048);
+        /**
+         * \brief Stops packing the textures loaded afterwards (textures already
+         *        packed stay in their page)
+         */
+        void disableTextureAtlas();
+        /**
+         * \brief Checks if the small textures are packed in shared pages
+         * \return true if the texture atlas is enabled, false otherwise
+         */
+        [[nodiscard]] bool isTextureAtlasEnabled() const;
+        /**
+         * \brief Frees the cached textures that are not used anymore, packed
+         *        textures are freed along with their page once none of the
+         *        textures of the page is used anymore
+         */
         void clean();
     };
 
@@ -98,4 +98,17 @@ namespace obe::Graphics::Exceptions
                 type, value);
         }
     };
+
+    class SpriteBatchRunIndexOverflow : public Exception
+    {
+    public:
+        SpriteBatchRunIndexOverflow(
+            std::size_t index, std::size_t maximum, DebugInfo info)
+            : Exception("SpriteBatchRunIndexOverflow", info)
+        {
+            this->error("Tried to access run at index {} of a SpriteBatch when it only "
+                        "contains {} runs",
+                index, maximum);
+        }
+    };
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <map>
+#include <optional>
 
 #include <Transform/UnitVector.hpp>
 
@@ -33,6 +34,55 @@ namespace obe::Graphics
      */
     extern CoordinateTransformer Position;
 
+    /**
+     * \brief Built-in CoordinateTransformers, applied without going through a
+     *        std::function (Custom is used for the other CoordinateTransformers)
+     * \nobind
+     */
+    enum class TransformerKernel
+    {
+        Camera,
+        Position,
+        Parallax,
+        Custom
+    };
+
+    /**
+     * \brief Gets the TransformerKernel of a CoordinateTransformer
+     * \param transformer Name of the CoordinateTransformer
+     * \return The TransformerKernel, Custom if it is not a built-in one or if
+     *         its entry in Transformers was replaced
+     * \nobind
+     */
+    TransformerKernel getTransformerKernel(const std::string& transformer);
+
+    /**
+     * \brief Affine form of a PositionTransformer for a given Camera and layer,
+     *        maps a SceneUnits position to a transformed ScenePixels position
+     * \nobind
+     */
+    struct AffineTransform
+    {
+        double scaleX = 1;
+        double scaleY = 1;
+        double offsetX = 0;
+        double offsetY = 0;
+
+        /**
+         * \brief Transforms a batch of positions, the coordinates are stored
+         *        in separate arrays so the loop can be vectorized
+         * \param x x Coordinates of the positions (SceneUnits)
+         * \param y y Coordinates of the positions (SceneUnits)
+         * \param transformedX Where to write the transformed x Coordinates
+         *        (ScenePixels)
+         * \param transformedY Where to write the transformed y Coordinates
+         *        (ScenePixels)
+         * \param count Amount of positions
+         */
+        void apply(const double* x, const double* y, float* transformedX,
+            float* transformedY, std::size_t count) const;
+    };
+
     /**
      * \brief A PositionTransformer tells how a Coordinate should be transformed
      * depending of multiple parameters
@@ -45,6 +95,8 @@ namespace obe::Graphics
         std::string m_xTransformerName = "Camera";
         CoordinateTransformer m_yTransformer;
         std::string m_yTransformerName = "Camera";
+        TransformerKernel m_xKernel = TransformerKernel::Camera;
+        TransformerKernel m_yKernel = TransformerKernel::Camera;
 
     public:
         /**
@@ -64,7 +116,13 @@ namespace obe::Graphics
          * \brief Gets the CoordinateTransformer of x Coordinate
          * \return The CoordinateTransformer of x Coordinate
          */
-        CoordinateTransformer& getXTransformer();
+        [[nodiscard]] const CoordinateTransformer& getXTransformer() const;
+        /**
+         * \brief Replaces the CoordinateTransformer of x Coordinate (the
+         *        built-in kernel is not used anymore)
+         * \param transformer The new CoordinateTransformer of x Coordinate
+         */
+        void setXTransformer(CoordinateTransformer transformer);
         /**
          * \brief Gets the name of the CoordinateTransformer of x Coordinate
          * \return The name of the CoordinateTransformer of x Coordinate in a
@@ -75,12 +133,28 @@ namespace obe::Graphics
          * \brief Gets the CoordinateTransformer of y Coordinate
          * \return The CoordinateTransformer of y Coordinate
          */
-        CoordinateTransformer& getYTransformer();
+        [[nodiscard]] const CoordinateTransformer& getYTransformer() const;
+        /**
+         * \brief Replaces the CoordinateTransformer of y Coordinate (the
+         *        built-in kernel is not used anymore)
+         * \param transformer The new CoordinateTransformer of y Coordinate
+         */
+        void setYTransformer(CoordinateTransformer transformer);
         /**
          * \brief Gets the name of the CoordinateTransformer of y Coordinate
          * \return The name of the CoordinateTransformer of y Coordinate
          */
         [[nodiscard]] std::string getYTransformerName() const;
+        /**
+         * \nobind
+         * \brief Gets the TransformerKernel used for the x Coordinate
+         */
+        [[nodiscard]] TransformerKernel getXKernel() const;
+        /**
+         * \nobind
+         * \brief Gets the TransformerKernel used for the y Coordinate
+         */
+        [[nodiscard]] TransformerKernel getYKernel() const;
         /**
          * \brief Method used by the Sprite to get the Position once
          *        transformed
@@ -91,5 +165,40 @@ namespace obe::Graphics
          */
         Transform::UnitVector operator()(const Transform::UnitVector& position,
             const Transform::UnitVector& camera, int layer) const;
+        /**
+         * \nobind
+         * \brief Gets the transformation as a single affine step, only
+         *        possible when both CoordinateTransformers are built-in ones
+         * \param camera Position of the Camera
+         * \param layer Layer of the elements to transform
+         * \return The AffineTransform or std::nullopt if the operator() has
+         *         to be used
+         */
+        [[nodiscard]] std::optional<AffineTransform> getAffineTransform(
+            const Transform::UnitVector& camera, int layer) const;
+        /**
+         * \nobind
+         * \brief Transforms a batch of positions of elements on the same
+         *        layer, in a single loop when both CoordinateTransformers are
+         *        built-in ones
+         * \param x x Coordinates of the positions (SceneUnits)
+         * \param y y Coordinates of the positions (SceneUnits)
+         * \param transformedX Where to write the transformed x Coordinates
+         *        (ScenePixels)
+         * \param transformedY Where to write the transformed y Coordinates
+         *        (ScenePixels)
+         * \param count Amount of positions
+         * \param camera Position of the Camera
+         * \param layer Layer of the elements
+         */
+        void transform(const double* x, const double* y, float* transformedX,
+            float* transformedY, std::size_t count, const Transform::UnitVector& camera,
+            int layer) const;
+        /**
+         * \nobind
+         * \brief Checks if two PositionTransformers use the same built-in
+         *        kernels (and can be applied with the same AffineTransform)
+         */
+        [[nodiscard]] bool hasSameKernels(const PositionTransformer& other) const;
     };
 } // namespace obe::Graphics
\ No newline at end of file
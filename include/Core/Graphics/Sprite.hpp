@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include <sfe/ComplexSprite.hpp>
 
 #include <Component/Component.hpp>
@@ -7,6 +9,8 @@
 #include <Graphics/Color.hpp>
 #include <Graphics/PositionTransformers.hpp>
 #include <Graphics/Shader.hpp>
+#include <Graphics/SpriteBatch.hpp>
+#include <Graphics/SpriteIndex.hpp>
 #include <Transform/Rect.hpp>
 #include <Transform/Referential.hpp>
 #include <Transform/UnitBasedObject.hpp>
@@ -97,6 +101,7 @@ namespace obe::Graphics
                    public Engine::ResourceManagedObject
     {
     private:
+        friend class SpriteBatch;
         std::vector<SpriteHandlePoint> m_handlePoints {};
         int m_layer = 1;
         std::string m_parentId = "";
@@ -108,8 +113,32 @@ namespace obe::Graphics
         bool m_visible = true;
         int m_zdepth = 0;
         bool m_antiAliasing = true;
+        SpriteIndex* m_spriteIndex = nullptr;
+        Collision::ProxyId m_indexProxy = Collision::NullProxy;
+        bool m_indexUpdateDeferred = false;
+        Transform::UnitVector m_previousPosition;
+        bool m_hasPreviousPosition = false;
+        // SceneUnits corners (TopLeft, BottomLeft, TopRight, BottomRight)
+        // computed again only when the Rect changes
+        mutable std::array<Transform::UnitVector, 4> m_corners;
+        mutable bool m_cornersDirty = true;
 
+        /**
+         * \brief Gets the cached corners of the Sprite
+         */
+        const std::array<Transform::UnitVector, 4>& getCorners() const;
+        /**
+         * \brief Writes the 4 corners moved towards the previous Position
+         */
+        void getInterpolatedCorners(double interpolation, double* x, double* y) const;
+        /**
+         * \brief Uses the 4 transformed corners (ScenePixels) as vertices
+         */
+        void setTransformedCorners(const float* x, const float* y);
         void resetUnit(Transform::Units unit) override;
+        void updateVertices(const Transform::UnitVector& camera, double interpolation);
+        void onRectChanged() override;
+        void onCullingGroupChanged();
 
     public:
         /**
@@ -122,6 +151,7 @@ namespace obe::Graphics
          * \param id A std::string containing the Id of the Sprite
          */
         explicit Sprite(const std::string& id);
+        ~Sprite() override;
         /**
          * \brief Draws the handle used to scale the Sprite
          * \param surface RenderSurface where to render the handle
@@ -289,6 +319,14 @@ namespace obe::Graphics
          * \param texture Texture to set
          */
         void setTexture(const Texture& texture);
+        /**
+         * \brief Sets the area of the Texture displayed by the Sprite
+         * \param x x Coordinate of the area (relative to the Texture sub-rect
+         *        when it is packed in an atlas)
+         * \param y y Coordinate of the area
+         * \param width Width of the area
+         * \param height Height of the area
+         */
         void setTextureRect(
             unsigned int x, unsigned int y, unsigned int width, unsigned int height);
         /**
@@ -316,7 +354,57 @@ namespace obe::Graphics
          */
         void useTextureSize();
 
-        void draw(RenderTarget surface, const Transform::UnitVector& camera);
+        /**
+         * \brief Draws the Sprite
+         * \param surface RenderSurface where to draw the Sprite
+         * \param camera Position of the Camera in ScenePixels
+         * \param interpolation Where to draw the Sprite between its previous
+         *        and current Position (see storePreviousPosition)
+         */
+        void draw(RenderTarget surface, const Transform::UnitVector& camera,
+            double interpolation = 1.0);
+        /**
+         * \brief Appends the Sprite to a SpriteBatch instead of drawing it
+         *        directly (the handle is not drawn)
+         * \param batch SpriteBatch where to add the Sprite
+         * \param camera Position of the Camera in ScenePixels
+         * \param interpolation Where to draw the Sprite between its previous
+         *        and current Position (see storePreviousPosition)
+         */
+        void addToBatch(SpriteBatch& batch, const Transform::UnitVector& camera,
+            double interpolation = 1.0);
+        /**
+         * \brief Saves the current Position as the one of the previous
+         *        simulation step, the Sprite can then be drawn anywhere between
+         *        both Positions (only its Position is interpolated)
+         */
+        void storePreviousPosition();
+        /**
+         * \nobind
+         * \brief Registers the Sprite in a SpriteIndex used to cull the
+         *        Sprites outside of the camera (the Sprite is removed from
+         *        the previous one)
+         * \param index SpriteIndex where to register the Sprite (nullptr to
+         *        only unregister it)
+         */
+        void attachSpriteIndex(SpriteIndex* index);
+        /**
+         * \nobind
+         * \brief Gets the proxy of the Sprite in its SpriteIndex
+         * \return The proxy of the Sprite or NullProxy if it is not indexed
+         */
+        [[nodiscard]] Collision::ProxyId getSpriteIndexProxy() const;
+        /**
+         * \nobind
+         * \brief Updates the SpriteIndex if the bounds of the Sprite changed
+         *        while its updates were deferred (see SpriteIndex::setDeferUpdates)
+         */
+        void applyDeferredIndexUpdate();
+        /**
+         * \brief Gets the axis-aligned bounding box of the Sprite
+         * \return The bounds of the Sprite (in SceneUnits)
+         */
+        [[nodiscard]] Collision::AABB getBounds() const;
         void attachResourceManager(Engine::ResourceManager& resources) override;
         [[nodiscard]] std::string_view type() const override;
     };
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <Graphics/RenderTarget.hpp>
+#include <Graphics/Shader.hpp>
+#include <Transform/UnitVector.hpp>
+
+namespace obe::Graphics
+{
+    class Sprite;
+
+    /**
+     * \brief Vertices of consecutive Sprites sharing the same Texture and
+     *        Shader, drawn with a single draw call
+     * \bind{SpriteBatchRun}
+     */
+    class SpriteBatchRun
+    {
+    public:
+        /**
+         * \nobind
+         */
+        const sf::Texture* texture = nullptr;
+        /**
+         * \nobind
+         */
+        Shader* shader = nullptr;
+        /**
+         * \nobind
+         */
+        sf::VertexArray vertices = sf::VertexArray(sf::Triangles);
+        /**
+         * \brief Amount of Sprites merged in the run
+         */
+        std::size_t spriteCount = 0;
+    };
+
+    /**
+     * \brief Groups consecutive Sprites sharing the same Texture and Shader to
+     *        reduce the amount of draw calls (Sprites order is kept)
+     * \bind{SpriteBatch}
+     */
+    class SpriteBatch
+    {
+    private:
+        // Runs are kept between frames to reuse the memory of their vertices
+        std::vector<SpriteBatchRun> m_runs;
+        std::size_t m_runCount = 0;
+        std::size_t m_vertexCount = 0;
+        std::size_t m_spriteCount = 0;
+        // Sprites given to addSprites sharing a transformation, flushed while
+        // they are still in cache
+        static constexpr std::size_t MaxStagedSprites = 256;
+        std::vector<Sprite*> m_stagedSprites;
+        std::vector<double> m_cornersX;
+        std::vector<double> m_cornersY;
+        std::vector<float> m_transformedX;
+        std::vector<float> m_transformedY;
+
+        /**
+         * \brief Transforms the corners of the staged Sprites and adds them
+         */
+        void flushStagedSprites(const Transform::UnitVector& camera);
+
+    public:
+        /**
+         * \brief Removes all the Sprites of the batch (to call once per frame)
+         */
+        void clear();
+        /**
+         * \nobind
+         * \brief Adds a Sprite quad at the end of the batch
+         * \param quad The 4 vertices of the Sprite (TopLeft, BottomLeft,
+         *        TopRight, BottomRight) in ScenePixels
+         * \param texture Texture used by the Sprite
+         * \param shader Shader used by the Sprite (nullptr if none)
+         */
+        void add(const std::array<sf::Vertex, 4>& quad, const sf::Texture* texture,
+            Shader* shader);
+        /**
+         * \nobind
+         * \brief Adds the visible Sprites at the end of the batch, the corners
+         *        of consecutive Sprites sharing a layer and PositionTransformer
+         *        kernels are transformed together in a single loop
+         * \param sprites Sprites to add (in drawing order)
+         * \param camera Position of the Camera in ScenePixels
+         * \param interpolation Where to draw the Sprites between their
+         *        previous and current Position
+         */
+        void addSprites(const std::vector<Sprite*>& sprites,
+            const Transform::UnitVector& camera, double interpolation = 1.0);
+        /**
+         * \brief Draws all the runs of the batch
+         * \param surface RenderTarget where to draw the batch
+         */
+        void draw(RenderTarget surface) const;
+        /**
+         * \brief Gets a run of the batch
+         * \param index Index of the run (in drawing order)
+         * \return A reference to the run
+         * \throws obe::Graphics::Exceptions::SpriteBatchRunIndexOverflow if
+         *         there is no run at this index
+         */
+        [[nodiscard]] const SpriteBatchRun& getRun(std::size_t index) const;
+        /**
+         * \brief Gets the amount of draw calls needed to draw the batch
+         * \return The amount of runs in the batch
+         */
+        [[nodiscard]] std::size_t getDrawCallCount() const;
+        /**
+         * \brief Gets the amount of vertices in the batch
+         * \return The amount of vertices of all runs
+         */
+        [[nodiscard]] std::size_t getVertexCount() const;
+        /**
+         * \brief Gets the amount of Sprites in the batch
+         * \return The amount of Sprites added since the last clear
+         */
+        [[nodiscard]] std::size_t getSpriteCount() const;
+    };
+} // namespace obe::Graphics
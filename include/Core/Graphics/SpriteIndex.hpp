@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <Collision/BroadPhase.hpp>
+#include <Graphics/PositionTransformers.hpp>
+#include <Transform/UnitVector.hpp>
+
+namespace obe::Graphics
+{
+    class Sprite;
+
+    /**
+     * \nobind
+     * \brief Sparse uniform grid indexing the bounds of Sprites (in SceneUnits)
+     *        so only the Sprites around the camera are drawn
+     *
+     * Sprites are grouped by PositionTransformer and layer as each group sees
+     * the camera at a different place (parallax). Sprites using a custom
+     * CoordinateTransformer or a translation origin can not be culled and are
+     * always returned by queries.
+     */
+    class SpriteIndex
+    {
+    private:
+        struct Group
+        {
+            TransformerKernel x;
+            TransformerKernel y;
+            int layer;
+            std::size_t size = 0;
+        };
+        struct CellRange
+        {
+            std::int64_t minX = 0;
+            std::int64_t minY = 0;
+            std::int64_t maxX = -1;
+            std::int64_t maxY = -1;
+            bool operator==(const CellRange& other) const;
+            [[nodiscard]] std::size_t getCellCount() const;
+        };
+        struct Proxy
+        {
+            Sprite* sprite = nullptr;
+            Collision::AABB bounds;
+            CellRange cells;
+            // Index of the Group, -1 when the Sprite can not be culled
+            int group = -1;
+            bool large = false;
+            std::size_t drawOrder = 0;
+            Collision::ProxyId nextFree = Collision::NullProxy;
+        };
+
+        double m_cellSize;
+        std::vector<Proxy> m_proxies;
+        std::vector<Group> m_groups;
+        Collision::ProxyId m_freeList = Collision::NullProxy;
+        std::size_t m_proxyCount = 0;
+        std::unordered_map<std::uint64_t, std::vector<Collision::ProxyId>> m_cells;
+        // Sprites covering too many cells and Sprites that can not be culled
+        std::vector<Collision::ProxyId> m_largeProxies;
+        std::vector<Collision::ProxyId> m_uncullableProxies;
+        mutable std::vector<unsigned int> m_queryStamps;
+        mutable unsigned int m_currentStamp = 0;
+        mutable std::vector<Collision::ProxyId> m_found;
+        bool m_deferUpdates = false;
+
+        [[nodiscard]] CellRange getCellRange(const Collision::AABB& bounds) const;
+        static std::uint64_t getCellKey(std::int64_t x, std::int64_t y);
+        void link(Collision::ProxyId proxy);
+        void unlink(Collision::ProxyId proxy);
+        [[nodiscard]] int findGroup(Sprite& sprite);
+        [[nodiscard]] Collision::AABB getVisibleArea(const Group& group,
+            const Transform::UnitVector& camera,
+            const Transform::UnitVector& viewSize) const;
+
+    public:
+        /**
+         * \brief Default size of a cell (in SceneUnits)
+         */
+        static constexpr double DefaultCellSize = 0.5;
+        /**
+         * \brief Sprites covering more cells are not stored in the grid
+         */
+        static constexpr std::size_t MaxCellsPerSprite = 64;
+        /**
+         * \brief Creates an empty SpriteIndex
+         * \param cellSize Size of a cell (in SceneUnits)
+         */
+        explicit SpriteIndex(double cellSize = DefaultCellSize);
+        /**
+         * \brief Adds a Sprite to the index
+         * \param sprite Sprite to index
+         * \return Identifier of the created proxy
+         */
+        Collision::ProxyId insert(Sprite& sprite);
+        /**
+         * \brief Updates the bounds of an indexed Sprite (after it moved)
+         * \param proxy Proxy returned by insert
+         */
+        void update(Collision::ProxyId proxy);
+        /**
+         * \brief Moves an indexed Sprite to the group matching its current
+         *        layer and PositionTransformer
+         * \param proxy Proxy returned by insert
+         */
+        void regroup(Collision::ProxyId proxy);
+        /**
+         * \brief Removes a Sprite from the index
+         * \param proxy Proxy returned by insert
+         */
+        void remove(Collision::ProxyId proxy);
+        /**
+         * \brief Sets the position of a Sprite in the drawing order
+         * \param proxy Proxy returned by insert
+         * \param drawOrder Index of the Sprite in the sorted Sprites of the Scene
+         */
+        void setDrawOrder(Collision::ProxyId proxy, std::size_t drawOrder);
+        /**
+         * \brief Finds all the Sprites which may be seen by the camera
+         * \param camera Position of the camera
+         * \param viewSize Size of the area seen by the camera
+         * \param result Vector where the found Sprites are appended, sorted
+         *        by drawing order
+         */
+        void query(const Transform::UnitVector& camera,
+            const Transform::UnitVector& viewSize, std::vector<Sprite*>& result) const;
+        /**
+         * \brief While updates are deferred, Sprites whose bounds change do not
+         *        update the index but flag themselves and update it on
+         *        Sprite::applyDeferredIndexUpdate, so Sprites indexed together
+         *        can be modified from several threads
+         * \param defer Whether updates are deferred
+         */
+        void setDeferUpdates(bool defer);
+        [[nodiscard]] bool isDeferringUpdates() const;
+        /**
+         * \brief Gets how many Sprites are indexed
+         */
+        [[nodiscard]] std::size_t size() const;
+    };
+} // namespace obe::Graphics
@@ -1,6 +1,8 @@
 #pragma once
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <variant>
 
 #include <Transform/Rect.hpp>
@@ -14,10 +16,24 @@ namespace obe::Graphics
     private:
         std::variant<sf::Texture, std::shared_ptr<sf::Texture>, const sf::Texture*>
             m_texture;
+        std::optional<sf::IntRect> m_subRect;
+        /**
+         * \brief Throws a ReadOnlyTexture exception if the Texture has been
+         *        packed in a TextureAtlas
+         * \param method Name of the method that would modify the Texture
+         */
+        void checkNotPacked(std::string_view method) const;
 
     public:
         Texture();
         Texture(std::shared_ptr<sf::Texture> texture);
+        /**
+         * \brief Creates a Texture using only a part of a shared texture
+         *        (used by the TextureAtlas pages)
+         * \param texture Texture containing the sub-texture
+         * \param subRect Area of the sub-texture in pixels
+         */
+        Texture(std::shared_ptr<sf::Texture> texture, const sf::IntRect& subRect);
         Texture(const sf::Texture& texture);
         Texture(const Texture& copy);
         ~Texture();
@@ -28,6 +44,17 @@ namespace obe::Graphics
         bool loadFromImage(const sf::Image& image);
 
         [[nodiscard]] Transform::UnitVector getSize() const;
+        /**
+         * \brief Checks if the Texture only uses a part of its underlying texture
+         * \return true if the Texture has been packed in a TextureAtlas
+         */
+        [[nodiscard]] bool hasSubRect() const;
+        /**
+         * \brief Gets the area of the underlying texture used by the Texture
+         * \return The sub-rect of the Texture or the whole texture area if it
+         *         has no sub-rect
+         */
+        [[nodiscard]] sf::IntRect getSubRect() const;
 
         void setAntiAliasing(bool antiAliasing);
         [[nodiscard]] bool isAntiAliased() const;
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <Graphics/Texture.hpp>
+
+namespace obe::Graphics
+{
+    /**
+     * \nobind
+     * \brief Packs rectangles in a fixed size area using the skyline
+     *        bottom-left heuristic
+     */
+    class SkylinePacker
+    {
+    private:
+        struct Segment
+        {
+            int x;
+            int y;
+            int width;
+        };
+        int m_width;
+        int m_height;
+        std::size_t m_usedArea = 0;
+        std::vector<Segment> m_skyline;
+
+        [[nodiscard]] std::optional<int> fit(
+            std::size_t index, int width, int height) const;
+        void addSegment(std::size_t index, const sf::IntRect& rect);
+
+    public:
+        /**
+         * \brief Creates a new empty SkylinePacker
+         * \param width Width of the area where rectangles are packed
+         * \param height Height of the area where rectangles are packed
+         */
+        SkylinePacker(int width, int height);
+        /**
+         * \brief Finds a free place for a rectangle and reserves it
+         * \param width Width of the rectangle to pack
+         * \param height Height of the rectangle to pack
+         * \return The area reserved for the rectangle if there was enough
+         *         space left, std::nullopt otherwise
+         */
+        std::optional<sf::IntRect> insert(int width, int height);
+        /**
+         * \brief Frees all the packed rectangles
+         */
+        void clear();
+        /**
+         * \brief Gets the ratio of the area used by packed rectangles
+         * \return A value between 0 (empty) and 1 (full)
+         */
+        [[nodiscard]] double getOccupancy() const;
+    };
+
+    /**
+     * \nobind
+     * \brief Shared texture pages in which small images are packed so the
+     *        Sprites using them can be drawn with the same draw call
+     */
+    class TextureAtlas
+    {
+    private:
+        struct Page
+        {
+            std::shared_ptr<sf::Texture> texture;
+            SkylinePacker packer;
+        };
+        unsigned int m_pageSize;
+        unsigned int m_padding;
+        bool m_antiAliasing;
+        std::vector<Page> m_pages;
+
+    public:
+        /**
+         * \brief Creates a new empty TextureAtlas
+         * \param pageSize Width and height of each page in pixels
+         * \param antiAliasing Uses Anti-Aliasing for the pages
+         * \param padding Empty pixels kept around each image to avoid
+         *        sampling its neighbours
+         */
+        explicit TextureAtlas(unsigned int pageSize = 2048, bool antiAliasing = false,
+            unsigned int padding = 1);
+        /**
+         * \brief Packs an image in one of the pages (a new page is created if
+         *        none has enough space left)
+         * \param image Image to pack
+         * \return A Texture using the area of the page where the image has been
+         *         packed or std::nullopt if the image does not fit in a page
+         */
+        std::optional<Texture> insert(const sf::Image& image);
+        /**
+         * \brief Removes a page from the TextureAtlas, it is freed once the
+         *        Textures packed in it are destroyed
+         * \param page Texture of the page (as given by the packed Textures)
+         * \return true if the page belonged to the TextureAtlas, false otherwise
+         */
+        bool removePage(const sf::Texture& page);
+        /**
+         * \brief Gets the amount of pages created by the TextureAtlas
+         * \return The amount of pages
+         */
+        [[nodiscard]] std::size_t getPageCount() const;
+        /**
+         * \brief Gets the ratio of the pages area used by packed images
+         * \return A value between 0 (empty) and 1 (full)
+         */
+        [[nodiscard]] double getOccupancy() const;
+    };
+} // namespace obe::Graphics
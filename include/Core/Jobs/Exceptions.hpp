@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Exception.hpp>
+
+namespace obe::Jobs::Exceptions
+{
+    class UnknownTask : public Exception
+    {
+    public:
+        UnknownTask(std::size_t task, std::size_t tasksAmount, DebugInfo info)
+            : Exception("UnknownTask", info)
+        {
+            this->error("TaskGraph has no task with id {}", task);
+            this->hint("The TaskGraph contains {} tasks (ids from 0 to {})", tasksAmount,
+                tasksAmount - 1);
+        }
+    };
+
+    class CyclicTaskGraph : public Exception
+    {
+    public:
+        CyclicTaskGraph(std::size_t tasksAmount, std::size_t blockedTasks, DebugInfo info)
+            : Exception("CyclicTaskGraph", info)
+        {
+            this->error(
+                "TaskGraph can not run as {} of its {} tasks depend on each other",
+                blockedTasks, tasksAmount);
+            this->hint("Remove the dependency cycle between the tasks");
+        }
+    };
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+
+#include <Jobs/ThreadPool.hpp>
+
+namespace obe::Jobs
+{
+    /**
+     * \brief A set of tasks with dependencies between them, each task is
+     *        started on a ThreadPool as soon as the tasks it depends on are
+     *        done
+     *
+     * A TaskGraph can be run several times, the tasks and dependencies are
+     * kept between runs.
+     * \nobind
+     */
+    class TaskGraph
+    {
+    public:
+        using TaskId = std::size_t;
+
+    private:
+        struct Node
+        {
+            Task task;
+            std::vector<TaskId> successors;
+            std::size_t dependencies = 0;
+        };
+        std::vector<Node> m_nodes;
+
+        void checkTask(TaskId task) const;
+        void checkAcyclic() const;
+
+    public:
+        /**
+         * \brief Adds a task to the graph
+         * \param task Task to execute
+         * \return The id of the task in the graph
+         */
+        TaskId add(Task task);
+        /**
+         * \brief Makes a task wait for another one
+         * \param task Task to execute first
+         * \param successor Task executed once task is done
+         * \throw UnknownTask if one of the ids is not a task of the graph
+         */
+        void precede(TaskId task, TaskId successor);
+        /**
+         * \brief Executes all the tasks and waits for them, the calling
+         *        thread executes queued tasks of the ThreadPool while waiting
+         * \param pool ThreadPool executing the tasks
+         * \throw CyclicTaskGraph if some tasks depend on each other
+         * \throw The first exception thrown by a task, the tasks not started
+         *        yet are then skipped
+         */
+        void run(ThreadPool& pool) const;
+        /**
+         * \brief Gets the amount of tasks in the graph
+         */
+        [[nodiscard]] std::size_t size() const;
+        /**
+         * \brief Removes all the tasks from the graph
+         */
+        void clear();
+    };
+} // namespace obe::Jobs
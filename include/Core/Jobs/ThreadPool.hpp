@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace obe::Jobs
+{
+    using Task = std::function<void()>;
+    /**
+     * \brief Body of a parallel loop, called with the [begin, end) range of
+     *        indexes to process
+     */
+    using RangeTask = std::function<void(std::size_t, std::size_t)>;
+
+    /**
+     * \brief A pool of worker threads executing tasks, each worker has its own
+     *        queue and steals tasks from the other queues when it is empty
+     * \nobind
+     */
+    class ThreadPool
+    {
+    private:
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue>> m_queues;
+        std::vector<std::thread> m_workers;
+        /**
+         * \brief Amount of tasks waiting in the queues (briefly negative when
+         *        a task is taken before being counted)
+         */
+        std::atomic<std::ptrdiff_t> m_pending = 0;
+        std::atomic<std::size_t> m_nextQueue = 0;
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeUp;
+        bool m_stopping = false;
+        std::mutex m_mainThreadMutex;
+        std::vector<Task> m_mainThreadTasks;
+
+        [[nodiscard]] bool pop(std::size_t worker, Task& task);
+        void work(std::size_t worker);
+
+    public:
+        /**
+         * \brief Amount of workers leaving one hardware thread to the main
+         *        thread (which takes part in parallelFor)
+         */
+        [[nodiscard]] static std::size_t getDefaultWorkerCount();
+        /**
+         * \brief Starts the worker threads
+         * \param workers Amount of worker threads, no thread is started with 0
+         *        and the tasks are then executed by the caller
+         */
+        explicit ThreadPool(std::size_t workers = getDefaultWorkerCount());
+        /**
+         * \brief Executes the remaining tasks then joins the worker threads
+         */
+        ~ThreadPool();
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        /**
+         * \brief Queues a task, a task submitted from a worker goes to the
+         *        queue of that worker
+         * \param task Task to execute, exceptions escaping it are logged
+         */
+        void submit(Task task);
+        /**
+         * \brief Runs a loop over [0, count) split in chunks shared between
+         *        the workers and the calling thread, returns once every chunk
+         *        is done
+         * \param count Amount of indexes
+         * \param grain Amount of indexes processed by a chunk
+         * \param body Function called for each chunk
+         * \throw The first exception thrown by a chunk, the chunks not
+         *        started yet are then skipped
+         */
+        void parallelFor(std::size_t count, std::size_t grain, const RangeTask& body);
+        /**
+         * \brief Calls a function on each element of a contiguous container
+         *        (std::vector, std::array...) in parallel (see parallelFor)
+         * \param elements Container of the elements
+         * \param grain Amount of elements processed by a chunk
+         * \param func Function called with a reference to each element
+         */
+        template <class Container, class Func>
+        void parallelForEach(Container& elements, std::size_t grain, Func&& func);
+        /**
+         * \brief Executes one of the queued tasks on the calling thread, used
+         *        to help the workers while waiting for tasks
+         * \return true if a task was executed, false if none was queued
+         */
+        bool runPendingTask();
+        /**
+         * \brief Queues a task executed by the main thread on its next call to
+         *        runMainThreadTasks (once per frame by the Engine), used to
+         *        continue the work of a task with things that are not thread
+         *        safe (Lua, Scene, Triggers...)
+         * \param task Task to execute
+         */
+        void postToMainThread(Task task);
+        /**
+         * \brief Executes the tasks posted to the main thread, the tasks they
+         *        post are executed on the next call
+         * \return The amount of executed tasks
+         */
+        std::size_t runMainThreadTasks();
+        [[nodiscard]] std::size_t getWorkerCount() const;
+        /**
+         * \brief Checks if the calling thread is one of the workers of the pool
+         */
+        [[nodiscard]] bool isWorkerThread() const;
+    };
+
+    template <class Container, class Func>
+    void ThreadPool::parallelForEach(Container& elements, std::size_t grain, Func&& func)
+    {
+        const auto data = std::data(elements);
+        const auto body = [data, &func](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                func(data[i]);
+        };
+        this->parallelFor(std::size(elements), grain, body);
+    }
+} // namespace obe::Jobs
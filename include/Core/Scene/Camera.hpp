@@ -16,6 +16,8 @@ namespace obe::Scene
     private:
         Transform::ViewStruct* m_camera {};
         sf::View m_view;
+        Transform::UnitVector m_previousPosition;
+        bool m_hasPreviousPosition = false;
 
         void apply() const;
 
@@ -34,6 +36,19 @@ namespace obe::Scene
          * \return An UnitVector containing the size of the Camera (Width and Height)
          */
         Transform::UnitVector getSize() const override;
+        /**
+         * \brief Gets the Position of the Camera between the previous
+         *        simulation step and the current one
+         * \param interpolation 0 for the previous Position, 1 for the current
+         *        one (see FramerateManager::getInterpolation)
+         * \return The interpolated Position of the TopLeft of the Camera
+         */
+        Transform::UnitVector getInterpolatedPosition(double interpolation) const;
+        /**
+         * \brief Saves the current Position as the one of the previous
+         *        simulation step (see getInterpolatedPosition)
+         */
+        void storePreviousPosition();
         /**
          * \brief Moves the Camera
          * \param position Position to add to the Camera
@@ -1,10 +1,16 @@
 #pragma once
 
 #include <Collision/PolygonalCollider.hpp>
+#include <Config/CompiledFile.hpp>
 #include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteBatch.hpp>
 #include <Scene/Camera.hpp>
 #include <Scene/SceneNode.hpp>
 #include <Script/GameObject.hpp>
+#include <Time/TimeUtils.hpp>
+
+#include <memory>
+#include <unordered_map>
 
 #include <sol/sol.hpp>
 
@@ -12,6 +18,10 @@
 
 namespace obe
 {
+    namespace Jobs
+    {
+        class ThreadPool;
+    }
     namespace System
     {
         class Window;
@@ -28,20 +38,49 @@ namespace obe::Scene
     class Scene : public Types::Serializable
     {
     private:
+        struct AsyncLoad;
+
         std::string m_levelName;
         std::string m_baseFolder;
         std::string m_futureLoad;
+        // Scene file loaded in the background (see setFutureLoadFromFile)
+        std::shared_ptr<AsyncLoad> m_asyncLoad;
+        Time::TimeUnit m_loadingBudget = 0.008;
         Camera m_camera;
         Transform::UnitVector m_cameraInitialPosition;
         Transform::Referential m_cameraInitialReferential;
         bool m_updateState = true;
 
         Engine::ResourceManager* m_resources = nullptr;
+        Jobs::ThreadPool* m_threadPool = nullptr;
+        // Must outlive m_colliderArray as colliders unregister on destruction
+        std::unique_ptr<Collision::BroadPhase> m_broadPhase
+            = Collision::makeBroadPhase(Collision::BroadPhaseType::AABBTree);
+        // Must outlive m_spriteArray as sprites unregister on destruction
+        Graphics::SpriteIndex m_spriteIndex;
         std::vector<std::unique_ptr<Graphics::Sprite>> m_spriteArray;
+        Graphics::SpriteBatch m_spriteBatch;
+        std::vector<Graphics::Sprite*> m_visibleSprites;
+        std::size_t m_drawnSpriteAmount = 0;
+        std::size_t m_culledSpriteAmount = 0;
+        double m_interpolation = 1.0;
+        // Sprites are sorted once at the end of Scene::load
+        bool m_deferLayerSort = false;
         std::vector<std::unique_ptr<Collision::PolygonalCollider>> m_colliderArray;
         std::vector<std::unique_ptr<Script::GameObject>> m_gameObjectArray;
+        std::vector<Script::GameObject*> m_nativeUpdates;
         std::vector<std::string> m_scriptArray;
         SceneNode m_sceneRoot;
+        // Elements by id, kept in sync with the arrays (rebuilt when an id is
+        // changed with Identifiable::setId)
+        std::unordered_map<std::string, Graphics::Sprite*> m_spriteIds;
+        std::unordered_map<std::string, Collision::PolygonalCollider*> m_colliderIds;
+        std::unordered_map<std::string, Script::GameObject*> m_gameObjectIds;
+        std::size_t m_idsRenameCount = 0;
+        // Counters used to generate the ids of elements created without one
+        std::size_t m_nextSpriteId = 0;
+        std::size_t m_nextColliderId = 0;
+        std::size_t m_nextGameObjectId = 0;
 
         std::string m_levelFileName;
         std::map<std::string, bool> m_showElements;
@@ -50,16 +89,51 @@ namespace obe::Scene
         Triggers::TriggerGroupPtr t_scene;
         sol::state_view m_lua;
 
+        void updateDrawOrder(std::size_t from = 0);
+        void updateGameObjectsNative();
+        /**
+         * \brief Rebuilds the indexes of ids if an element was renamed
+         */
+        void checkIds();
+        void loadView(vili::node& data);
+        void loadGameObject(const std::string& id, vili::node& data);
+        void finishLoading(vili::node& data);
+        /**
+         * \brief Loads a compiled Scene file, building the vili tree of one
+         *        element at a time
+         */
+        void loadCompiled(const Config::CompiledNode& data);
+        void startAsyncLoad(const std::string& path);
+        void continueAsyncLoad();
+        void runLoadCallback(
+            const std::string& previousScene, const std::string& loadedScene);
+
     public:
         /**
          * \brief Creates a new Scene
          */
         Scene(Triggers::TriggerManager& triggers, sol::state_view lua);
+        /**
+         * \brief Cancels the Scene file being loaded in the background
+         */
+        ~Scene() override;
 
         void attachResourceManager(Engine::ResourceManager& resources);
         /**
          * \nobind
-         * \brief Loads the Scene from a .map.vili file
+         * \brief Sets the ThreadPool used to update the native Components of
+         *        the GameObjects in parallel and to load the Scene files in the
+         *        background (without ThreadPool everything is done on the
+         *        calling thread)
+         * \param threadPool ThreadPool to use, nullptr to stop using one,
+         *        its main thread tasks must be run for the background loads
+         *        to complete
+         */
+        void attachThreadPool(Jobs::ThreadPool* threadPool);
+        /**
+         * \nobind
+         * \brief Loads the Scene from a .map.vili file, or from its compiled
+         *        version (.map.vilc) if it is up to date
          * \param path Path to the Scene file
          */
         void loadFromFile(const std::string& path);
@@ -68,6 +142,13 @@ namespace obe::Scene
          * \brief Same that loadFromFile excepts the map will load at the next
          *        update
          * \param path Path to the Scene file
+         *
+         * With a ThreadPool attached the file is parsed and the textures of
+         * its Sprites are decoded by a worker while the current Scene keeps
+         * running. The elements of the new Scene are then created over several
+         * updates (see setLoadingBudget), triggering Scene.Loading with the
+         * progress of the load after each of them and Scene.Loaded once
+         * done. The GameObjects are not updated until then.
          */
         void setFutureLoadFromFile(const std::string& path);
         /**
@@ -79,6 +160,33 @@ namespace obe::Scene
          */
         void setFutureLoadFromFile(
             const std::string& path, const OnSceneLoadCallback& callback);
+        /**
+         * \nobind
+         * \brief Sets the time spent creating the elements of a Scene loaded
+         *        in the background during each update
+         * \param budget Time budget of each update
+         */
+        void setLoadingBudget(Time::TimeUnit budget);
+        /**
+         * \nobind
+         * \brief Gets the time spent creating the elements of a Scene loaded
+         *        in the background during each update
+         * \return Time budget of each update
+         */
+        [[nodiscard]] Time::TimeUnit getLoadingBudget() const;
+        /**
+         * \nobind
+         * \brief Checks if a Scene file is being loaded in the background
+         * \return true if a Scene file is being loaded, false otherwise
+         */
+        [[nodiscard]] bool isLoading() const;
+        /**
+         * \nobind
+         * \brief Gets the progress of the Scene file loaded in the background
+         * \return The ratio of its elements already created (0 while the
+         *         file is parsed)
+         */
+        [[nodiscard]] double getLoadingProgress() const;
         /**
          * \brief Removes all elements in the Scene
          */
@@ -91,12 +199,32 @@ namespace obe::Scene
         void load(vili::node& data) override;
         /**
          * \brief Updates all elements in the Scene
+         *
+         * The GameObjects are updated in two phases. The native phase updates
+         * the Animators and Sprites of the initialized GameObjects in parallel,
+         * each task owning the GameObjects of its range and their Components;
+         * the SpriteIndex is only updated once the phase is over. The serial
+         * phase then initializes the new GameObjects (running their Lua Init)
+         * and removes the deleted ones.
          */
         void update();
         /**
          * \brief Draws all elements of the Scene on the screen
          */
         void draw(Graphics::RenderTarget surface);
+        /**
+         * \brief Saves the Position of the Camera and of all Sprites before a
+         *        fixed simulation step, the Scene is then drawn between the
+         *        saved Positions and the current ones (see setInterpolation)
+         */
+        void storePreviousPositions();
+        /**
+         * \brief Sets where the Scene is drawn between the Positions saved by
+         *        storePreviousPositions and the current ones
+         * \param interpolation 0 for the saved Positions, 1 for the current ones
+         */
+        void setInterpolation(double interpolation);
+        [[nodiscard]] double getInterpolation() const;
         /**
          * \brief Get the name of the level
          * \return A std::string containing the name of the level
@@ -117,7 +245,7 @@ namespace obe::Scene
         /**
          * \brief Creates a new GameObject
          * \param obj Type of the GameObject
-         * \param id Id of the new GameObject (If empty the id will be randomly
+         * \param id Id of the new GameObject (If empty the id will be
          *        generated)
          * \return A pointer to the newly created GameObject
          */
@@ -164,6 +292,11 @@ namespace obe::Scene
          * \brief Reorganize all the Sprite (by Layer and z-depth)
          */
         void reorganizeLayers();
+        /**
+         * \brief Moves the Sprites whose layer or z-depth changed to their
+         *        place in the drawing order without sorting all the Sprites
+         */
+        void reorganizeChangedLayers();
         /**
          * \brief Creates a new Sprite
          * \param id Id of the new Sprite
@@ -216,6 +349,22 @@ namespace obe::Scene
          * \param id Id of the Sprite to remove
          */
         void removeSprite(const std::string& id);
+        /**
+         * \brief Gets the batches of Sprites built during the last draw
+         * \return A reference to the SpriteBatch of the Scene
+         */
+        [[nodiscard]] const Graphics::SpriteBatch& getSpriteBatch() const;
+        /**
+         * \brief Gets how many Sprites were drawn during the last draw
+         * \return The amount of Sprites sent to the SpriteBatch
+         */
+        [[nodiscard]] std::size_t getDrawnSpriteAmount() const;
+        /**
+         * \brief Gets how many Sprites were skipped during the last draw
+         *        because they were outside of the camera
+         * \return The amount of culled Sprites
+         */
+        [[nodiscard]] std::size_t getCulledSpriteAmount() const;
 
         // Colliders
         /**
@@ -271,6 +420,18 @@ namespace obe::Scene
          * \param id Id of the Collider to remove
          */
         void removeCollider(const std::string& id);
+        /**
+         * \brief Changes the spatial index used to speed-up collision queries
+         *        between the Colliders of the Scene
+         * \param type Type of BroadPhase to use (BroadPhaseType::None disables
+         *        it, queries will then check every existing Collider)
+         */
+        void setBroadPhase(Collision::BroadPhaseType type);
+        /**
+         * \brief Gets the type of spatial index used by the Scene Colliders
+         * \return The type of BroadPhase currently in use
+         */
+        [[nodiscard]] Collision::BroadPhaseType getBroadPhaseType() const;
         SceneNode& getSceneRootNode();
 
         // Other
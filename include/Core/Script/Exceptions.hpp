@@ -79,4 +79,17 @@ namespace obe::Script::Exceptions
                 objectType, attributeName, realType, expectedType);
         }
     };
+
+    class UnknownGarbageCollectorMode : public Exception
+    {
+    public:
+        UnknownGarbageCollectorMode(std::string_view mode, DebugInfo info)
+            : Exception("UnknownGarbageCollectorMode", info)
+        {
+            this->error(
+                "Unable to convert the string '{}' to a GarbageCollectorMode", mode);
+            this->hint("Try one of the following values : (Full, Incremental, "
+                       "Generational)");
+        }
+    };
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <Animation/Animator.hpp>
 #include <Collision/PolygonalCollider.hpp>
 #include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
 #include <Graphics/Sprite.hpp>
 #include <Scene/SceneNode.hpp>
 #include <Triggers/TriggerGroup.hpp>
@@ -85,6 +86,9 @@ namespace obe::Script
 
         std::string m_type;
         std::string m_privateKey;
+#if defined(OBE_ENABLE_PROFILER)
+        Debug::ProfilerZoneId m_profilerZone;
+#endif
 
         bool m_hasScriptEngine = false;
         bool m_active = false;
@@ -224,9 +228,24 @@ namespace obe::Script
         void loadGameObject(Scene::Scene& scene, vili::node& obj,
             Engine::ResourceManager* resources = nullptr);
         /**
-         * \brief Updates the GameObject
+         * \brief Updates the GameObject (initializes it on its first update)
          */
         void update();
+        /**
+         * \nobind
+         * \brief Updates the native Components of an initialized GameObject,
+         *        steps its Animator and applies the current texture to its Sprite
+         *
+         * Only the GameObject and its own Components are modified (no Lua, no
+         * Trigger and no Scene change) so the Scene runs it on several
+         * GameObjects in parallel
+         */
+        void updateNative();
+        /**
+         * \nobind
+         * \brief Checks if the GameObject has native Components to update
+         */
+        [[nodiscard]] bool needsNativeUpdate() const;
         /**
          * \brief Deletes the GameObject
          */
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <string>
+
+#include <sol/sol.hpp>
+#include <vili/node.hpp>
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::Script
+{
+    /**
+     * \brief How the GarbageCollector collects the Lua garbage
+     */
+    enum class GarbageCollectorMode
+    {
+        /**
+         * \brief A full collection every frame
+         */
+        Full,
+        /**
+         * \brief Bounded steps of the incremental collector
+         */
+        Incremental,
+        /**
+         * \brief Bounded steps of the generational collector
+         */
+        Generational
+    };
+
+    /**
+     * \brief Converts a string to a GarbageCollectorMode
+     * \param mode String containing the mode (Full, Incremental, Generational)
+     * \return The converted GarbageCollectorMode
+     */
+    GarbageCollectorMode stringToGarbageCollectorMode(const std::string& mode);
+
+    /**
+     * \brief Schedules the collection of the Lua garbage in bounded steps
+     *
+     * In Incremental mode the automatic collection of Lua is stopped, the
+     * GarbageCollector runs the collection cycles in steps at the end of each
+     * frame (within a time budget) and while the FramerateManager waits for
+     * the next frame. A cycle is finished regardless of the budget when the
+     * memory grows twice as much as the pause allows. The other modes keep the
+     * automatic collection of Lua.
+     * \bind{GarbageCollector}
+     */
+    class GarbageCollector
+    {
+    private:
+        lua_State* m_lua;
+        GarbageCollectorMode m_mode = GarbageCollectorMode::Incremental;
+        Time::TimeUnit m_frameBudget = 0.001;
+        Time::TimeUnit m_idleBudget = 0.004;
+        int m_stepSize = 1;
+        double m_pause = 1.5;
+        bool m_cycleRunning = false;
+        std::size_t m_memoryAfterCycle = 0;
+        std::size_t m_lastCollectedBytes = 0;
+        Time::TimeUnit m_lastPause = 0;
+
+        void applyMode();
+        void step(Time::TimeUnit budget);
+
+    public:
+        /**
+         * \brief Creates a GarbageCollector for a Lua state
+         * \param lua Lua state to collect the garbage of
+         */
+        explicit GarbageCollector(sol::state_view lua);
+        /**
+         * \brief Gives the collection back to Lua
+         */
+        ~GarbageCollector();
+        /**
+         * \brief Configures the GarbageCollector
+         * \param config Configuration of the GarbageCollector
+         */
+        void configure(const vili::node& config);
+        /**
+         * \brief Collects garbage within the per-frame budget (done at the end
+         *        of every frame by the Engine)
+         */
+        void update();
+        /**
+         * \brief Collects garbage while the engine waits for the next frame
+         * \param available Time before the next frame (in seconds), only the
+         *        idle budget of it is used
+         */
+        void idle(Time::TimeUnit available);
+        /**
+         * \brief Runs a full collection cycle
+         */
+        void collect();
+        void setMode(GarbageCollectorMode mode);
+        [[nodiscard]] GarbageCollectorMode getMode() const;
+        /**
+         * \brief Sets the maximum time spent collecting garbage each frame
+         * \param budget Time budget in seconds
+         */
+        void setFrameBudget(Time::TimeUnit budget);
+        [[nodiscard]] Time::TimeUnit getFrameBudget() const;
+        /**
+         * \brief Sets the maximum time spent collecting garbage while waiting for
+         *        the next frame
+         * \param budget Time budget in seconds
+         */
+        void setIdleBudget(Time::TimeUnit budget);
+        [[nodiscard]] Time::TimeUnit getIdleBudget() const;
+        /**
+         * \brief Sets the amount of work done by a single collection step
+         * \param kilobytes Size of a step in kilobytes of allocation
+         */
+        void setStepSize(int kilobytes);
+        [[nodiscard]] int getStepSize() const;
+        /**
+         * \brief Sets how much the memory used by Lua has to grow after a
+         *        collection cycle before the next one is started
+         * \param pause Growth ratio (1.5 waits for 50% more memory)
+         */
+        void setPause(double pause);
+        [[nodiscard]] double getPause() const;
+        /**
+         * \brief Gets the memory currently used by Lua
+         * \return The memory used by Lua in bytes
+         */
+        [[nodiscard]] std::size_t getMemoryUsage() const;
+        /**
+         * \brief Gets how much memory the last collection (update, idle or
+         *        collect) freed
+         * \return The amount of freed memory in bytes
+         */
+        [[nodiscard]] std::size_t getLastCollectedBytes() const;
+        /**
+         * \brief Gets how long the last collection (update, idle or collect)
+         *        paused the engine
+         * \return The duration of the collection in seconds
+         */
+        [[nodiscard]] Time::TimeUnit getLastPause() const;
+    };
+} // namespace obe::Script
@@ -112,4 +112,15 @@ namespace obe::System::Exceptions
                 fmt::join(suggestions, ", "));
         }
     };
+
+    class FileMappingFailed : public Exception
+    {
+    public:
+        FileMappingFailed(std::string_view path, std::string_view reason, DebugInfo info)
+            : Exception("FileMappingFailed", info)
+        {
+            this->error("Impossible to map file at path '{}' in memory : {}", path,
+                reason);
+        }
+    };
 }
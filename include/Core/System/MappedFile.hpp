@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace obe::System
+{
+    /**
+     * \brief A read-only file mapped in memory, its content is paged in by the
+     *        system when it is read instead of being copied in a buffer
+     * \nobind
+     */
+    class MappedFile
+    {
+    private:
+        std::string m_path;
+        const char* m_data = nullptr;
+        std::size_t m_size = 0;
+#ifdef _WIN32
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+#endif
+        void close();
+
+    public:
+        /**
+         * \brief Maps the file at the given path
+         * \param path Path of the file on the disk (not resolved through
+         *        MountablePaths)
+         * \throws obe::System::Exceptions::FileMappingFailed if the file can not
+         *         be opened or mapped
+         */
+        explicit MappedFile(const std::string& path);
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+        /**
+         * \brief Get the path of the mapped file
+         */
+        [[nodiscard]] const std::string& getPath() const;
+        /**
+         * \brief Get the content of the file, valid as long as the MappedFile lives
+         */
+        [[nodiscard]] const char* getData() const;
+        /**
+         * \brief Get the size of the file in bytes
+         */
+        [[nodiscard]] std::size_t getSize() const;
+    };
+} // namespace obe::System
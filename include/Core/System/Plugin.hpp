@@ -8,6 +8,11 @@
 
 #include <Types/Identifiable.hpp>
 
+namespace obe::Jobs
+{
+    class ThreadPool;
+}
+
 namespace obe::System
 {
     template <class T>
@@ -27,6 +32,8 @@ namespace obe::System
         PluginFunction<void()> m_onInitFn;
         bool m_hasOnLoadBindingsFn;
         PluginFunction<void(sol::state_view)> m_onLoadBindingsFn;
+        bool m_hasOnLoadJobsFn;
+        PluginFunction<void(Jobs::ThreadPool&)> m_onLoadJobsFn;
         bool m_hasOnUpdateFn;
         PluginFunction<void(double)> m_onUpdateFn;
         bool m_hasOnRenderFn;
@@ -37,11 +44,20 @@ namespace obe::System
     public:
         Plugin(const std::string& id, const std::string& path);
         void onLoadBindings(sol::state_view lua) const;
+        /**
+         * \nobind
+         * \brief Gives the ThreadPool of the Engine to the Plugin (OnLoadJobs
+         *        function of the Plugin) so it can run its work on the workers
+         *        of the Engine
+         * \param pool ThreadPool of the Engine
+         */
+        void onLoadJobs(Jobs::ThreadPool& pool) const;
         void onUpdate(double dt) const;
         void onRender() const;
         void onExit() const;
         [[nodiscard]] bool hasOnInit() const;
         [[nodiscard]] bool hasOnLoadBindings() const;
+        [[nodiscard]] bool hasOnLoadJobs() const;
         [[nodiscard]] bool hasOnUpdate() const;
         [[nodiscard]] bool hasOnRender() const;
         [[nodiscard]] bool hasOnExit() const;
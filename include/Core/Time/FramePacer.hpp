@@ -0,0 +1,112 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::Time
+{
+    /**
+     * \brief Statistics of the durations of the last frames (in seconds)
+     */
+    struct FrameStatistics
+    {
+        TimeUnit mean = 0;
+        TimeUnit p95 = 0;
+        TimeUnit p99 = 0;
+        /**
+         * \brief Standard deviation of the frame durations
+         */
+        TimeUnit jitter = 0;
+        /**
+         * \brief Mean delay between the deadline of a frame and its start
+         */
+        TimeUnit lateness = 0;
+        std::size_t frames = 0;
+    };
+
+    /**
+     * \nobind
+     * \brief Starts frames at regular deadlines, sleeping until shortly
+     *        before the deadline and spinning for the rest of the wait
+     */
+    class FramePacer
+    {
+    public:
+        using ClockFunction = std::function<TimeUnit()>;
+        /**
+         * \brief Sleeps for the given duration, called with 0 to yield while
+         *        spinning
+         */
+        using SleepFunction = std::function<void(TimeUnit)>;
+
+    private:
+        ClockFunction m_clock;
+        SleepFunction m_sleep;
+        TimeUnit m_interval = 0;
+        TimeUnit m_spinThreshold = 2 * milliseconds;
+        TimeUnit m_nextDeadline = 0;
+        TimeUnit m_lastFrameStart = -1;
+        /**
+         * \brief Ring buffer of the last frame durations and latenesses
+         */
+        std::vector<TimeUnit> m_frameTimes;
+        std::vector<TimeUnit> m_latenesses;
+        std::size_t m_nextSample = 0;
+        std::size_t m_sampleCapacity;
+
+        void record(TimeUnit frameTime, TimeUnit lateness);
+
+    public:
+        /**
+         * \brief Creates a FramePacer using the engine clock (see Time::precise)
+         * \param sampleCapacity Amount of frames the statistics are computed on
+         */
+        explicit FramePacer(std::size_t sampleCapacity = 240);
+        /**
+         * \brief Creates a FramePacer using a custom clock
+         * \param clock Function returning the current time in seconds
+         * \param sleep Function sleeping for the given duration
+         * \param sampleCapacity Amount of frames the statistics are computed on
+         */
+        FramePacer(
+            ClockFunction clock, SleepFunction sleep, std::size_t sampleCapacity = 240);
+        /**
+         * \brief Sets the duration between the start of two frames
+         * \param interval Duration in seconds, 0 starts frames without waiting
+         */
+        void setInterval(TimeUnit interval);
+        [[nodiscard]] TimeUnit getInterval() const;
+        /**
+         * \brief Sets how long before a deadline the FramePacer stops sleeping
+         *        and spins instead, should be longer than the usual oversleep
+         *        of the system
+         * \param threshold Duration in seconds
+         */
+        void setSpinThreshold(TimeUnit threshold);
+        [[nodiscard]] TimeUnit getSpinThreshold() const;
+        /**
+         * \brief Waits until the deadline of the next frame and starts it, a
+         *        frame starting more than one interval late moves the next
+         *        deadlines instead of rushing frames to catch up
+         * \param idleTask Function run first with the time left before the
+         *        sleep, can be nullptr
+         * \return The time the frame started at
+         */
+        TimeUnit waitForNextFrame(
+            const std::function<void(TimeUnit)>& idleTask = nullptr);
+        /**
+         * \brief Get the deadline of the next frame
+         */
+        [[nodiscard]] TimeUnit getNextDeadline() const;
+        /**
+         * \brief Get the statistics of the last frames
+         */
+        [[nodiscard]] FrameStatistics getStatistics() const;
+        /**
+         * \brief Forgets the recorded frames
+         */
+        void reset();
+    };
+} // namespace obe::Time
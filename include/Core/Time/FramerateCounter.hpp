@@ -4,6 +4,7 @@
 #include <SFML/Graphics/Text.hpp>
 
 #include <Graphics/Font.hpp>
+#include <Time/FramePacer.hpp>
 #include <Time/TimeUtils.hpp>
 
 namespace obe::Time
@@ -14,12 +15,13 @@ namespace obe::Time
     class FramerateCounter
     {
     private:
-        TimeUnit m_lastTick = epoch();
+        TimeUnit m_lastTick = now();
         int m_framerateCounter = 0;
         int m_updatesCounter = 0;
         int m_framerateBuffer = 0;
         int m_updatesBuffer = 0;
         bool m_canUpdateFPS = false;
+        FrameStatistics m_statistics;
         sf::Text m_text;
         Graphics::Font m_font;
 
@@ -32,6 +34,17 @@ namespace obe::Time
          * \brief Called when game is updated
          */
         void uTick();
+        /**
+         * \brief Sets the frame time statistics displayed with the amount of
+         *        frames and updates per second
+         * \param statistics Statistics of the last frames (see
+         *        FramerateManager::getFrameStatistics)
+         */
+        void setFrameStatistics(const FrameStatistics& statistics);
+        /**
+         * \brief Get the frame time statistics given to the FramerateCounter
+         */
+        [[nodiscard]] FrameStatistics getFrameStatistics() const;
         /**
          * \brief Load a new font to use when drawing the stats
          * \param font Font to use to draw the amount of fps / ups
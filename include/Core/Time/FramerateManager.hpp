@@ -1,10 +1,12 @@
 #pragma once
 
 #include <SFML/Graphics/RenderWindow.hpp>
-#include <SFML/System/Clock.hpp>
 #include <System/Window.hpp>
+#include <Time/FramePacer.hpp>
 #include <Time/TimeUtils.hpp>
 
+#include <functional>
+
 #include <vili/node.hpp>
 
 namespace obe::Time
@@ -16,18 +18,26 @@ namespace obe::Time
     {
     private:
         System::Window& m_window;
-        sf::Clock m_deltaClock;
+        TimeUnit m_lastFrameTime = 0;
         double m_deltaTime = 0.0;
         double m_speedCoefficient = 1.0;
-        double m_frameLimiterClock;
         bool m_limitFramerate = false;
-        unsigned int m_framerateTarget;
+        unsigned int m_framerateTarget = 60;
         bool m_vsyncEnabled = true;
-        double m_reqFramerateInterval;
-        int m_currentFrame = 0;
-        int m_frameProgression = 0;
-        bool m_needToRender = false;
+        double m_reqFramerateInterval = 1.0 / 60.0;
+        FramePacer m_pacer;
         bool m_syncUpdateRender = true;
+        bool m_fixedTimestep = false;
+        unsigned int m_tickRate = 60;
+        unsigned int m_maxCatchUpSteps = 5;
+        /**
+         * \brief Game time not simulated yet in fixed timestep mode
+         */
+        TimeUnit m_accumulator = 0;
+        unsigned int m_steps = 1;
+        std::function<void(TimeUnit)> m_idleTask;
+
+        void applyPacing();
 
     public:
         /**
@@ -40,12 +50,15 @@ namespace obe::Time
          */
         void configure(vili::node& config);
         /**
-         * \brief Updates the FramerateManager (done every time in the main loop)
+         * \brief Updates the FramerateManager (done every time in the main loop),
+         *        waits for the deadline of the next frame when the framerate is
+         *        limited and stamps the time of the frame (see Time::now)
          */
         void update();
         /**
          * \brief Get if the engine should render everything
          * \return true if the engine should render everything, false otherwise
+         *         (frames are paced by update, every frame is rendered)
          */
         [[nodiscard]] bool doRender() const;
         /**
@@ -54,7 +67,8 @@ namespace obe::Time
          */
         [[nodiscard]] TimeUnit getDeltaTime() const;
         /**
-         * \brief Get the GameSpeed (DeltaTime * SpeedCoefficient)
+         * \brief Get the GameSpeed (DeltaTime * SpeedCoefficient, or the
+         *        duration of a step in fixed timestep mode)
          * \return A double containing the GameSpeed
          */
         [[nodiscard]] double getGameSpeed() const;
@@ -78,6 +92,42 @@ namespace obe::Time
          * \return true if vSync is enabled, false otherwise
          */
         [[nodiscard]] bool isVSyncEnabled() const;
+        /**
+         * \brief Get the statistics of the durations of the last frames
+         */
+        [[nodiscard]] FrameStatistics getFrameStatistics() const;
+        /**
+         * \nobind
+         * \brief Get the FramePacer starting the frames
+         */
+        FramePacer& getFramePacer();
+        /**
+         * \brief Check if the simulation runs with a fixed timestep
+         * \return true if the fixed timestep mode is enabled, false otherwise
+         */
+        [[nodiscard]] bool isFixedTimestep() const;
+        /**
+         * \brief Get the amount of simulation steps per second in fixed timestep
+         *        mode
+         */
+        [[nodiscard]] unsigned int getTickRate() const;
+        /**
+         * \brief Get the maximum amount of simulation steps run in one frame to
+         *        catch up with the elapsed time
+         */
+        [[nodiscard]] unsigned int getMaxCatchUpSteps() const;
+        /**
+         * \brief Get the amount of simulation steps to run in the current frame
+         * \return The amount of steps (always 1 without fixed timestep)
+         */
+        [[nodiscard]] unsigned int getSteps() const;
+        /**
+         * \brief Get where the current frame is between the two last simulation
+         *        steps, used to draw the Scene between their states
+         * \return 0 for the state of the second to last step, 1 for the state
+         *         of the last step (always 1 without fixed timestep)
+         */
+        [[nodiscard]] double getInterpolation() const;
         /**
          * \brief Set the SpeedCoefficient
          * \param speed The new SpeedCoefficient
@@ -100,5 +150,32 @@ namespace obe::Time
          *        (true = enabled)
          */
         void setVSyncEnabled(bool vsync);
+        /**
+         * \brief Set if the simulation should run with a fixed timestep,
+         *        running as many steps per frame as the elapsed time requires
+         * \param fixedTimestep true to enable the fixed timestep mode
+         */
+        void setFixedTimestep(bool fixedTimestep);
+        /**
+         * \brief Set the amount of simulation steps per second in fixed
+         *        timestep mode
+         * \param tickRate Amount of steps per second
+         */
+        void setTickRate(unsigned int tickRate);
+        /**
+         * \brief Set the maximum amount of simulation steps run in one frame,
+         *        the simulation slows down instead of running more steps when
+         *        frames take too long
+         * \param maxCatchUpSteps Maximum amount of steps per frame
+         */
+        void setMaxCatchUpSteps(unsigned int maxCatchUpSteps);
+        /**
+         * \nobind
+         * \brief Sets a task run when the FramerateManager waits for the next
+         *        frame, before sleeping for the rest of the wait
+         * \param task Function receiving the time left before the next frame
+         *        (in seconds)
+         */
+        void setIdleTask(std::function<void(TimeUnit)> task);
     };
 } // namespace obe::Time
\ No newline at end of file
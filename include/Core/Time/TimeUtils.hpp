@@ -16,9 +16,44 @@ namespace obe::Time
     constexpr TimeUnit weeks = days * 7.0;
 
     /**
-     * \brief Get the amount of seconds elapsed since epoch
+     * \brief Get the amount of seconds elapsed since epoch (wall clock time,
+     *        can jump when the system time changes, use now() to measure
+     *        durations)
      * \return A TimeUnit containing the amount of seconds elapsed since
      *         Epoch
      */
     TimeUnit epoch();
+    /**
+     * \brief Get the time of the current frame, stamped once per frame by
+     *        advanceFrame so that every user sees the same time during a frame
+     * \return The amount of seconds elapsed on the monotonic engine clock
+     *         when the current frame started
+     */
+    TimeUnit now();
+    /**
+     * \brief Get the time of the monotonic engine clock sampled on each call,
+     *        meant for profiling and measures within a frame
+     * \return The amount of seconds elapsed on the monotonic engine clock
+     */
+    TimeUnit precise();
+    /**
+     * \nobind
+     * \brief Stamps the time of a new frame (returned by now() until the next
+     *        call), done at the beginning of each frame by the FramerateManager
+     * \return The time of the new frame
+     */
+    TimeUnit advanceFrame();
+    /**
+     * \brief Makes the engine clock deterministic, each frame then lasts
+     *        exactly the given step whatever the real time elapsed (for
+     *        tests and replays)
+     * \param step Duration of a frame in seconds, 0 goes back to the real
+     *        time (the clock keeps going on from the current frame time)
+     */
+    void setFixedStep(TimeUnit step);
+    /**
+     * \brief Get the duration of a frame in fixed step mode
+     * \return The fixed step in seconds, 0 if the clock uses the real time
+     */
+    TimeUnit getFixedStep();
 } // namespace obe::Time
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace obe::Time
+{
+    /**
+     * \brief A hierarchical timing wheel storing timers by deadline (in ticks),
+     *        inserting and removing a timer is O(1) and advancing the wheel only
+     *        visits the slots of the elapsed ticks
+     * \nobind
+     */
+    class TimerWheel
+    {
+    public:
+        using Tick = std::uint64_t;
+        using TimerId = std::uint32_t;
+
+    private:
+        static constexpr unsigned int SlotBits = 6;
+        static constexpr unsigned int Levels = 4;
+        static constexpr Tick SlotsPerLevel = Tick(1) << SlotBits;
+        static constexpr Tick SlotMask = SlotsPerLevel - 1;
+        /**
+         * \brief Timers too far in the future for the wheel, checked again
+         *        each time the last level wraps
+         */
+        static constexpr std::size_t OverflowBucket = Levels * SlotsPerLevel;
+        /**
+         * \brief Timers already due when inserted, fired by the next advance
+         */
+        static constexpr std::size_t ExpiredBucket = OverflowBucket + 1;
+        static constexpr std::uint32_t None = std::numeric_limits<std::uint32_t>::max();
+
+        struct Timer
+        {
+            Tick deadline = 0;
+            std::uint32_t bucket = None;
+            TimerId previous = None;
+            TimerId next = None;
+        };
+
+        std::vector<Timer> m_timers;
+        /**
+         * \brief First and last timer of each bucket, timers are appended so
+         *        that the timers of a bucket are due in insertion order
+         */
+        std::array<TimerId, ExpiredBucket + 1> m_heads;
+        std::array<TimerId, ExpiredBucket + 1> m_tails;
+        Tick m_currentTick = 0;
+        std::size_t m_size = 0;
+
+        std::size_t getBucket(Tick deadline) const;
+        void link(TimerId id, std::size_t bucket);
+        void unlink(TimerId id);
+        void cascade(std::size_t bucket);
+
+    public:
+        explicit TimerWheel(Tick start = 0);
+        /**
+         * \brief Inserts a timer in the wheel (moves it if it is already in)
+         * \param id Id of the timer, chosen by the owner of the wheel (ids
+         *        should be kept small as timers are stored by id)
+         * \param deadline Tick at which the timer is due, a deadline that is
+         *        already reached is due on the next advance
+         */
+        void insert(TimerId id, Tick deadline);
+        /**
+         * \brief Removes a timer from the wheel (does nothing if it is not in)
+         * \param id Id of the timer
+         */
+        void remove(TimerId id);
+        /**
+         * \brief Check if a timer is waiting in the wheel
+         * \param id Id of the timer
+         * \return true if the timer is in the wheel, false otherwise
+         */
+        [[nodiscard]] bool contains(TimerId id) const;
+        /**
+         * \brief Moves the wheel forward and removes the due timers from it
+         * \param tick Tick to move the wheel to (ignored if in the past)
+         * \param due Vector the ids of the due timers are appended to, ordered
+         *        by deadline
+         */
+        void advance(Tick tick, std::vector<TimerId>& due);
+        [[nodiscard]] Tick getCurrentTick() const;
+        /**
+         * \brief Get the amount of timers waiting in the wheel
+         */
+        [[nodiscard]] std::size_t size() const;
+        void clear();
+    };
+} // namespace obe::Time
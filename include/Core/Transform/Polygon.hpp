@@ -26,18 +26,38 @@ namespace obe::Transform
         friend class Polygon;
         Polygon& m_parent;
         point_index_t rw_index;
+        // Writes have to go through set / move so the Polygon is updated
+        using UnitVector::add;
+        using UnitVector::operator+=;
+        using UnitVector::operator-=;
+        using UnitVector::operator*=;
+        using UnitVector::operator/=;
 
     public:
         explicit PolygonPoint(Polygon& parent, point_index_t index);
         explicit PolygonPoint(
             Polygon& parent, point_index_t index, const Transform::UnitVector& position);
+        PolygonPoint(const PolygonPoint&) = delete;
+        PolygonPoint& operator=(const PolygonPoint&) = delete;
         const point_index_t& index = rw_index;
+        /**
+         * \brief Read-only coordinates of the point, use set or move to
+         *        change them
+         */
+        const double& x = UnitVector::x;
+        const double& y = UnitVector::y;
         void remove() const;
         [[nodiscard]] double distance(const Transform::UnitVector& position) const;
         [[nodiscard]] UnitVector getRelativePosition(RelativePositionFrom from) const;
         void setRelativePosition(
             RelativePositionFrom from, const Transform::UnitVector& position);
         void move(const Transform::UnitVector& position);
+        /**
+         * \brief Same as UnitVector::set but also updates the Polygon of the
+         *        point
+         */
+        void set(const Transform::UnitVector& position);
+        void set(double x, double y);
     };
 
     class PolygonSegment
@@ -52,6 +72,29 @@ namespace obe::Transform
 
     using PolygonPath = std::vector<std::unique_ptr<PolygonPoint>>;
 
+    /**
+     * \nobind
+     * \brief Contiguous (SoA) copy of the Points of a Polygon in ScenePixels
+     *        along with their bounding box and centroid
+     */
+    class PolygonVertices
+    {
+    public:
+        std::vector<double> x;
+        std::vector<double> y;
+        double minX = 0;
+        double minY = 0;
+        double maxX = 0;
+        double maxY = 0;
+        double centroidX = 0;
+        double centroidY = 0;
+        /**
+         * \brief Incremented each time the vertices are rebuilt, allows caches
+         *        built on top of them to know when they are outdated
+         */
+        std::size_t revision = 0;
+    };
+
     /**
      * \brief Class used for all Collisions in the engine, it's a Polygon
      *        containing n points
@@ -59,12 +102,28 @@ namespace obe::Transform
      */
     class Polygon : public Transform::UnitBasedObject, public Transform::Movable
     {
+    private:
+        mutable PolygonVertices m_vertices;
+        mutable bool m_verticesDirty = true;
+        mutable double m_verticesScaleX = 0;
+        mutable double m_verticesScaleY = 0;
+
+        /**
+         * \brief Invalidates the cached vertices and calls onPointsChanged
+         */
+        void invalidatePoints();
+
     protected:
         friend class PolygonPoint;
         PolygonPath m_points;
         float m_angle = 0;
 
         void resetUnit(Transform::Units unit) override;
+        /**
+         * \brief Called whenever the Points of the Polygon are added, removed
+         *        or moved
+         */
+        virtual void onPointsChanged();
 
     public:
         static constexpr double DefaultTolerance = 0.02;
@@ -101,6 +160,13 @@ namespace obe::Transform
          * \return A Path containing all the Points of the Polygon
          */
         PolygonPath& getAllPoints();
+        /**
+         * \nobind
+         * \brief Get the Points of the Polygon in ScenePixels, only rebuilt when
+         *        the Points or the pixel scale of the View / Screen changed
+         * \return A reference to the cached vertices of the Polygon
+         */
+        [[nodiscard]] const PolygonVertices& getVertices() const;
         /**
          * \brief Get the position of the Master Point (centroid) of the Polygon
          * \return An UnitVector containing the position of the Master Point
@@ -19,6 +19,10 @@ namespace obe::Transform
          */
         UnitVector m_size;
         double m_angle = 0;
+        /**
+         * \brief Called whenever the Rect is moved, resized or rotated
+         */
+        virtual void onRectChanged();
 
     public:
         /**
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 
 #include <Time/TimeUtils.hpp>
@@ -7,6 +8,11 @@
 namespace obe::Triggers
 {
     using Callback = std::function<void()>;
+    /**
+     * \brief Handle of a CallbackScheduler, stays valid (and is never given to
+     *        another CallbackScheduler) until the CallbackScheduler is done
+     */
+    using CallbackHandle = std::uint64_t;
     class TriggerManager;
 
     enum class CallbackSchedulerState
@@ -21,9 +27,13 @@ namespace obe::Triggers
     private:
         Callback m_callback;
         TriggerManager& m_triggers;
+        CallbackHandle m_handle = 0;
         Time::TimeUnit m_after = 0;
         Time::TimeUnit m_every = 0;
-        Time::TimeUnit m_start = 0;
+        /**
+         * \brief Tick of the TriggerManager timers the next execution is due at
+         */
+        std::uint64_t m_deadline = 0;
         unsigned int m_times = 0;
         unsigned int m_currentTimes = 0;
         bool m_wait = false;
@@ -35,10 +45,30 @@ namespace obe::Triggers
 
     public:
         explicit CallbackScheduler(TriggerManager& manager);
+        /**
+         * \brief Delays the first execution of the callback
+         * \param amount Delay in seconds
+         */
         CallbackScheduler& after(double amount);
+        /**
+         * \brief Executes the callback repeatedly
+         * \param amount Interval between two executions in seconds (0 executes
+         *        the callback on each update)
+         */
         CallbackScheduler& every(double amount);
+        /**
+         * \brief Limits the amount of executions of a repeated callback
+         * \param amount Amount of executions (0 repeats the callback until it is
+         *        stopped)
+         */
         CallbackScheduler& repeat(unsigned int amount);
-        void run(const Callback& callback);
+        /**
+         * \brief Starts the CallbackScheduler
+         * \param callback Callback to execute
+         * \return The handle of the CallbackScheduler (see TriggerManager::cancel)
+         */
+        CallbackHandle run(const Callback& callback);
         void stop();
+        [[nodiscard]] CallbackHandle getHandle() const;
     };
 }
@@ -57,6 +57,17 @@ namespace obe::Triggers::Exceptions
         }
     };
 
+    class UnknownTriggerHandle : public Exception
+    {
+    public:
+        UnknownTriggerHandle(std::uint64_t handle, DebugInfo info)
+            : Exception("UnknownTriggerHandle", info)
+        {
+            this->error("Unable to find a Trigger with handle {}", handle);
+            this->hint("The Trigger has been removed since the handle was obtained");
+        }
+    };
+
     class UnknownTriggerNamespace : public Exception
     {
     public:
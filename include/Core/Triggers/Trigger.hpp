@@ -1,6 +1,9 @@
 #pragma once
 
 #include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
+#include <cstdint>
+#include <memory>
 #include <sol/sol.hpp>
 #include <utility>
 
@@ -8,6 +11,12 @@ namespace obe::Triggers
 {
     class TriggerGroup;
 
+    /**
+     * \brief Identifies a Trigger in its TriggerManager for as long as the
+     *        Trigger exists (see TriggerManager::getTriggerHandle)
+     */
+    using TriggerHandle = std::uint64_t;
+
     class TriggerEnv
     {
     public:
@@ -16,6 +25,10 @@ namespace obe::Triggers
         std::string callback;
         bool* active = nullptr;
         sol::protected_function call;
+        /**
+         * \brief Argument ids of the parameters of the callback (in order)
+         */
+        std::vector<std::size_t> arguments;
         TriggerEnv(std::string id, sol::environment environment, std::string callback,
             bool* active)
             : id(std::move(id))
@@ -29,21 +42,34 @@ namespace obe::Triggers
     /**
      * \brief A Class that does represents a triggerable event
      */
-    class Trigger
+    class Trigger : public std::enable_shared_from_this<Trigger>
     {
     private:
         TriggerGroup& m_parent;
         std::string m_name;
         std::string m_fullName;
+        std::string m_luaTableName;
+        sol::table m_luaTable;
+#if defined(OBE_ENABLE_PROFILER)
+        Debug::ProfilerZoneId m_profilerZone;
+#endif
         std::vector<TriggerEnv> m_registeredEnvs;
         std::vector<sol::environment> m_envsToRemove;
         bool m_currentlyTriggered = false;
         bool m_enabled = false;
+        bool m_coalesced = false;
         std::function<void(const TriggerEnv&)> m_onRegisterCallback;
         std::function<void(const TriggerEnv&)> m_onUnregisterCallback;
+        std::vector<std::string> m_argumentNames;
+        std::vector<sol::object> m_arguments;
         sol::state_view m_lua;
         friend class TriggerGroup;
         friend class TriggerManager;
+        /**
+         * \brief Clears the arguments and removes the environments unregistered
+         *        during the execution, even when a callback failed
+         */
+        void endExecution();
 
     protected:
         /**
@@ -53,12 +79,25 @@ namespace obe::Triggers
          * \param parameter Value of the Parameter
          */
         template <typename P> void pushParameter(const std::string& name, P parameter);
+        /**
+         * \brief Pushes a parameter to the Trigger
+         * \tparam P Type of the Parameter to push
+         * \param argumentId Id of the Parameter (see Trigger::getArgumentId)
+         * \param parameter Value of the Parameter
+         */
+        template <typename P> void pushParameter(std::size_t argumentId, P parameter);
         /**
          * \brief Pushes a parameter on the Trigger from a Lua VM
          * \param name Name of the Parameter to push
          * \param parameter Value of the parameter (LuaRef can be anything)
          */
         void pushParameterFromLua(const std::string& name, sol::object parameter);
+        /**
+         * \brief Removes the parameters pushed to the Trigger since its last
+         *        execution
+         * \return The removed parameters with their argument id
+         */
+        std::vector<std::pair<std::size_t, sol::object>> takeParameters();
         /**
          * \brief Triggers callbacks
          */
@@ -116,7 +155,25 @@ namespace obe::Triggers
          * \brief Gets the Lua Table path used to store Trigger Parameters
          * \return The path to the Lua Table used to store Trigger Parameters
          */
-        [[nodiscard]] std::string getTriggerLuaTableName() const;
+        [[nodiscard]] const std::string& getTriggerLuaTableName() const;
+        /**
+         * \brief Gets the id of the slot holding a Parameter of the Trigger
+         *        until the next execution (the slot is created if needed)
+         * \param name Name of the Parameter
+         * \return The id of the Parameter
+         */
+        std::size_t getArgumentId(const std::string& name);
+        /**
+         * \brief Sets if the executions of the Trigger queued in the same batch
+         *        are merged into a single one (see TriggerManager::dispatchQueue)
+         * \param coalesced true to merge the queued executions, false otherwise
+         */
+        void setCoalesced(bool coalesced);
+        /**
+         * \brief Get if the queued executions of the Trigger are merged
+         * \return true if the queued executions are merged, false otherwise
+         */
+        [[nodiscard]] bool isCoalesced() const;
     };
 
     template <typename P>
@@ -124,9 +181,12 @@ namespace obe::Triggers
     {
         Debug::Log->trace(
             "<Trigger> Pushing parameter {0} to Trigger {1}", name, m_fullName);
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"][name] = parameter;
-        /*Script::ScriptEngine["LuaCore"]["TriggerArgTable"][this->getTriggerLuaTableName()]
-                            [name]
-            = parameter;*/
+        this->pushParameter(this->getArgumentId(name), std::move(parameter));
+    }
+
+    template <typename P>
+    void Trigger::pushParameter(std::size_t argumentId, P parameter)
+    {
+        m_arguments[argumentId] = sol::make_object(m_lua, std::move(parameter));
     }
 } // namespace obe::Triggers
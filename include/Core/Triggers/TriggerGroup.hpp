@@ -7,6 +7,8 @@
 
 namespace obe::Triggers
 {
+    class TriggerManager;
+
     /**
      * \brief Class used to manage multiple Trigger
      */
@@ -17,7 +19,10 @@ namespace obe::Triggers
         std::string m_fromNsp;
         std::map<std::string, std::shared_ptr<Trigger>> m_triggerMap;
         bool m_joinable = false;
+        bool m_queued = false;
+        TriggerManager* m_manager = nullptr;
         sol::state_view m_lua;
+        void checkQueuedThread() const;
         friend class Trigger;
         friend class TriggerManager;
 
@@ -43,6 +48,22 @@ namespace obe::Triggers
          * \return true if the TriggerGroup is joinable, false otherwise
          */
         [[nodiscard]] bool isJoinable() const;
+        /**
+         * \brief Sets if the Triggers of the TriggerGroup are queued in the
+         *        TriggerManager when triggered instead of being executed right
+         *        away (only for TriggerGroup created by a TriggerManager)
+         *
+         * A queued TriggerGroup is still only used from the thread of its
+         * TriggerManager as its parameters are Lua objects, other threads queue
+         * Triggers with TriggerManager::enqueue
+         * \param queued true if the Triggers should be queued, false otherwise
+         */
+        void setQueued(bool queued);
+        /**
+         * \brief Get if the Triggers of the TriggerGroup are queued
+         * \return true if the Triggers are queued, false otherwise
+         */
+        [[nodiscard]] bool isQueued() const;
         /**
          * \brief Get a Trigger contained in the TriggerGroup
          * \param triggerName Name of the Trigger to get
@@ -62,8 +83,9 @@ namespace obe::Triggers
          */
         TriggerGroup& remove(const std::string& triggerName);
         /**
-         * \brief Enables a Trigger
-         * \param triggerName Name of the Trigger to enable
+         * \brief Executes a Trigger (or queues it with its parameters if the
+         *        TriggerGroup is queued)
+         * \param triggerName Name of the Trigger to execute
          * \return Pointer to the TriggerGroup to chain calls
          */
         TriggerGroup& trigger(const std::string& triggerName);
@@ -125,6 +147,7 @@ namespace obe::Triggers
     void TriggerGroup::pushParameter(
         const std::string& triggerName, const std::string& parameterName, P parameter)
     {
+        this->checkQueuedThread();
         m_triggerMap[triggerName]->pushParameter(parameterName, parameter);
     }
 } // namespace obe::Triggers
\ No newline at end of file
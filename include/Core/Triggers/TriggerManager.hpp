@@ -1,14 +1,32 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <limits>
 #include <map>
+#include <thread>
+#include <unordered_map>
 
 #include <Time/Chronometer.hpp>
+#include <Time/TimerWheel.hpp>
 #include <Triggers/CallbackScheduler.hpp>
 #include <Triggers/Trigger.hpp>
 #include <Triggers/TriggerGroup.hpp>
 
 namespace obe::Triggers
 {
+    class TriggerManager;
+
+    /**
+     * \brief Execution of a Trigger waiting in the queue of a TriggerManager
+     */
+    struct QueuedTrigger
+    {
+        TriggerHandle trigger;
+        std::function<void(TriggerManager&)> pushParameters;
+        QueuedTrigger* next = nullptr;
+    };
+
     /**
      * \brief A TriggerManager that handles all Trigger / TriggerGroup
      */
@@ -17,12 +35,63 @@ namespace obe::Triggers
     private:
         std::map<std::string, std::map<std::string, std::weak_ptr<TriggerGroup>>>
             m_allTriggers;
-        std::vector<std::unique_ptr<CallbackScheduler>> m_schedulers;
+        /**
+         * \brief CallbackScheduler of each scheduler slot (nullptr for free
+         *        slots) with the generation of the slot, the slot is also the id
+         *        of the timer of the CallbackScheduler
+         */
+        std::vector<std::pair<std::unique_ptr<CallbackScheduler>, std::uint32_t>>
+            m_schedulers;
+        std::vector<std::uint32_t> m_freeSchedulerSlots;
+        /**
+         * \brief Timers of the running CallbackSchedulers, one tick is one
+         *        millisecond of the engine clock (see Time::now)
+         */
+        Time::TimerWheel m_timers;
+        std::vector<Time::TimerWheel::TimerId> m_dueTimers;
+        std::vector<CallbackHandle> m_dueSchedulers;
+        /**
+         * \brief Slot of the CallbackScheduler being executed, kept alive until
+         *        its callback returns
+         */
+        std::uint32_t m_executingScheduler = std::numeric_limits<std::uint32_t>::max();
+        /**
+         * \brief Handles of the existing Triggers by Lua table name
+         */
+        std::unordered_map<std::string, TriggerHandle> m_triggerHandles;
+        /**
+         * \brief Trigger of each handle slot (nullptr for free slots) with the
+         *        generation of the slot, bumped each time the slot is freed
+         */
+        std::vector<std::pair<Trigger*, std::uint32_t>> m_handleSlots;
+        std::vector<std::uint32_t> m_freeHandleSlots;
+        /**
+         * \brief Lock-free stack of the queued Triggers (last queued first)
+         */
+        std::atomic<QueuedTrigger*> m_queue { nullptr };
+        /**
+         * \brief Thread creating the TriggerManager, the only one using the
+         *        Lua state
+         */
+        std::thread::id m_thread = std::this_thread::get_id();
         Time::Chronometer m_databaseChrono;
         sol::state_view m_lua;
+        friend class TriggerGroup;
+        friend class CallbackScheduler;
+
+        void attachTrigger(Trigger& trigger);
+        void detachTrigger(const Trigger& trigger);
+        Trigger* findTrigger(TriggerHandle handle);
+        void clearQueue();
+        CallbackScheduler* findScheduler(CallbackHandle handle);
+        std::uint64_t getTimersTick() const;
+        void startScheduler(CallbackScheduler& scheduler);
+        void stopScheduler(CallbackScheduler& scheduler);
+        void freeScheduler(std::uint32_t slot);
 
     public:
         explicit TriggerManager(sol::state_view lua);
+        ~TriggerManager();
         /**
          * \brief Get a Trigger contained in the TriggerManager
          * \param space Namespace of the Trigger
@@ -32,6 +101,57 @@ namespace obe::Triggers
          */
         std::weak_ptr<Trigger> getTrigger(const std::string& space,
             const std::string& group, const std::string& trigger);
+        /**
+         * \brief Get the handle of a Trigger of a TriggerGroup created by the
+         *        TriggerManager, used to reach the Trigger without any name
+         *        lookup
+         * \param space Namespace of the Trigger
+         * \param group TriggerGroup of the Trigger
+         * \param trigger Name of the Trigger
+         * \return The handle of the Trigger (valid until the Trigger is removed)
+         */
+        TriggerHandle getTriggerHandle(const std::string& space,
+            const std::string& group, const std::string& trigger);
+        /**
+         * \brief Get a Trigger from its handle
+         * \param handle Handle of the Trigger (see getTriggerHandle)
+         * \return A reference to the Trigger (throws an error if the Trigger was
+         *         removed)
+         */
+        Trigger& getTrigger(TriggerHandle handle);
+        /**
+         * \brief Pushes a Parameter to a Trigger
+         * \tparam P Type of the Parameter
+         * \param handle Handle of the Trigger to push the parameter
+         * \param argumentId Id of the parameter (see Trigger::getArgumentId)
+         * \param parameter Value of the parameter
+         */
+        template <typename P>
+        void pushParameter(TriggerHandle handle, std::size_t argumentId, P parameter);
+        /**
+         * \brief Triggers the callbacks of a Trigger
+         * \param handle Handle of the Trigger to execute
+         */
+        void trigger(TriggerHandle handle);
+        /**
+         * \brief Queues the execution of a Trigger until the next call to
+         *        dispatchQueue, can be called from any thread
+         * \param handle Handle of the Trigger to execute (handles are obtained
+         *        on the thread of the TriggerManager)
+         * \param pushParameters Function pushing the parameters of the Trigger,
+         *        called by the thread dispatching the queue right before the
+         *        execution, it should only capture C++ values as Lua objects
+         *        can not be created from other threads
+         */
+        void enqueue(TriggerHandle handle,
+            std::function<void(TriggerManager&)> pushParameters = nullptr);
+        /**
+         * \brief Executes the queued Triggers in the order they were queued, a
+         *        coalesced Trigger queued several times is only executed at its
+         *        last position with the parameters of all its executions
+         *        (a failing execution is logged and the next ones still run)
+         */
+        void dispatchQueue();
         /**
          * \brief Get a list of all names of Trigger instances inside a TriggerGroup
          * \param space Name of the namespace where the TriggerGroup is located
@@ -94,7 +214,8 @@ namespace obe::Triggers
          */
         bool doesTriggerGroupExists(const std::string& space, const std::string& group);
         /**
-         * \brief Updates the TriggerManager
+         * \brief Updates the TriggerManager, executing the CallbackSchedulers
+         *        that are due
          */
         void update();
         /**
@@ -102,6 +223,37 @@ namespace obe::Triggers
          */
         void clear();
 
+        /**
+         * \brief Creates a new CallbackScheduler, started with
+         *        CallbackScheduler::run
+         * \return A reference to the CallbackScheduler (valid until it is done)
+         */
         CallbackScheduler& schedule();
+        /**
+         * \brief Stops a CallbackScheduler
+         * \param handle Handle of the CallbackScheduler (see
+         *        CallbackScheduler::run)
+         * \return true if the CallbackScheduler was stopped, false if it was
+         *         already done
+         */
+        bool cancel(CallbackHandle handle);
+        /**
+         * \brief Check if a CallbackScheduler is waiting for its next execution
+         * \param handle Handle of the CallbackScheduler
+         * \return true if the CallbackScheduler is running, false otherwise
+         */
+        bool isScheduled(CallbackHandle handle);
+        /**
+         * \brief Get the amount of CallbackSchedulers waiting for their next
+         *        execution
+         */
+        [[nodiscard]] std::size_t getScheduledAmount() const;
     };
+
+    template <typename P>
+    void TriggerManager::pushParameter(
+        TriggerHandle handle, std::size_t argumentId, P parameter)
+    {
+        this->getTrigger(handle).pushParameter(argumentId, std::move(parameter));
+    }
 } // namespace obe::Triggers
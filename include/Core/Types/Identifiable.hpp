@@ -30,6 +30,12 @@ namespace obe::Types
          * \return A std::string containing the id of the Identifiable
          */
         [[nodiscard]] std::string getId() const;
+        /**
+         * \nobind
+         * \brief Gets how many times an Identifiable had its id changed with
+         *        setId, indexes of ids are outdated when it changes
+         */
+        static std::size_t GetRenameCount();
     };
 
     /**
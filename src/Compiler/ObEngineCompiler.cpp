@@ -0,0 +1,114 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <Config/CompiledFile.hpp>
+#include <Config/Templates/Animation.hpp>
+#include <Config/Templates/GameObject.hpp>
+#include <Config/Templates/Scene.hpp>
+#include <Exception.hpp>
+#include <Utils/FileUtils.hpp>
+#include <Utils/StringUtils.hpp>
+
+#include <vili/parser/parser.hpp>
+
+using namespace obe;
+
+namespace
+{
+    struct FileKind
+    {
+        const char* extension;
+        vili::parser::state (*templates)();
+    };
+
+    // Files loaded by the engine through Config::LoadFile
+    const FileKind FileKinds[] = { { ".map.vili", Config::Templates::getSceneTemplates },
+        { ".obj.vili", Config::Templates::getGameObjectTemplates },
+        { ".ani.vili", Config::Templates::getAnimationTemplates } };
+
+    const FileKind* getFileKind(const std::string& path)
+    {
+        for (const FileKind& kind : FileKinds)
+        {
+            if (Utils::String::endsWith(path, kind.extension))
+                return &kind;
+        }
+        return nullptr;
+    }
+
+    bool compile(const std::string& path, const FileKind& kind)
+    {
+        const std::string compiledPath = Config::GetCompiledPath(path);
+        try
+        {
+            const vili::node data = vili::parser::from_file(path, kind.templates());
+            const std::string compiled = Config::CompileNode(data);
+            std::ofstream output(compiledPath, std::ios::binary | std::ios::trunc);
+            output.write(compiled.data(), compiled.size());
+            if (!output)
+            {
+                std::cerr << "Could not write '" << compiledPath << "'" << std::endl;
+                return false;
+            }
+            std::cout << path << " -> " << compiledPath << " (" << compiled.size()
+                      << " bytes)" << std::endl;
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Could not compile '" << path << "' : " << e.what()
+                      << std::endl;
+            return false;
+        }
+    }
+
+    // Compiles the files the engine can load from a compiled version, in the
+    // directory and all its subdirectories
+    bool compileDirectory(const std::string& path)
+    {
+        bool success = true;
+        for (const std::string& file : Utils::File::getFileList(path))
+        {
+            if (const FileKind* kind = getFileKind(file))
+                success = compile(path + "/" + file, *kind) && success;
+        }
+        for (const std::string& directory : Utils::File::getDirectoryList(path))
+            success = compileDirectory(path + "/" + directory) && success;
+        return success;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "Usage : ObEngineCompiler <file or directory>..." << std::endl;
+        std::cout << "Compiles .map.vili, .obj.vili and .ani.vili files to .vilc "
+                     "files (version "
+                  << Config::CompiledFileVersion << ") placed next to them"
+                  << std::endl;
+        return 1;
+    }
+    bool success = true;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string path = argv[i];
+        if (Utils::File::directoryExists(path))
+        {
+            success = compileDirectory(path) && success;
+        }
+        else if (const FileKind* kind = getFileKind(path))
+        {
+            success = compile(path, *kind) && success;
+        }
+        else
+        {
+            std::cerr << "'" << path << "' is not a directory or a .map.vili, "
+                      << ".obj.vili or .ani.vili file" << std::endl;
+            success = false;
+        }
+    }
+    return success ? 0 : 1;
+}
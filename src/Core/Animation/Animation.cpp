@@ -1,5 +1,6 @@
 #include <Animation/Animation.hpp>
 #include <Animation/Exceptions.hpp>
+#include <Config/CompiledFile.hpp>
 #include <Config/Templates/Animation.hpp>
 
 #include <Debug/Logger.hpp>
@@ -7,7 +8,6 @@
 #include <Utils/StringUtils.hpp>
 
 #include <vili/node.hpp>
-#include <vili/parser/parser.hpp>
 #include <vili/types.hpp>
 
 namespace obe::Animation
@@ -98,8 +98,8 @@ namespace obe::Animation
     {
         Debug::Log->debug("<Animation> Loading Animation at {0}", path.toString());
         const std::string animationConfigFile
-            = path.add(path.last() + ".ani.vili").find();
-        vili::node animationConfig = vili::parser::from_file(
+            = Config::FindFile(path.add(path.last() + ".ani.vili"));
+        vili::node animationConfig = Config::LoadFile(
             animationConfigFile, Config::Templates::getAnimationTemplates());
 
         try
@@ -352,9 +352,9 @@ namespace obe::Animation
         {
             const Time::TimeUnit delay = (m_sleep) ? m_sleep : m_delay;
             Debug::Log->trace("<Animation> Delay is {} seconds", delay);
-            if (Time::epoch() - m_clock > delay)
+            if (Time::now() - m_clock > delay)
             {
-                m_clock = Time::epoch();
+                m_clock = Time::now();
                 m_sleep = 0;
                 Debug::Log->trace("<Animation> Updating Animation '{0}'", m_name);
 
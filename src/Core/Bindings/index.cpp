@@ -178,12 +178,15 @@ namespace obe::Bindings
             &obe::Audio::Exceptions::Bindings::LoadClassAudioFileNotFound);
 
         BindTree["obe"]["Collision"]
+            .add("ClassCastResult", &obe::Collision::Bindings::LoadClassCastResult)
             .add("ClassCollisionData", &obe::Collision::Bindings::LoadClassCollisionData)
+            .add("ClassPenetration", &obe::Collision::Bindings::LoadClassPenetration)
             .add("ClassPolygonalCollider",
                 &obe::Collision::Bindings::LoadClassPolygonalCollider)
             .add("ClassTrajectory", &obe::Collision::Bindings::LoadClassTrajectory)
             .add(
                 "ClassTrajectoryNode", &obe::Collision::Bindings::LoadClassTrajectoryNode)
+            .add("EnumBroadPhaseType", &obe::Collision::Bindings::LoadEnumBroadPhaseType)
             .add("EnumColliderTagType",
                 &obe::Collision::Bindings::LoadEnumColliderTagType);
 
@@ -259,6 +262,8 @@ namespace obe::Bindings
             .add("ClassRichText", &obe::Graphics::Bindings::LoadClassRichText)
             .add("ClassShader", &obe::Graphics::Bindings::LoadClassShader)
             .add("ClassSprite", &obe::Graphics::Bindings::LoadClassSprite)
+            .add("ClassSpriteBatch", &obe::Graphics::Bindings::LoadClassSpriteBatch)
+            .add("ClassSpriteBatchRun", &obe::Graphics::Bindings::LoadClassSpriteBatchRun)
             .add("ClassSpriteHandlePoint",
                 &obe::Graphics::Bindings::LoadClassSpriteHandlePoint)
             .add("ClassText", &obe::Graphics::Bindings::LoadClassText)
@@ -372,13 +377,20 @@ namespace obe::Bindings
                 &obe::Script::Exceptions::Bindings::LoadClassObjectDefinitionNotFound)
             .add("ClassScriptFileNotFound",
                 &obe::Script::Exceptions::Bindings::LoadClassScriptFileNotFound)
+            .add("ClassUnknownGarbageCollectorMode",
+                &obe::Script::Exceptions::Bindings::LoadClassUnknownGarbageCollectorMode)
             .add("ClassWrongSourceAttributeType",
                 &obe::Script::Exceptions::Bindings::LoadClassWrongSourceAttributeType);
 
         BindTree["obe"]["Script"]
             .add("ClassGameObject", &obe::Script::Bindings::LoadClassGameObject)
             .add("ClassGameObjectDatabase",
-                &obe::Script::Bindings::LoadClassGameObjectDatabase);
+                &obe::Script::Bindings::LoadClassGameObjectDatabase)
+            .add("ClassGarbageCollector", &obe::Script::Bindings::LoadClassGarbageCollector)
+            .add("EnumGarbageCollectorMode",
+                &obe::Script::Bindings::LoadEnumGarbageCollectorMode)
+            .add("FunctionStringToGarbageCollectorMode",
+                &obe::Script::Bindings::LoadFunctionStringToGarbageCollectorMode);
 
         BindTree["obe"]["System"]
             .add("ClassCursor", &obe::System::Bindings::LoadClassCursor)
@@ -428,7 +440,12 @@ namespace obe::Bindings
             .add("ClassChronometer", &obe::Time::Bindings::LoadClassChronometer)
             .add("ClassFramerateCounter", &obe::Time::Bindings::LoadClassFramerateCounter)
             .add("ClassFramerateManager", &obe::Time::Bindings::LoadClassFramerateManager)
+            .add("ClassFrameStatistics", &obe::Time::Bindings::LoadClassFrameStatistics)
             .add("FunctionEpoch", &obe::Time::Bindings::LoadFunctionEpoch)
+            .add("FunctionNow", &obe::Time::Bindings::LoadFunctionNow)
+            .add("FunctionPrecise", &obe::Time::Bindings::LoadFunctionPrecise)
+            .add("FunctionSetFixedStep", &obe::Time::Bindings::LoadFunctionSetFixedStep)
+            .add("FunctionGetFixedStep", &obe::Time::Bindings::LoadFunctionGetFixedStep)
             .add("GlobalSeconds", &obe::Time::Bindings::LoadGlobalSeconds)
             .add("GlobalMilliseconds", &obe::Time::Bindings::LoadGlobalMilliseconds)
             .add("GlobalMicroseconds", &obe::Time::Bindings::LoadGlobalMicroseconds)
@@ -496,6 +513,8 @@ namespace obe::Bindings
                 &obe::Triggers::Exceptions::Bindings::LoadClassUnknownTrigger)
             .add("ClassUnknownTriggerGroup",
                 &obe::Triggers::Exceptions::Bindings::LoadClassUnknownTriggerGroup)
+            .add("ClassUnknownTriggerHandle",
+                &obe::Triggers::Exceptions::Bindings::LoadClassUnknownTriggerHandle)
             .add("ClassUnknownTriggerNamespace",
                 &obe::Triggers::Exceptions::Bindings::LoadClassUnknownTriggerNamespace);
 
@@ -640,6 +659,10 @@ namespace obe::Bindings
                 &obe::Config::Templates::Bindings::LoadGlobalSetAnimationCommand);
 
         BindTree["obe"]["Debug"]
+            .add("ClassProfiler", &obe::Debug::Bindings::LoadClassProfiler)
+            .add("ClassProfilerCounter", &obe::Debug::Bindings::LoadClassProfilerCounter)
+            .add("ClassProfilerFrame", &obe::Debug::Bindings::LoadClassProfilerFrame)
+            .add("ClassProfilerZone", &obe::Debug::Bindings::LoadClassProfilerZone)
             .add("FunctionInitLogger", &obe::Debug::Bindings::LoadFunctionInitLogger)
             .add("FunctionTrace", &obe::Debug::Bindings::LoadFunctionTrace)
             .add("FunctionDebug", &obe::Debug::Bindings::LoadFunctionDebug)
@@ -647,7 +670,8 @@ namespace obe::Bindings
             .add("FunctionWarn", &obe::Debug::Bindings::LoadFunctionWarn)
             .add("FunctionError", &obe::Debug::Bindings::LoadFunctionError)
             .add("FunctionCritical", &obe::Debug::Bindings::LoadFunctionCritical)
-            .add("GlobalLog", &obe::Debug::Bindings::LoadGlobalLog);
+            .add("GlobalLog", &obe::Debug::Bindings::LoadGlobalLog)
+            .add("GlobalEngineProfiler", &obe::Debug::Bindings::LoadGlobalEngineProfiler);
 
         BindTree["obe"]["Graphics"]["Utils"]
             .add("FunctionDrawPoint",
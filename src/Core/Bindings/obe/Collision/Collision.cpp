@@ -1,5 +1,7 @@
 #include <Bindings/obe/Collision/Collision.hpp>
 
+#include <Collision/BroadPhase.hpp>
+#include <Collision/NarrowPhase.hpp>
 #include <Collision/PolygonalCollider.hpp>
 #include <Collision/Trajectory.hpp>
 #include <Collision/TrajectoryNode.hpp>
@@ -16,6 +18,26 @@ namespace obe::Collision::Bindings
                 { "Accepted", obe::Collision::ColliderTagType::Accepted },
                 { "Rejected", obe::Collision::ColliderTagType::Rejected } });
     }
+    void LoadEnumBroadPhaseType(sol::state_view state)
+    {
+        sol::table CollisionNamespace = state["obe"]["Collision"].get<sol::table>();
+        CollisionNamespace.new_enum<obe::Collision::BroadPhaseType>("BroadPhaseType",
+            { { "None", obe::Collision::BroadPhaseType::None },
+                { "AABBTree", obe::Collision::BroadPhaseType::AABBTree },
+                { "UniformGrid", obe::Collision::BroadPhaseType::UniformGrid } });
+    }
+    void LoadClassCastResult(sol::state_view state)
+    {
+        sol::table CollisionNamespace = state["obe"]["Collision"].get<sol::table>();
+        sol::usertype<obe::Collision::CastResult> bindCastResult
+            = CollisionNamespace.new_usertype<obe::Collision::CastResult>(
+                "CastResult", sol::call_constructor, sol::default_constructor);
+        bindCastResult["collider"] = &obe::Collision::CastResult::collider;
+        bindCastResult["timeOfImpact"] = &obe::Collision::CastResult::timeOfImpact;
+        bindCastResult["normal"] = &obe::Collision::CastResult::normal;
+        bindCastResult["offset"] = &obe::Collision::CastResult::offset;
+        bindCastResult["slide"] = &obe::Collision::CastResult::slide;
+    }
     void LoadClassCollisionData(sol::state_view state)
     {
         sol::table CollisionNamespace = state["obe"]["Collision"].get<sol::table>();
@@ -25,6 +47,16 @@ namespace obe::Collision::Bindings
         bindCollisionData["colliders"] = &obe::Collision::CollisionData::colliders;
         bindCollisionData["offset"] = &obe::Collision::CollisionData::offset;
     }
+    void LoadClassPenetration(sol::state_view state)
+    {
+        sol::table CollisionNamespace = state["obe"]["Collision"].get<sol::table>();
+        sol::usertype<obe::Collision::Penetration> bindPenetration
+            = CollisionNamespace.new_usertype<obe::Collision::Penetration>(
+                "Penetration", sol::call_constructor, sol::default_constructor);
+        bindPenetration["colliding"] = &obe::Collision::Penetration::colliding;
+        bindPenetration["depth"] = &obe::Collision::Penetration::depth;
+        bindPenetration["normal"] = &obe::Collision::Penetration::normal;
+    }
     void LoadClassPolygonalCollider(sol::state_view state)
     {
         sol::table CollisionNamespace = state["obe"]["Collision"].get<sol::table>();
@@ -40,6 +72,10 @@ namespace obe::Collision::Bindings
                     obe::Component::ComponentBase, obe::Types::Identifiable,
                     obe::Types::Serializable>());
         bindPolygonalCollider["addTag"] = &obe::Collision::PolygonalCollider::addTag;
+        bindPolygonalCollider["castCollider"]
+            = &obe::Collision::PolygonalCollider::castCollider;
+        bindPolygonalCollider["checkTags"]
+            = &obe::Collision::PolygonalCollider::checkTags;
         bindPolygonalCollider["clearTags"]
             = &obe::Collision::PolygonalCollider::clearTags;
         bindPolygonalCollider["doesCollide"] = sol::overload(
@@ -65,6 +101,8 @@ namespace obe::Collision::Bindings
                 obe::Collision::PolygonalCollider&, const obe::Transform::UnitVector&)
                     const>(
                 &obe::Collision::PolygonalCollider::getMaximumDistanceBeforeCollision));
+        bindPolygonalCollider["getPenetration"]
+            = &obe::Collision::PolygonalCollider::getPenetration;
         bindPolygonalCollider["getParentId"]
             = &obe::Collision::PolygonalCollider::getParentId;
         bindPolygonalCollider["load"] = &obe::Collision::PolygonalCollider::load;
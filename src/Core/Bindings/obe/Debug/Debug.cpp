@@ -1,11 +1,97 @@
 #include <Bindings/obe/Debug/Debug.hpp>
 
 #include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
 
 #include <Bindings/Config.hpp>
 
 namespace obe::Debug::Bindings
 {
+    void LoadClassProfiler(sol::state_view state)
+    {
+        sol::table DebugNamespace = state["obe"]["Debug"].get<sol::table>();
+        sol::usertype<obe::Debug::Profiler> bindProfiler
+            = DebugNamespace.new_usertype<obe::Debug::Profiler>("Profiler",
+                sol::call_constructor,
+                sol::constructors<obe::Debug::Profiler(),
+                    obe::Debug::Profiler(std::size_t)>());
+        bindProfiler["setEnabled"] = &obe::Debug::Profiler::setEnabled;
+        bindProfiler["isEnabled"] = &obe::Debug::Profiler::isEnabled;
+        bindProfiler["setFrameCapacity"] = &obe::Debug::Profiler::setFrameCapacity;
+        bindProfiler["getFrameCapacity"] = &obe::Debug::Profiler::getFrameCapacity;
+        bindProfiler["getZoneId"] = &obe::Debug::Profiler::getZoneId;
+        bindProfiler["getZoneName"] = &obe::Debug::Profiler::getZoneName;
+        bindProfiler["beginFrame"] = &obe::Debug::Profiler::beginFrame;
+        bindProfiler["endFrame"] = &obe::Debug::Profiler::endFrame;
+        bindProfiler["beginZone"] = &obe::Debug::Profiler::beginZone;
+        bindProfiler["endZone"] = &obe::Debug::Profiler::endZone;
+        bindProfiler["getFrameCount"] = &obe::Debug::Profiler::getFrameCount;
+        bindProfiler["getFrame"] = sol::overload(
+            [](obe::Debug::Profiler* self) -> const obe::Debug::ProfilerFrame& {
+                return self->getFrame();
+            },
+            [](obe::Debug::Profiler* self, std::size_t age)
+                -> const obe::Debug::ProfilerFrame& { return self->getFrame(age); });
+        bindProfiler["getFrameDuration"] = sol::overload(
+            [](obe::Debug::Profiler* self) -> double { return self->getFrameDuration(); },
+            [](obe::Debug::Profiler* self, std::size_t age) -> double {
+                return self->getFrameDuration(age);
+            });
+        bindProfiler["getZoneDuration"] = sol::overload(
+            [](obe::Debug::Profiler* self, const std::string& name) -> double {
+                return self->getZoneDuration(name);
+            },
+            [](obe::Debug::Profiler* self, const std::string& name, std::size_t age)
+                -> double { return self->getZoneDuration(name, age); });
+        bindProfiler["getAverageZoneDuration"]
+            = &obe::Debug::Profiler::getAverageZoneDuration;
+        bindProfiler["setCounter"] = &obe::Debug::Profiler::setCounter;
+        bindProfiler["getCounterValue"] = sol::overload(
+            [](obe::Debug::Profiler* self, const std::string& name) -> double {
+                return self->getCounterValue(name);
+            },
+            [](obe::Debug::Profiler* self, const std::string& name, std::size_t age)
+                -> double { return self->getCounterValue(name, age); });
+        bindProfiler["clear"] = &obe::Debug::Profiler::clear;
+        bindProfiler["toChromeTrace"] = &obe::Debug::Profiler::toChromeTrace;
+        bindProfiler["saveChromeTrace"] = &obe::Debug::Profiler::saveChromeTrace;
+        bindProfiler["NoZone"] = sol::var(obe::Debug::Profiler::NoZone);
+        bindProfiler["DefaultFrameCapacity"]
+            = sol::var(obe::Debug::Profiler::DefaultFrameCapacity);
+    }
+    void LoadClassProfilerCounter(sol::state_view state)
+    {
+        sol::table DebugNamespace = state["obe"]["Debug"].get<sol::table>();
+        sol::usertype<obe::Debug::ProfilerCounter> bindProfilerCounter
+            = DebugNamespace.new_usertype<obe::Debug::ProfilerCounter>(
+                "ProfilerCounter", sol::call_constructor, sol::default_constructor);
+        bindProfilerCounter["id"] = &obe::Debug::ProfilerCounter::id;
+        bindProfilerCounter["time"] = &obe::Debug::ProfilerCounter::time;
+        bindProfilerCounter["value"] = &obe::Debug::ProfilerCounter::value;
+    }
+    void LoadClassProfilerFrame(sol::state_view state)
+    {
+        sol::table DebugNamespace = state["obe"]["Debug"].get<sol::table>();
+        sol::usertype<obe::Debug::ProfilerFrame> bindProfilerFrame
+            = DebugNamespace.new_usertype<obe::Debug::ProfilerFrame>(
+                "ProfilerFrame", sol::call_constructor, sol::default_constructor);
+        bindProfilerFrame["index"] = &obe::Debug::ProfilerFrame::index;
+        bindProfilerFrame["start"] = &obe::Debug::ProfilerFrame::start;
+        bindProfilerFrame["end"] = &obe::Debug::ProfilerFrame::end;
+        bindProfilerFrame["zones"] = &obe::Debug::ProfilerFrame::zones;
+        bindProfilerFrame["counters"] = &obe::Debug::ProfilerFrame::counters;
+    }
+    void LoadClassProfilerZone(sol::state_view state)
+    {
+        sol::table DebugNamespace = state["obe"]["Debug"].get<sol::table>();
+        sol::usertype<obe::Debug::ProfilerZone> bindProfilerZone
+            = DebugNamespace.new_usertype<obe::Debug::ProfilerZone>(
+                "ProfilerZone", sol::call_constructor, sol::default_constructor);
+        bindProfilerZone["id"] = &obe::Debug::ProfilerZone::id;
+        bindProfilerZone["depth"] = &obe::Debug::ProfilerZone::depth;
+        bindProfilerZone["start"] = &obe::Debug::ProfilerZone::start;
+        bindProfilerZone["end"] = &obe::Debug::ProfilerZone::end;
+    }
     void LoadFunctionInitLogger(sol::state_view state)
     {
         sol::table DebugNamespace = state["obe"]["Debug"].get<sol::table>();
@@ -46,4 +132,9 @@ namespace obe::Debug::Bindings
         sol::table DebugNamespace = state["obe"]["Debug"].get<sol::table>();
         DebugNamespace["Log"] = obe::Debug::Log;
     }
+    void LoadGlobalEngineProfiler(sol::state_view state)
+    {
+        sol::table DebugNamespace = state["obe"]["Debug"].get<sol::table>();
+        DebugNamespace["EngineProfiler"] = &obe::Debug::EngineProfiler;
+    }
 };
\ No newline at end of file
@@ -26,6 +26,8 @@ namespace obe::Engine::Bindings
         bindEngine["Scene"] = sol::property(&obe::Engine::Engine::getScene);
         bindEngine["Cursor"] = sol::property(&obe::Engine::Engine::getCursor);
         bindEngine["Window"] = sol::property(&obe::Engine::Engine::getWindow);
+        bindEngine["GarbageCollector"]
+            = sol::property(&obe::Engine::Engine::getGarbageCollector);
     }
     void LoadClassResourceManagedObject(sol::state_view state)
     {
@@ -54,6 +56,21 @@ namespace obe::Engine::Bindings
                 obe::Engine::ResourceManager::*)(const std::string&)>(
                 &obe::Engine::ResourceManager::getTexture));
         bindResourceManager["clean"] = &obe::Engine::ResourceManager::clean;
+        bindResourceManager["enableTextureAtlas"] = sol::overload(
+            [](obe::Engine::ResourceManager* self) -> void {
+                return self->enableTextureAtlas();
+            },
+            [](obe::Engine::ResourceManager* self, unsigned int threshold) -> void {
+                return self->enableTextureAtlas(threshold);
+            },
+            [](obe::Engine::ResourceManager* self, unsigned int threshold,
+                unsigned int pageSize) -> void {
+                return self->enableTextureAtlas(threshold, pageSize);
+            });
+        bindResourceManager["disableTextureAtlas"]
+            = &obe::Engine::ResourceManager::disableTextureAtlas;
+        bindResourceManager["isTextureAtlasEnabled"]
+            = &obe::Engine::ResourceManager::isTextureAtlasEnabled;
         bindResourceManager["defaultAntiAliasing"]
             = &obe::Engine::ResourceManager::defaultAntiAliasing;
     }
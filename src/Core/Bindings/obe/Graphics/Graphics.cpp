@@ -6,6 +6,7 @@
 #include <Graphics/RenderTarget.hpp>
 #include <Graphics/Shader.hpp>
 #include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteBatch.hpp>
 #include <Graphics/Text.hpp>
 #include <Graphics/Texture.hpp>
 
@@ -248,6 +249,10 @@ namespace obe::Graphics::Bindings
             = &obe::Graphics::PositionTransformer::getYTransformer;
         bindPositionTransformer["getYTransformerName"]
             = &obe::Graphics::PositionTransformer::getYTransformerName;
+        bindPositionTransformer["setXTransformer"]
+            = &obe::Graphics::PositionTransformer::setXTransformer;
+        bindPositionTransformer["setYTransformer"]
+            = &obe::Graphics::PositionTransformer::setYTransformer;
         bindPositionTransformer[sol::meta_function::call]
             = &obe::Graphics::PositionTransformer::operator();
     }
@@ -354,12 +359,54 @@ namespace obe::Graphics::Bindings
         bindSprite["setZDepth"] = &obe::Graphics::Sprite::setZDepth;
         bindSprite["setAntiAliasing"] = &obe::Graphics::Sprite::setAntiAliasing;
         bindSprite["useTextureSize"] = &obe::Graphics::Sprite::useTextureSize;
-        bindSprite["draw"] = &obe::Graphics::Sprite::draw;
+        bindSprite["draw"] = sol::overload(
+            [](obe::Graphics::Sprite* self, obe::Graphics::RenderTarget surface,
+                const obe::Transform::UnitVector& camera) -> void {
+                return self->draw(surface, camera);
+            },
+            [](obe::Graphics::Sprite* self, obe::Graphics::RenderTarget surface,
+                const obe::Transform::UnitVector& camera, double interpolation) -> void {
+                return self->draw(surface, camera, interpolation);
+            });
+        bindSprite["addToBatch"] = sol::overload(
+            [](obe::Graphics::Sprite* self, obe::Graphics::SpriteBatch& batch,
+                const obe::Transform::UnitVector& camera) -> void {
+                return self->addToBatch(batch, camera);
+            },
+            [](obe::Graphics::Sprite* self, obe::Graphics::SpriteBatch& batch,
+                const obe::Transform::UnitVector& camera, double interpolation) -> void {
+                return self->addToBatch(batch, camera, interpolation);
+            });
+        bindSprite["storePreviousPosition"]
+            = &obe::Graphics::Sprite::storePreviousPosition;
+        bindSprite["getBounds"] = &obe::Graphics::Sprite::getBounds;
         bindSprite["attachResourceManager"]
             = &obe::Graphics::Sprite::attachResourceManager;
         bindSprite["type"] = &obe::Graphics::Sprite::type;
         bindSprite["m_layerChanged"] = &obe::Graphics::Sprite::m_layerChanged;
     }
+    void LoadClassSpriteBatch(sol::state_view state)
+    {
+        sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
+        sol::usertype<obe::Graphics::SpriteBatch> bindSpriteBatch
+            = GraphicsNamespace.new_usertype<obe::Graphics::SpriteBatch>(
+                "SpriteBatch", sol::call_constructor, sol::default_constructor);
+        bindSpriteBatch["clear"] = &obe::Graphics::SpriteBatch::clear;
+        bindSpriteBatch["draw"] = &obe::Graphics::SpriteBatch::draw;
+        bindSpriteBatch["getRun"] = &obe::Graphics::SpriteBatch::getRun;
+        bindSpriteBatch["getDrawCallCount"]
+            = &obe::Graphics::SpriteBatch::getDrawCallCount;
+        bindSpriteBatch["getVertexCount"] = &obe::Graphics::SpriteBatch::getVertexCount;
+        bindSpriteBatch["getSpriteCount"] = &obe::Graphics::SpriteBatch::getSpriteCount;
+    }
+    void LoadClassSpriteBatchRun(sol::state_view state)
+    {
+        sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
+        sol::usertype<obe::Graphics::SpriteBatchRun> bindSpriteBatchRun
+            = GraphicsNamespace.new_usertype<obe::Graphics::SpriteBatchRun>(
+                "SpriteBatchRun", sol::call_constructor, sol::default_constructor);
+        bindSpriteBatchRun["spriteCount"] = &obe::Graphics::SpriteBatchRun::spriteCount;
+    }
     void LoadClassSpriteHandlePoint(sol::state_view state)
     {
         sol::table GraphicsNamespace = state["obe"]["Graphics"].get<sol::table>();
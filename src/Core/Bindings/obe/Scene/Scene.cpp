@@ -23,6 +23,9 @@ namespace obe::Scene::Bindings
             [](obe::Scene::Camera* self, const obe::Transform::Referential& ref)
                 -> obe::Transform::UnitVector { return self->getPosition(ref); });
         bindCamera["getSize"] = &obe::Scene::Camera::getSize;
+        bindCamera["getInterpolatedPosition"]
+            = &obe::Scene::Camera::getInterpolatedPosition;
+        bindCamera["storePreviousPosition"] = &obe::Scene::Camera::storePreviousPosition;
         bindCamera["move"] = &obe::Scene::Camera::move;
         bindCamera["scale"]
             = sol::overload([](obe::Scene::Camera* self,
@@ -67,6 +70,10 @@ namespace obe::Scene::Bindings
         bindScene["load"] = &obe::Scene::Scene::load;
         bindScene["update"] = &obe::Scene::Scene::update;
         bindScene["draw"] = &obe::Scene::Scene::draw;
+        bindScene["storePreviousPositions"]
+            = &obe::Scene::Scene::storePreviousPositions;
+        bindScene["setInterpolation"] = &obe::Scene::Scene::setInterpolation;
+        bindScene["getInterpolation"] = &obe::Scene::Scene::getInterpolation;
         bindScene["getLevelName"] = &obe::Scene::Scene::getLevelName;
         bindScene["setLevelName"] = &obe::Scene::Scene::setLevelName;
         bindScene["setUpdateState"] = &obe::Scene::Scene::setUpdateState;
@@ -92,6 +99,8 @@ namespace obe::Scene::Bindings
         bindScene["removeGameObject"] = &obe::Scene::Scene::removeGameObject;
         bindScene["getCamera"] = &obe::Scene::Scene::getCamera;
         bindScene["reorganizeLayers"] = &obe::Scene::Scene::reorganizeLayers;
+        bindScene["reorganizeChangedLayers"]
+            = &obe::Scene::Scene::reorganizeChangedLayers;
         bindScene["createSprite"] = sol::overload(
             [](obe::Scene::Scene* self) -> obe::Graphics::Sprite& {
                 return self->createSprite();
@@ -110,6 +119,9 @@ namespace obe::Scene::Bindings
         bindScene["getSprite"] = &obe::Scene::Scene::getSprite;
         bindScene["doesSpriteExists"] = &obe::Scene::Scene::doesSpriteExists;
         bindScene["removeSprite"] = &obe::Scene::Scene::removeSprite;
+        bindScene["getSpriteBatch"] = &obe::Scene::Scene::getSpriteBatch;
+        bindScene["getDrawnSpriteAmount"] = &obe::Scene::Scene::getDrawnSpriteAmount;
+        bindScene["getCulledSpriteAmount"] = &obe::Scene::Scene::getCulledSpriteAmount;
         bindScene["createCollider"] = sol::overload(
             [](obe::Scene::Scene* self) -> obe::Collision::PolygonalCollider& {
                 return self->createCollider();
@@ -131,6 +143,8 @@ namespace obe::Scene::Bindings
         bindScene["getCollider"] = &obe::Scene::Scene::getCollider;
         bindScene["doesColliderExists"] = &obe::Scene::Scene::doesColliderExists;
         bindScene["removeCollider"] = &obe::Scene::Scene::removeCollider;
+        bindScene["setBroadPhase"] = &obe::Scene::Scene::setBroadPhase;
+        bindScene["getBroadPhaseType"] = &obe::Scene::Scene::getBroadPhaseType;
         bindScene["getSceneRootNode"] = &obe::Scene::Scene::getSceneRootNode;
         bindScene["getFilePath"] = &obe::Scene::Scene::getFilePath;
         bindScene["reload"] = sol::overload(
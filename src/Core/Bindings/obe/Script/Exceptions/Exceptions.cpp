@@ -56,6 +56,19 @@ namespace obe::Script::Exceptions::Bindings
                           obe::DebugInfo)>(),
                       sol::base_classes, sol::bases<obe::Exception>());
     }
+    void LoadClassUnknownGarbageCollectorMode(sol::state_view state)
+    {
+        sol::table ExceptionsNamespace
+            = state["obe"]["Script"]["Exceptions"].get<sol::table>();
+        sol::usertype<obe::Script::Exceptions::UnknownGarbageCollectorMode>
+            bindUnknownGarbageCollectorMode
+            = ExceptionsNamespace
+                  .new_usertype<obe::Script::Exceptions::UnknownGarbageCollectorMode>(
+                      "UnknownGarbageCollectorMode", sol::call_constructor,
+                      sol::constructors<obe::Script::Exceptions::UnknownGarbageCollectorMode(
+                          std::string_view, obe::DebugInfo)>(),
+                      sol::base_classes, sol::bases<obe::Exception>());
+    }
     void LoadClassWrongSourceAttributeType(sol::state_view state)
     {
         sol::table ExceptionsNamespace
@@ -2,6 +2,7 @@
 
 #include <Scene/Scene.hpp>
 #include <Script/GameObject.hpp>
+#include <Script/GarbageCollector.hpp>
 
 #include <Bindings/Config.hpp>
 
@@ -78,4 +79,51 @@ namespace obe::Script::Bindings
             = &obe::Script::GameObjectDatabase::ApplyRequirements;
         bindGameObjectDatabase["Clear"] = &obe::Script::GameObjectDatabase::Clear;
     }
+    void LoadClassGarbageCollector(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        sol::usertype<obe::Script::GarbageCollector> bindGarbageCollector
+            = ScriptNamespace.new_usertype<obe::Script::GarbageCollector>(
+                "GarbageCollector", sol::call_constructor,
+                sol::constructors<obe::Script::GarbageCollector(sol::state_view)>());
+        bindGarbageCollector["configure"] = &obe::Script::GarbageCollector::configure;
+        bindGarbageCollector["update"] = &obe::Script::GarbageCollector::update;
+        bindGarbageCollector["idle"] = &obe::Script::GarbageCollector::idle;
+        bindGarbageCollector["collect"] = &obe::Script::GarbageCollector::collect;
+        bindGarbageCollector["setMode"] = &obe::Script::GarbageCollector::setMode;
+        bindGarbageCollector["getMode"] = &obe::Script::GarbageCollector::getMode;
+        bindGarbageCollector["setFrameBudget"]
+            = &obe::Script::GarbageCollector::setFrameBudget;
+        bindGarbageCollector["getFrameBudget"]
+            = &obe::Script::GarbageCollector::getFrameBudget;
+        bindGarbageCollector["setIdleBudget"]
+            = &obe::Script::GarbageCollector::setIdleBudget;
+        bindGarbageCollector["getIdleBudget"]
+            = &obe::Script::GarbageCollector::getIdleBudget;
+        bindGarbageCollector["setStepSize"] = &obe::Script::GarbageCollector::setStepSize;
+        bindGarbageCollector["getStepSize"] = &obe::Script::GarbageCollector::getStepSize;
+        bindGarbageCollector["setPause"] = &obe::Script::GarbageCollector::setPause;
+        bindGarbageCollector["getPause"] = &obe::Script::GarbageCollector::getPause;
+        bindGarbageCollector["getMemoryUsage"]
+            = &obe::Script::GarbageCollector::getMemoryUsage;
+        bindGarbageCollector["getLastCollectedBytes"]
+            = &obe::Script::GarbageCollector::getLastCollectedBytes;
+        bindGarbageCollector["getLastPause"]
+            = &obe::Script::GarbageCollector::getLastPause;
+    }
+    void LoadEnumGarbageCollectorMode(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        ScriptNamespace.new_enum<obe::Script::GarbageCollectorMode>(
+            "GarbageCollectorMode",
+            { { "Full", obe::Script::GarbageCollectorMode::Full },
+                { "Incremental", obe::Script::GarbageCollectorMode::Incremental },
+                { "Generational", obe::Script::GarbageCollectorMode::Generational } });
+    }
+    void LoadFunctionStringToGarbageCollectorMode(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        ScriptNamespace.set_function(
+            "stringToGarbageCollectorMode", obe::Script::stringToGarbageCollectorMode);
+    }
 };
\ No newline at end of file
@@ -159,6 +159,7 @@ namespace obe::System::Bindings
         bindPlugin["onExit"] = &obe::System::Plugin::onExit;
         bindPlugin["hasOnInit"] = &obe::System::Plugin::hasOnInit;
         bindPlugin["hasOnLoadBindings"] = &obe::System::Plugin::hasOnLoadBindings;
+        bindPlugin["hasOnLoadJobs"] = &obe::System::Plugin::hasOnLoadJobs;
         bindPlugin["hasOnUpdate"] = &obe::System::Plugin::hasOnUpdate;
         bindPlugin["hasOnRender"] = &obe::System::Plugin::hasOnRender;
         bindPlugin["hasOnExit"] = &obe::System::Plugin::hasOnExit;
@@ -1,6 +1,7 @@
 #include <Bindings/obe/Time/Time.hpp>
 
 #include <Time/Chronometer.hpp>
+#include <Time/FramePacer.hpp>
 #include <Time/FramerateCounter.hpp>
 #include <Time/FramerateManager.hpp>
 #include <Time/TimeUtils.hpp>
@@ -31,6 +32,10 @@ namespace obe::Time::Bindings
                 "FramerateCounter", sol::call_constructor, sol::default_constructor);
         bindFramerateCounter["tick"] = &obe::Time::FramerateCounter::tick;
         bindFramerateCounter["uTick"] = &obe::Time::FramerateCounter::uTick;
+        bindFramerateCounter["setFrameStatistics"]
+            = &obe::Time::FramerateCounter::setFrameStatistics;
+        bindFramerateCounter["getFrameStatistics"]
+            = &obe::Time::FramerateCounter::getFrameStatistics;
         bindFramerateCounter["loadFont"] = &obe::Time::FramerateCounter::loadFont;
         bindFramerateCounter["draw"] = &obe::Time::FramerateCounter::draw;
     }
@@ -62,12 +67,60 @@ namespace obe::Time::Bindings
             = &obe::Time::FramerateManager::setFramerateTarget;
         bindFramerateManager["setVSyncEnabled"]
             = &obe::Time::FramerateManager::setVSyncEnabled;
+        bindFramerateManager["getFrameStatistics"]
+            = &obe::Time::FramerateManager::getFrameStatistics;
+        bindFramerateManager["isFixedTimestep"]
+            = &obe::Time::FramerateManager::isFixedTimestep;
+        bindFramerateManager["getTickRate"] = &obe::Time::FramerateManager::getTickRate;
+        bindFramerateManager["getMaxCatchUpSteps"]
+            = &obe::Time::FramerateManager::getMaxCatchUpSteps;
+        bindFramerateManager["getSteps"] = &obe::Time::FramerateManager::getSteps;
+        bindFramerateManager["getInterpolation"]
+            = &obe::Time::FramerateManager::getInterpolation;
+        bindFramerateManager["setFixedTimestep"]
+            = &obe::Time::FramerateManager::setFixedTimestep;
+        bindFramerateManager["setTickRate"] = &obe::Time::FramerateManager::setTickRate;
+        bindFramerateManager["setMaxCatchUpSteps"]
+            = &obe::Time::FramerateManager::setMaxCatchUpSteps;
+    }
+    void LoadClassFrameStatistics(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        sol::usertype<obe::Time::FrameStatistics> bindFrameStatistics
+            = TimeNamespace.new_usertype<obe::Time::FrameStatistics>(
+                "FrameStatistics", sol::call_constructor, sol::default_constructor);
+        bindFrameStatistics["mean"] = &obe::Time::FrameStatistics::mean;
+        bindFrameStatistics["p95"] = &obe::Time::FrameStatistics::p95;
+        bindFrameStatistics["p99"] = &obe::Time::FrameStatistics::p99;
+        bindFrameStatistics["jitter"] = &obe::Time::FrameStatistics::jitter;
+        bindFrameStatistics["lateness"] = &obe::Time::FrameStatistics::lateness;
+        bindFrameStatistics["frames"] = &obe::Time::FrameStatistics::frames;
     }
     void LoadFunctionEpoch(sol::state_view state)
     {
         sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
         TimeNamespace.set_function("epoch", obe::Time::epoch);
     }
+    void LoadFunctionNow(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("now", obe::Time::now);
+    }
+    void LoadFunctionPrecise(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("precise", obe::Time::precise);
+    }
+    void LoadFunctionSetFixedStep(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("setFixedStep", obe::Time::setFixedStep);
+    }
+    void LoadFunctionGetFixedStep(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("getFixedStep", obe::Time::getFixedStep);
+    }
     void LoadGlobalSeconds(sol::state_view state)
     {
         sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
@@ -136,6 +136,18 @@ namespace obe::Transform::Bindings
         bindPolygonPoint["setRelativePosition"]
             = &obe::Transform::PolygonPoint::setRelativePosition;
         bindPolygonPoint["move"] = &obe::Transform::PolygonPoint::move;
+        bindPolygonPoint["add"] = &obe::Transform::PolygonPoint::move;
+        bindPolygonPoint["set"] = sol::overload(
+            static_cast<void (obe::Transform::PolygonPoint::*)(
+                const obe::Transform::UnitVector&)>(&obe::Transform::PolygonPoint::set),
+            static_cast<void (obe::Transform::PolygonPoint::*)(double, double)>(
+                &obe::Transform::PolygonPoint::set));
+        bindPolygonPoint["x"] = sol::property(
+            [](obe::Transform::PolygonPoint* self) { return self->x; },
+            [](obe::Transform::PolygonPoint* self, double x) { self->set(x, self->y); });
+        bindPolygonPoint["y"] = sol::property(
+            [](obe::Transform::PolygonPoint* self) { return self->y; },
+            [](obe::Transform::PolygonPoint* self, double y) { self->set(self->x, y); });
         bindPolygonPoint["index"] = sol::property(
             [](obe::Transform::PolygonPoint* self) -> const point_index_t& {
                 return self->index;
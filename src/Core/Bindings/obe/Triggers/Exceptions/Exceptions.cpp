@@ -84,6 +84,19 @@ namespace obe::Triggers::Exceptions::Bindings
                     const std::vector<std::string>&, obe::DebugInfo)>(),
                 sol::base_classes, sol::bases<obe::Exception>());
     }
+    void LoadClassUnknownTriggerHandle(sol::state_view state)
+    {
+        sol::table ExceptionsNamespace
+            = state["obe"]["Triggers"]["Exceptions"].get<sol::table>();
+        sol::usertype<obe::Triggers::Exceptions::UnknownTriggerHandle>
+            bindUnknownTriggerHandle
+            = ExceptionsNamespace
+                  .new_usertype<obe::Triggers::Exceptions::UnknownTriggerHandle>(
+                      "UnknownTriggerHandle", sol::call_constructor,
+                      sol::constructors<obe::Triggers::Exceptions::UnknownTriggerHandle(
+                          std::uint64_t, obe::DebugInfo)>(),
+                      sol::base_classes, sol::bases<obe::Exception>());
+    }
     void LoadClassUnknownTriggerGroup(sol::state_view state)
     {
         sol::table ExceptionsNamespace
@@ -31,6 +31,8 @@ namespace obe::Triggers::Bindings
         bindCallbackScheduler["repeat"] = &obe::Triggers::CallbackScheduler::repeat;
         bindCallbackScheduler["run"] = &obe::Triggers::CallbackScheduler::run;
         bindCallbackScheduler["stop"] = &obe::Triggers::CallbackScheduler::stop;
+        bindCallbackScheduler["getHandle"]
+            = &obe::Triggers::CallbackScheduler::getHandle;
     }
     void LoadClassTrigger(sol::state_view state)
     {
@@ -51,6 +53,9 @@ namespace obe::Triggers::Bindings
             = &obe::Triggers::Trigger::unregisterEnvironment;
         bindTrigger["getTriggerLuaTableName"]
             = &obe::Triggers::Trigger::getTriggerLuaTableName;
+        bindTrigger["getArgumentId"] = &obe::Triggers::Trigger::getArgumentId;
+        bindTrigger["setCoalesced"] = &obe::Triggers::Trigger::setCoalesced;
+        bindTrigger["isCoalesced"] = &obe::Triggers::Trigger::isCoalesced;
     }
     void LoadClassTriggerEnv(sol::state_view state)
     {
@@ -65,6 +70,7 @@ namespace obe::Triggers::Bindings
         bindTriggerEnv["callback"] = &obe::Triggers::TriggerEnv::callback;
         bindTriggerEnv["active"] = &obe::Triggers::TriggerEnv::active;
         bindTriggerEnv["call"] = &obe::Triggers::TriggerEnv::call;
+        bindTriggerEnv["arguments"] = &obe::Triggers::TriggerEnv::arguments;
     }
     void LoadClassTriggerGroup(sol::state_view state)
     {
@@ -76,6 +82,8 @@ namespace obe::Triggers::Bindings
                     sol::state_view, const std::string&, const std::string&)>());
         bindTriggerGroup["setJoinable"] = &obe::Triggers::TriggerGroup::setJoinable;
         bindTriggerGroup["isJoinable"] = &obe::Triggers::TriggerGroup::isJoinable;
+        bindTriggerGroup["setQueued"] = &obe::Triggers::TriggerGroup::setQueued;
+        bindTriggerGroup["isQueued"] = &obe::Triggers::TriggerGroup::isQueued;
         bindTriggerGroup["get"] = &obe::Triggers::TriggerGroup::get;
         bindTriggerGroup["add"] = &obe::Triggers::TriggerGroup::add;
         bindTriggerGroup["remove"] = &obe::Triggers::TriggerGroup::remove;
@@ -97,7 +105,24 @@ namespace obe::Triggers::Bindings
             = TriggersNamespace.new_usertype<obe::Triggers::TriggerManager>(
                 "TriggerManager", sol::call_constructor,
                 sol::constructors<obe::Triggers::TriggerManager(sol::state_view)>());
-        bindTriggerManager["getTrigger"] = &obe::Triggers::TriggerManager::getTrigger;
+        bindTriggerManager["getTrigger"] = sol::overload(
+            static_cast<std::weak_ptr<obe::Triggers::Trigger> (
+                obe::Triggers::TriggerManager::*)(const std::string&, const std::string&,
+                const std::string&)>(&obe::Triggers::TriggerManager::getTrigger),
+            static_cast<obe::Triggers::Trigger& (obe::Triggers::TriggerManager::*)(
+                obe::Triggers::TriggerHandle)>(
+                &obe::Triggers::TriggerManager::getTrigger));
+        bindTriggerManager["getTriggerHandle"]
+            = &obe::Triggers::TriggerManager::getTriggerHandle;
+        bindTriggerManager["trigger"] = &obe::Triggers::TriggerManager::trigger;
+        bindTriggerManager["enqueue"] = sol::overload(
+            [](obe::Triggers::TriggerManager* self, obe::Triggers::TriggerHandle handle)
+                -> void { return self->enqueue(handle); },
+            [](obe::Triggers::TriggerManager* self, obe::Triggers::TriggerHandle handle,
+                std::function<void(obe::Triggers::TriggerManager&)> pushParameters)
+                -> void { return self->enqueue(handle, pushParameters); });
+        bindTriggerManager["dispatchQueue"]
+            = &obe::Triggers::TriggerManager::dispatchQueue;
         bindTriggerManager["getAllTriggersNameFromTriggerGroup"]
             = &obe::Triggers::TriggerManager::getAllTriggersNameFromTriggerGroup;
         bindTriggerManager["createNamespace"]
@@ -117,5 +142,9 @@ namespace obe::Triggers::Bindings
         bindTriggerManager["update"] = &obe::Triggers::TriggerManager::update;
         bindTriggerManager["clear"] = &obe::Triggers::TriggerManager::clear;
         bindTriggerManager["schedule"] = &obe::Triggers::TriggerManager::schedule;
+        bindTriggerManager["cancel"] = &obe::Triggers::TriggerManager::cancel;
+        bindTriggerManager["isScheduled"] = &obe::Triggers::TriggerManager::isScheduled;
+        bindTriggerManager["getScheduledAmount"]
+            = &obe::Triggers::TriggerManager::getScheduledAmount;
     }
 };
\ No newline at end of file
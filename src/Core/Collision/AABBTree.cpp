@@ -0,0 +1,321 @@
+#include <algorithm>
+
+#include <Collision/AABBTree.hpp>
+
+namespace obe::Collision
+{
+    bool AABBTree::Node::isLeaf() const
+    {
+        return left == NullProxy;
+    }
+
+    AABBTree::AABBTree(double margin)
+        : m_margin(margin)
+    {
+    }
+
+    int AABBTree::allocateNode()
+    {
+        if (m_freeList == NullProxy)
+        {
+            m_nodes.emplace_back();
+            m_nodes.back().height = 0;
+            return static_cast<int>(m_nodes.size() - 1);
+        }
+        const int node = m_freeList;
+        m_freeList = m_nodes[node].parent;
+        m_nodes[node] = Node();
+        m_nodes[node].height = 0;
+        return node;
+    }
+
+    void AABBTree::freeNode(int node)
+    {
+        m_nodes[node] = Node();
+        // Free nodes reuse the parent field to chain the free list
+        m_nodes[node].parent = m_freeList;
+        m_freeList = node;
+    }
+
+    AABB AABBTree::fatten(const AABB& bounds) const
+    {
+        const double extent
+            = std::max(bounds.maxX - bounds.minX, bounds.maxY - bounds.minY) * m_margin;
+        return bounds.inflate(extent, extent);
+    }
+
+    void AABBTree::insertLeaf(int leaf)
+    {
+        if (m_root == NullProxy)
+        {
+            m_root = leaf;
+            m_nodes[leaf].parent = NullProxy;
+            return;
+        }
+
+        // Find the best sibling using the perimeter as a cost heuristic
+        const AABB leafBounds = m_nodes[leaf].bounds;
+        int index = m_root;
+        while (!m_nodes[index].isLeaf())
+        {
+            const Node& node = m_nodes[index];
+            const double perimeter = node.bounds.getPerimeter();
+            const double combinedPerimeter = node.bounds.merge(leafBounds).getPerimeter();
+            const double cost = 2.0 * combinedPerimeter;
+            const double inheritanceCost = 2.0 * (combinedPerimeter - perimeter);
+
+            const auto descendCost = [&](int child) {
+                const Node& childNode = m_nodes[child];
+                const double merged = childNode.bounds.merge(leafBounds).getPerimeter();
+                if (childNode.isLeaf())
+                    return merged + inheritanceCost;
+                return merged - childNode.bounds.getPerimeter() + inheritanceCost;
+            };
+            const double leftCost = descendCost(node.left);
+            const double rightCost = descendCost(node.right);
+
+            if (cost < leftCost && cost < rightCost)
+                break;
+            index = (leftCost < rightCost) ? node.left : node.right;
+        }
+
+        const int sibling = index;
+        const int oldParent = m_nodes[sibling].parent;
+        const int newParent = this->allocateNode();
+        m_nodes[newParent].parent = oldParent;
+        m_nodes[newParent].bounds = leafBounds.merge(m_nodes[sibling].bounds);
+        m_nodes[newParent].height = m_nodes[sibling].height + 1;
+        m_nodes[newParent].left = sibling;
+        m_nodes[newParent].right = leaf;
+        m_nodes[sibling].parent = newParent;
+        m_nodes[leaf].parent = newParent;
+
+        if (oldParent != NullProxy)
+        {
+            if (m_nodes[oldParent].left == sibling)
+                m_nodes[oldParent].left = newParent;
+            else
+                m_nodes[oldParent].right = newParent;
+        }
+        else
+        {
+            m_root = newParent;
+        }
+
+        // Walk back up the tree fixing heights and bounds
+        index = m_nodes[leaf].parent;
+        while (index != NullProxy)
+        {
+            index = this->balance(index);
+            Node& node = m_nodes[index];
+            node.height
+                = 1 + std::max(m_nodes[node.left].height, m_nodes[node.right].height);
+            node.bounds = m_nodes[node.left].bounds.merge(m_nodes[node.right].bounds);
+            index = node.parent;
+        }
+    }
+
+    void AABBTree::removeLeaf(int leaf)
+    {
+        if (leaf == m_root)
+        {
+            m_root = NullProxy;
+            return;
+        }
+
+        const int parent = m_nodes[leaf].parent;
+        const int grandParent = m_nodes[parent].parent;
+        const Node& parentNode = m_nodes[parent];
+        const int sibling
+            = (parentNode.left == leaf) ? parentNode.right : parentNode.left;
+
+        if (grandParent != NullProxy)
+        {
+            if (m_nodes[grandParent].left == parent)
+                m_nodes[grandParent].left = sibling;
+            else
+                m_nodes[grandParent].right = sibling;
+            m_nodes[sibling].parent = grandParent;
+            this->freeNode(parent);
+
+            int index = grandParent;
+            while (index != NullProxy)
+            {
+                index = this->balance(index);
+                Node& node = m_nodes[index];
+                node.bounds = m_nodes[node.left].bounds.merge(m_nodes[node.right].bounds);
+                node.height
+                    = 1 + std::max(m_nodes[node.left].height, m_nodes[node.right].height);
+                index = node.parent;
+            }
+        }
+        else
+        {
+            m_root = sibling;
+            m_nodes[sibling].parent = NullProxy;
+            this->freeNode(parent);
+        }
+    }
+
+    int AABBTree::balance(int iA)
+    {
+        Node& A = m_nodes[iA];
+        if (A.isLeaf() || A.height < 2)
+            return iA;
+
+        const int iB = A.left;
+        const int iC = A.right;
+        Node& B = m_nodes[iB];
+        Node& C = m_nodes[iC];
+
+        const auto replaceInParent = [this](int parent, int oldChild, int newChild) {
+            if (parent == NullProxy)
+                m_root = newChild;
+            else if (m_nodes[parent].left == oldChild)
+                m_nodes[parent].left = newChild;
+            else
+                m_nodes[parent].right = newChild;
+        };
+
+        const int balanceFactor = C.height - B.height;
+        // Rotate C up
+        if (balanceFactor > 1)
+        {
+            const int iF = C.left;
+            const int iG = C.right;
+            Node& F = m_nodes[iF];
+            Node& G = m_nodes[iG];
+
+            C.left = iA;
+            C.parent = A.parent;
+            A.parent = iC;
+            replaceInParent(C.parent, iA, iC);
+
+            if (F.height > G.height)
+            {
+                C.right = iF;
+                A.right = iG;
+                G.parent = iA;
+                A.bounds = B.bounds.merge(G.bounds);
+                C.bounds = A.bounds.merge(F.bounds);
+                A.height = 1 + std::max(B.height, G.height);
+                C.height = 1 + std::max(A.height, F.height);
+            }
+            else
+            {
+                C.right = iG;
+                A.right = iF;
+                F.parent = iA;
+                A.bounds = B.bounds.merge(F.bounds);
+                C.bounds = A.bounds.merge(G.bounds);
+                A.height = 1 + std::max(B.height, F.height);
+                C.height = 1 + std::max(A.height, G.height);
+            }
+            return iC;
+        }
+        // Rotate B up
+        if (balanceFactor < -1)
+        {
+            const int iD = B.left;
+            const int iE = B.right;
+            Node& D = m_nodes[iD];
+            Node& E = m_nodes[iE];
+
+            B.left = iA;
+            B.parent = A.parent;
+            A.parent = iB;
+            replaceInParent(B.parent, iA, iB);
+
+            if (D.height > E.height)
+            {
+                B.right = iD;
+                A.left = iE;
+                E.parent = iA;
+                A.bounds = C.bounds.merge(E.bounds);
+                B.bounds = A.bounds.merge(D.bounds);
+                A.height = 1 + std::max(C.height, E.height);
+                B.height = 1 + std::max(A.height, D.height);
+            }
+            else
+            {
+                B.right = iE;
+                A.left = iD;
+                D.parent = iA;
+                A.bounds = C.bounds.merge(D.bounds);
+                B.bounds = A.bounds.merge(E.bounds);
+                A.height = 1 + std::max(C.height, D.height);
+                B.height = 1 + std::max(A.height, E.height);
+            }
+            return iB;
+        }
+        return iA;
+    }
+
+    ProxyId AABBTree::insert(PolygonalCollider& collider, const AABB& bounds)
+    {
+        const int leaf = this->allocateNode();
+        m_nodes[leaf].bounds = this->fatten(bounds);
+        m_nodes[leaf].collider = &collider;
+        this->insertLeaf(leaf);
+        m_leafCount++;
+        return leaf;
+    }
+
+    bool AABBTree::update(ProxyId proxy, const AABB& bounds)
+    {
+        if (m_nodes[proxy].bounds.contains(bounds))
+            return false;
+        this->removeLeaf(proxy);
+        m_nodes[proxy].bounds = this->fatten(bounds);
+        this->insertLeaf(proxy);
+        return true;
+    }
+
+    void AABBTree::remove(ProxyId proxy)
+    {
+        this->removeLeaf(proxy);
+        this->freeNode(proxy);
+        m_leafCount--;
+    }
+
+    void AABBTree::query(const AABB& area, std::vector<PolygonalCollider*>& result) const
+    {
+        if (m_root == NullProxy)
+            return;
+        m_stack.clear();
+        m_stack.push_back(m_root);
+        while (!m_stack.empty())
+        {
+            const Node& node = m_nodes[m_stack.back()];
+            m_stack.pop_back();
+            if (!node.bounds.intersects(area))
+                continue;
+            if (node.isLeaf())
+            {
+                result.push_back(node.collider);
+            }
+            else
+            {
+                m_stack.push_back(node.left);
+                m_stack.push_back(node.right);
+            }
+        }
+    }
+
+    std::size_t AABBTree::size() const
+    {
+        return m_leafCount;
+    }
+
+    BroadPhaseType AABBTree::getType() const
+    {
+        return BroadPhaseType::AABBTree;
+    }
+
+    int AABBTree::getHeight() const
+    {
+        if (m_root == NullProxy)
+            return 0;
+        return m_nodes[m_root].height;
+    }
+} // namespace obe::Collision
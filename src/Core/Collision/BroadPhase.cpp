@@ -0,0 +1,62 @@
+#include <algorithm>
+
+#include <Collision/AABBTree.hpp>
+#include <Collision/BroadPhase.hpp>
+#include <Collision/UniformGrid.hpp>
+
+namespace obe::Collision
+{
+    AABB::AABB(double minX, double minY, double maxX, double maxY)
+        : minX(minX)
+        , minY(minY)
+        , maxX(maxX)
+        , maxY(maxY)
+    {
+    }
+
+    bool AABB::intersects(const AABB& other) const
+    {
+        return minX <= other.maxX && maxX >= other.minX && minY <= other.maxY
+            && maxY >= other.minY;
+    }
+
+    bool AABB::contains(const AABB& other) const
+    {
+        return minX <= other.minX && minY <= other.minY && maxX >= other.maxX
+            && maxY >= other.maxY;
+    }
+
+    AABB AABB::merge(const AABB& other) const
+    {
+        return AABB(std::min(minX, other.minX), std::min(minY, other.minY),
+            std::max(maxX, other.maxX), std::max(maxY, other.maxY));
+    }
+
+    AABB AABB::inflate(double x, double y) const
+    {
+        return AABB(minX - x, minY - y, maxX + x, maxY + y);
+    }
+
+    AABB AABB::sweep(double dx, double dy) const
+    {
+        return this->merge(AABB(minX + dx, minY + dy, maxX + dx, maxY + dy));
+    }
+
+    double AABB::getPerimeter() const
+    {
+        return 2.0 * ((maxX - minX) + (maxY - minY));
+    }
+
+    std::unique_ptr<BroadPhase> makeBroadPhase(BroadPhaseType type)
+    {
+        switch (type)
+        {
+        case BroadPhaseType::AABBTree:
+            return std::make_unique<AABBTree>();
+        case BroadPhaseType::UniformGrid:
+            return std::make_unique<UniformGrid>();
+        default:
+            return nullptr;
+        }
+    }
+} // namespace obe::Collision
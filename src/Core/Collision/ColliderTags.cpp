@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <unordered_map>
+
+#include <Collision/ColliderTags.hpp>
+
+namespace obe::Collision
+{
+    namespace
+    {
+        constexpr std::size_t BitsPerWord = 64;
+
+        struct TagRegistryData
+        {
+            std::unordered_map<std::string, TagId> ids;
+            std::vector<std::string> names;
+        };
+
+        TagRegistryData& getRegistryData()
+        {
+            static TagRegistryData data;
+            return data;
+        }
+    }
+
+    TagId TagRegistry::intern(const std::string& tag)
+    {
+        TagRegistryData& data = getRegistryData();
+        const auto [it, inserted] = data.ids.try_emplace(tag, data.names.size());
+        if (inserted)
+            data.names.push_back(tag);
+        return it->second;
+    }
+
+    std::optional<TagId> TagRegistry::find(const std::string& tag)
+    {
+        const TagRegistryData& data = getRegistryData();
+        if (const auto it = data.ids.find(tag); it != data.ids.end())
+            return it->second;
+        return std::nullopt;
+    }
+
+    const std::string& TagRegistry::getName(TagId id)
+    {
+        return getRegistryData().names.at(id);
+    }
+
+    std::size_t TagRegistry::size()
+    {
+        return getRegistryData().names.size();
+    }
+
+    void TagMask::set(TagId id)
+    {
+        if (id < BitsPerWord)
+        {
+            m_bits |= std::uint64_t(1) << id;
+            return;
+        }
+        const std::size_t word = id / BitsPerWord - 1;
+        if (word >= m_extraBits.size())
+            m_extraBits.resize(word + 1, 0);
+        m_extraBits[word] |= std::uint64_t(1) << (id % BitsPerWord);
+    }
+
+    void TagMask::reset(TagId id)
+    {
+        if (id < BitsPerWord)
+        {
+            m_bits &= ~(std::uint64_t(1) << id);
+            return;
+        }
+        const std::size_t word = id / BitsPerWord - 1;
+        if (word < m_extraBits.size())
+            m_extraBits[word] &= ~(std::uint64_t(1) << (id % BitsPerWord));
+    }
+
+    void TagMask::clear()
+    {
+        m_bits = 0;
+        m_extraBits.clear();
+    }
+
+    bool TagMask::test(TagId id) const
+    {
+        if (id < BitsPerWord)
+            return m_bits & (std::uint64_t(1) << id);
+        const std::size_t word = id / BitsPerWord - 1;
+        return word < m_extraBits.size()
+            && (m_extraBits[word] & (std::uint64_t(1) << (id % BitsPerWord)));
+    }
+
+    bool TagMask::empty() const
+    {
+        return m_bits == 0
+            && std::all_of(m_extraBits.begin(), m_extraBits.end(),
+                [](std::uint64_t word) { return word == 0; });
+    }
+
+    bool TagMask::intersects(const TagMask& other) const
+    {
+        if (m_bits & other.m_bits)
+            return true;
+        const std::size_t words = std::min(m_extraBits.size(), other.m_extraBits.size());
+        for (std::size_t i = 0; i < words; i++)
+        {
+            if (m_extraBits[i] & other.m_extraBits[i])
+                return true;
+        }
+        return false;
+    }
+} // namespace obe::Collision
@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <Collision/NarrowPhase.hpp>
+
+namespace obe::Collision
+{
+    // Shapes that are only touching (up to conversion errors) do not collide
+    constexpr double OverlapTolerance = 1e-7;
+
+    void ConvexVertices::clear()
+    {
+        x.clear();
+        y.clear();
+        normalX.clear();
+        normalY.clear();
+    }
+
+    void ConvexVertices::push(double vx, double vy)
+    {
+        x.push_back(vx);
+        y.push_back(vy);
+    }
+
+    void ConvexVertices::computeNormals()
+    {
+        const std::size_t count = x.size();
+        normalX.resize(count);
+        normalY.resize(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const std::size_t next = (i + 1 == count) ? 0 : i + 1;
+            const double edgeX = x[next] - x[i];
+            const double edgeY = y[next] - y[i];
+            const double length = std::sqrt(edgeX * edgeX + edgeY * edgeY);
+            // Degenerated edges are stored with a null normal and skipped later
+            normalX[i] = (length > 0) ? -edgeY / length : 0;
+            normalY[i] = (length > 0) ? edgeX / length : 0;
+        }
+    }
+
+    namespace
+    {
+        /**
+         * \brief Walks the vertices of a polygon (optionally negated) in
+         *        counter-clockwise order, starting from its lowest vertex
+         */
+        class PolygonWalker
+        {
+        private:
+            const ConvexVertices& m_shape;
+            double m_sign;
+            bool m_reversed = false;
+            std::size_t m_start = 0;
+
+        public:
+            PolygonWalker(const ConvexVertices& shape, double sign)
+                : m_shape(shape)
+                , m_sign(sign)
+            {
+                const std::size_t count = shape.size();
+                double area = 0;
+                for (std::size_t i = 0, j = count - 1; i < count; j = i++)
+                {
+                    area += shape.x[j] * shape.y[i] - shape.x[i] * shape.y[j];
+                    const double y = sign * shape.y[i];
+                    const double lowestY = sign * shape.y[m_start];
+                    if (y < lowestY
+                        || (y == lowestY && sign * shape.x[i] < sign * shape.x[m_start]))
+                        m_start = i;
+                }
+                // Negating both coordinates keeps the winding of the polygon
+                m_reversed = area < 0;
+            }
+
+            [[nodiscard]] double x(std::size_t k) const
+            {
+                return m_sign * m_shape.x[this->index(k)];
+            }
+
+            [[nodiscard]] double y(std::size_t k) const
+            {
+                return m_sign * m_shape.y[this->index(k)];
+            }
+
+            [[nodiscard]] std::size_t index(std::size_t k) const
+            {
+                const std::size_t count = m_shape.size();
+                if (m_reversed)
+                    return (m_start + count - (k % count)) % count;
+                return (m_start + k) % count;
+            }
+        };
+    }
+
+    std::size_t ConvexVertices::size() const
+    {
+        return x.size();
+    }
+
+    bool isConvex(const std::vector<double>& x, const std::vector<double>& y)
+    {
+        const std::size_t count = x.size();
+        if (count < 4)
+            return true;
+        int sign = 0;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const std::size_t next = (i + 1) % count;
+            const std::size_t after = (i + 2) % count;
+            const double turn = (x[next] - x[i]) * (y[after] - y[next])
+                - (y[next] - y[i]) * (x[after] - x[next]);
+            if (turn == 0)
+                continue;
+            const int turnSign = (turn > 0) ? 1 : -1;
+            if (sign == 0)
+                sign = turnSign;
+            else if (sign != turnSign)
+                return false;
+        }
+        return true;
+    }
+
+    bool testSeparatingAxes(const ConvexVertices& first, const ConvexVertices& second,
+        double offsetX, double offsetY, Penetration* result)
+    {
+        if (result)
+            *result = Penetration();
+        if (first.size() == 0 || second.size() == 0)
+            return false;
+
+        double minDepth = std::numeric_limits<double>::max();
+        double bestX = 0;
+        double bestY = 0;
+        bool hasAxis = false;
+
+        const auto testAxesOf = [&](const ConvexVertices& shape) {
+            for (std::size_t axis = 0; axis < shape.normalX.size(); axis++)
+            {
+                const double nx = shape.normalX[axis];
+                const double ny = shape.normalY[axis];
+                if (nx == 0 && ny == 0)
+                    continue;
+                hasAxis = true;
+
+                const double shift = nx * offsetX + ny * offsetY;
+                double firstMin = std::numeric_limits<double>::max();
+                double firstMax = std::numeric_limits<double>::lowest();
+                for (std::size_t i = 0; i < first.x.size(); i++)
+                {
+                    const double projection = nx * first.x[i] + ny * first.y[i];
+                    firstMin = std::min(firstMin, projection);
+                    firstMax = std::max(firstMax, projection);
+                }
+                firstMin += shift;
+                firstMax += shift;
+                double secondMin = std::numeric_limits<double>::max();
+                double secondMax = std::numeric_limits<double>::lowest();
+                for (std::size_t i = 0; i < second.x.size(); i++)
+                {
+                    const double projection = nx * second.x[i] + ny * second.y[i];
+                    secondMin = std::min(secondMin, projection);
+                    secondMax = std::max(secondMax, projection);
+                }
+
+                // Distance to push first along +axis or -axis to separate them
+                const double pushForward = secondMax - firstMin;
+                const double pushBackward = firstMax - secondMin;
+                const double depth = std::min(pushForward, pushBackward);
+                if (depth <= OverlapTolerance)
+                    return false;
+                if (depth < minDepth)
+                {
+                    minDepth = depth;
+                    const double direction = (pushForward < pushBackward) ? 1 : -1;
+                    bestX = nx * direction;
+                    bestY = ny * direction;
+                }
+            }
+            return true;
+        };
+
+        if (!testAxesOf(first) || !testAxesOf(second) || !hasAxis)
+            return false;
+        if (result)
+        {
+            result->colliding = true;
+            result->depth = minDepth;
+            result->normal.set(bestX, bestY);
+        }
+        return true;
+    }
+
+    bool castConvex(const ConvexVertices& first, const ConvexVertices& second,
+        double dx, double dy, ConvexVertices& buffer, ImpactData& impact)
+    {
+        impact = ImpactData();
+        if (first.size() == 0 || second.size() == 0)
+            return false;
+
+        // Minkowski difference (second - first), merging edges sorted by angle
+        const PolygonWalker p(second, 1);
+        const PolygonWalker q(first, -1);
+        const std::size_t n = second.size();
+        const std::size_t m = first.size();
+        buffer.clear();
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < n || j < m)
+        {
+            buffer.push(p.x(i) + q.x(j), p.y(i) + q.y(j));
+            const double cross = (p.x(i + 1) - p.x(i)) * (q.y(j + 1) - q.y(j))
+                - (p.y(i + 1) - p.y(i)) * (q.x(j + 1) - q.x(j));
+            const bool advanceP = cross >= 0 && i < n;
+            const bool advanceQ = cross <= 0 && j < m;
+            if (advanceP)
+                i++;
+            if (advanceQ)
+                j++;
+            // Rounding errors can prevent both from advancing, force progress
+            if (!advanceP && !advanceQ && i < n)
+                i++;
+            else if (!advanceP && !advanceQ)
+                j++;
+        }
+
+        const std::size_t count = buffer.size();
+        const auto getEdgeNormal = [&buffer, count](std::size_t edge, double& nx,
+                                       double& ny, double& distance) {
+            const std::size_t next = (edge + 1 == count) ? 0 : edge + 1;
+            nx = buffer.y[next] - buffer.y[edge];
+            ny = buffer.x[edge] - buffer.x[next];
+            const double length = std::sqrt(nx * nx + ny * ny);
+            if (length == 0)
+                return false;
+            nx /= length;
+            ny /= length;
+            distance = nx * buffer.x[edge] + ny * buffer.y[edge];
+            return true;
+        };
+
+        if (dx == 0 && dy == 0)
+        {
+            // Without displacement, only touching polygons (origin on the
+            // boundary of the Minkowski difference) block, along the closest edge
+            double closest = std::numeric_limits<double>::max();
+            for (std::size_t edge = 0; edge < count; edge++)
+            {
+                double nx, ny, distance;
+                if (!getEdgeNormal(edge, nx, ny, distance))
+                    continue;
+                if (distance < -OverlapTolerance)
+                    return false;
+                if (distance < closest)
+                {
+                    closest = distance;
+                    impact.normalX = nx;
+                    impact.normalY = ny;
+                }
+            }
+            if (closest > OverlapTolerance)
+            {
+                impact = ImpactData();
+                return false;
+            }
+            impact.time = 0;
+            return true;
+        }
+
+        // Clip the ray origin + t * (dx, dy) against every edge (Cyrus-Beck)
+        double enterTime = std::numeric_limits<double>::lowest();
+        double exitTime = std::numeric_limits<double>::max();
+        double enterX = 0;
+        double enterY = 0;
+        for (std::size_t edge = 0; edge < count; edge++)
+        {
+            double nx, ny, distance;
+            if (!getEdgeNormal(edge, nx, ny, distance))
+                continue;
+            const double speed = nx * dx + ny * dy;
+            if (std::abs(speed) <= std::numeric_limits<double>::epsilon())
+            {
+                if (distance < 0)
+                    return false;
+                continue;
+            }
+            const double time = distance / speed;
+            if (speed < 0 && time > enterTime)
+            {
+                enterTime = time;
+                enterX = nx;
+                enterY = ny;
+            }
+            else if (speed > 0)
+                exitTime = std::min(exitTime, time);
+        }
+
+        const double travel = std::sqrt(dx * dx + dy * dy);
+        // Rays grazing a corner of the Minkowski difference are only touching
+        if ((exitTime - enterTime) * travel <= OverlapTolerance || exitTime < 0
+            || enterTime > 1)
+            return false;
+        if (enterTime < 0)
+        {
+            // Already overlapping, only touching contacts block the movement
+            if (-enterTime * travel > OverlapTolerance)
+                return false;
+            enterTime = 0;
+        }
+        impact.time = enterTime;
+        impact.normalX = enterX;
+        impact.normalY = enterY;
+        return true;
+    }
+} // namespace obe::Collision
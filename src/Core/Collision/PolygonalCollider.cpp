@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <cmath>
 
+#include <Collision/AABBTree.hpp>
 #include <Collision/PolygonalCollider.hpp>
 #include <Debug/Logger.hpp>
 #include <Graphics/DrawUtils.hpp>
@@ -65,10 +67,23 @@ namespace obe::Collision
         return fullHull;
     }
 
+    BroadPhase& PolygonalCollider::GetDefaultBroadPhase()
+    {
+        static AABBTree defaultBroadPhase;
+        return defaultBroadPhase;
+    }
+
     PolygonalCollider::PolygonalCollider(const std::string& id)
         : Selectable(false)
         , Component(id)
     {
+        this->attachBroadPhase(nullptr);
+    }
+
+    PolygonalCollider::~PolygonalCollider()
+    {
+        if (m_proxy != NullProxy)
+            m_broadPhase->remove(m_proxy);
     }
 
     std::string_view PolygonalCollider::type() const
@@ -80,6 +95,88 @@ namespace obe::Collision
     {
     }
 
+    void PolygonalCollider::onPointsChanged()
+    {
+        if (m_points.empty())
+        {
+            if (m_proxy != NullProxy)
+                m_broadPhase->remove(m_proxy);
+            m_proxy = NullProxy;
+        }
+        else if (m_proxy == NullProxy)
+            m_proxy = m_broadPhase->insert(*this, this->getBounds());
+        else
+            m_broadPhase->update(m_proxy, this->getBounds());
+    }
+
+    void PolygonalCollider::attachBroadPhase(BroadPhase* broadPhase)
+    {
+        if (m_proxy != NullProxy)
+            m_broadPhase->remove(m_proxy);
+        m_proxy = NullProxy;
+        m_broadPhase = broadPhase ? broadPhase : &GetDefaultBroadPhase();
+        this->onPointsChanged();
+    }
+
+    BroadPhase* PolygonalCollider::getBroadPhase() const
+    {
+        if (m_broadPhase == &GetDefaultBroadPhase())
+            return nullptr;
+        return m_broadPhase;
+    }
+
+    AABB PolygonalCollider::getBounds() const
+    {
+        if (m_points.empty())
+            return AABB();
+        AABB bounds(m_points[0]->x, m_points[0]->y, m_points[0]->x, m_points[0]->y);
+        for (const auto& point : m_points)
+        {
+            bounds.minX = std::min(bounds.minX, point->x);
+            bounds.minY = std::min(bounds.minY, point->y);
+            bounds.maxX = std::max(bounds.maxX, point->x);
+            bounds.maxY = std::max(bounds.maxY, point->y);
+        }
+        return bounds;
+    }
+
+    const ConvexVertices& PolygonalCollider::getConvexVertices() const
+    {
+        const Transform::PolygonVertices& vertices = this->getVertices();
+        if (vertices.revision == m_hullRevision)
+            return m_hull;
+
+        m_hull.clear();
+        if (isConvex(vertices.x, vertices.y))
+        {
+            m_hull.x = vertices.x;
+            m_hull.y = vertices.y;
+        }
+        else
+        {
+            std::vector<Transform::UnitVector> points;
+            points.reserve(vertices.x.size());
+            for (std::size_t i = 0; i < vertices.x.size(); i++)
+                points.emplace_back(vertices.x[i], vertices.y[i]);
+            for (const Transform::UnitVector& point : convexHull(points))
+                m_hull.push(point.x, point.y);
+        }
+        m_hull.computeNormals();
+        m_hullRevision = vertices.revision;
+        return m_hull;
+    }
+
+    const std::vector<PolygonalCollider*>& PolygonalCollider::getCollisionCandidates(
+        const Transform::UnitVector& offset,
+        std::vector<PolygonalCollider*>& candidates) const
+    {
+        if (m_proxy == NullProxy)
+            return candidates;
+        const Transform::UnitVector tOffset = offset.to<Transform::Units::SceneUnits>();
+        m_broadPhase->query(this->getBounds().sweep(tOffset.x, tOffset.y), candidates);
+        return candidates;
+    }
+
     CollisionData PolygonalCollider::getMaximumDistanceBeforeCollision(
         const Transform::UnitVector& offset) const
     {
@@ -87,16 +184,17 @@ namespace obe::Collision
         CollisionData collData;
         collData.offset = offset;
 
-        for (auto& collider : Pool)
+        std::vector<PolygonalCollider*> candidates;
+        for (auto& collider : this->getCollisionCandidates(offset, candidates))
         {
-            if (checkTags(*collider))
+            if (collider != this && checkTags(*collider))
             {
                 const Transform::UnitVector maxDist
                     = this->getMaximumDistanceBeforeCollision(*collider, offset);
                 // Debug::Log->warn("Maximum distance before collision from {}
                 // with {} is ({}, {})", this->getId(), collider->getId(),
                 // maxDist.x, maxDist.y);
-                if (maxDist != offset && collider != this)
+                if (maxDist != offset)
                 {
                     limitedMaxDistances.push_back(maxDist);
                     collData.colliders.push_back(collider);
@@ -104,8 +202,11 @@ namespace obe::Collision
             }
         }
 
+        const Transform::PolygonVertices& vertices = this->getVertices();
         const Transform::UnitVector destPos
-            = (this->getCentroid() + offset).to<Transform::Units::ScenePixels>();
+            = Transform::UnitVector(vertices.centroidX, vertices.centroidY,
+                  Transform::Units::ScenePixels)
+            + offset.to<Transform::Units::ScenePixels>();
         if (!limitedMaxDistances.empty())
         {
             std::pair<double, Transform::UnitVector> minDist(-1, Transform::UnitVector());
@@ -137,7 +238,10 @@ namespace obe::Collision
     void PolygonalCollider::addTag(ColliderTagType tagType, const std::string& tag)
     {
         if (!Utils::Vector::contains(tag, m_tags.at(tagType)))
+        {
             m_tags.at(tagType).push_back(tag);
+            m_tagMasks[static_cast<std::size_t>(tagType)].set(TagRegistry::intern(tag));
+        }
         else
             Debug::Log->warn("<PolygonalCollider> Tag '{0}' is already in "
                              "PolygonalCollider '{1}'",
@@ -147,13 +251,15 @@ namespace obe::Collision
     void PolygonalCollider::clearTags(ColliderTagType tagType)
     {
         m_tags.at(tagType).clear();
+        m_tagMasks[static_cast<std::size_t>(tagType)].clear();
     }
 
     CollisionData PolygonalCollider::doesCollide(const Transform::UnitVector& offset) const
     {
         CollisionData collData;
         collData.offset = offset;
-        for (auto& collider : Pool)
+        std::vector<PolygonalCollider*> candidates;
+        for (auto& collider : this->getCollisionCandidates(offset, candidates))
         {
             if (collider != this && checkTags(*collider))
             {
@@ -167,30 +273,76 @@ namespace obe::Collision
         return collData;
     }
 
+    CastResult PolygonalCollider::castCollider(const Transform::UnitVector& offset) const
+    {
+        const Transform::UnitVector pxOffset
+            = offset.to<Transform::Units::ScenePixels>();
+        CastResult result;
+        result.offset = pxOffset;
+
+        ImpactData impact;
+        ImpactData closestImpact;
+        std::vector<PolygonalCollider*> candidates;
+        for (auto& collider : this->getCollisionCandidates(offset, candidates))
+        {
+            if (collider != this && checkTags(*collider)
+                && castConvex(this->getConvexVertices(), collider->getConvexVertices(),
+                    pxOffset.x, pxOffset.y, m_castBuffer, impact)
+                && (!result.collider || impact.time < closestImpact.time))
+            {
+                result.collider = collider;
+                closestImpact = impact;
+            }
+        }
+
+        if (result.collider)
+        {
+            result.timeOfImpact = closestImpact.time;
+            result.normal.set(closestImpact.normalX, closestImpact.normalY);
+            result.offset.set(
+                pxOffset.x * closestImpact.time, pxOffset.y * closestImpact.time);
+            const double remainingX = pxOffset.x - result.offset.x;
+            const double remainingY = pxOffset.y - result.offset.y;
+            const double along
+                = remainingX * closestImpact.normalX + remainingY * closestImpact.normalY;
+            result.slide.set(remainingX - along * closestImpact.normalX,
+                remainingY - along * closestImpact.normalY);
+        }
+        return result;
+    }
+
     void PolygonalCollider::removeTag(ColliderTagType tagType, const std::string& tag)
     {
-        std::vector<std::string>& tags = m_tags.at(ColliderTagType::Tag);
+        std::vector<std::string>& tags = m_tags.at(tagType);
         tags.erase(std::remove(tags.begin(), tags.end(), tag), tags.end());
+        if (const auto id = TagRegistry::find(tag))
+            m_tagMasks[static_cast<std::size_t>(tagType)].reset(*id);
     }
 
     bool PolygonalCollider::doesHaveTag(ColliderTagType tagType, const std::string& tag)
     {
-        return Utils::Vector::contains(tag, m_tags.at(tagType));
+        const auto id = TagRegistry::find(tag);
+        return id && m_tagMasks[static_cast<std::size_t>(tagType)].test(*id);
     }
 
     bool PolygonalCollider::doesHaveAnyTag(
         ColliderTagType tagType, const std::vector<std::string>& tags) const
     {
-        if (m_tags.size() == 0)
-            return false;
+        const TagMask& mask = m_tagMasks[static_cast<std::size_t>(tagType)];
         for (const std::string& tag : tags)
         {
-            if (Utils::Vector::contains(tag, m_tags.at(tagType)))
+            const auto id = TagRegistry::find(tag);
+            if (id && mask.test(*id))
                 return true;
         }
         return false;
     }
 
+    const TagMask& PolygonalCollider::getTagMask(ColliderTagType tagType) const
+    {
+        return m_tagMasks[static_cast<std::size_t>(tagType)];
+    }
+
     std::vector<std::string> PolygonalCollider::getAllTags(ColliderTagType tagType) const
     {
         return m_tags.at(tagType);
@@ -203,51 +355,41 @@ namespace obe::Collision
         const Transform::UnitVector tOffset = offset.to(pxUnit);
         bool inFront = false;
         Transform::UnitVector minDep;
-        const auto calcMinDistanceDep = [this](const Transform::PolygonPath& sol1,
-                                            const Transform::PolygonPath& sol2,
+        const auto calcMinDistanceDep = [](const Transform::PolygonVertices& sol1,
+                                            const Transform::PolygonVertices& sol2,
                                             const Transform::UnitVector& tOffset)
             -> std::tuple<double, Transform::UnitVector, bool> {
             double minDistance = -1;
             bool inFront = false;
 
-            const Transform::Units pxUnit = Transform::Units::ScenePixels;
-            Transform::UnitVector minDisplacement(pxUnit);
-            Transform::UnitVector point1(pxUnit);
-            Transform::UnitVector point2(pxUnit);
-            Transform::UnitVector point3(pxUnit);
-            Transform::UnitVector s1(pxUnit);
-            for (auto& currentPoint : sol1)
+            Transform::UnitVector minDisplacement(Transform::Units::ScenePixels);
+            const std::size_t sol2Size = sol2.x.size();
+            for (std::size_t point = 0; point < sol1.x.size(); point++)
             {
-                const Transform::UnitVector point0 = currentPoint->to(pxUnit);
-                for (int i = 0; i < sol2.size(); i++)
+                const double point0X = sol1.x[point];
+                const double point0Y = sol1.y[point];
+                for (std::size_t i = 0; i < sol2Size; i++)
                 {
-                    point1 = point0 + tOffset;
-                    point2 = sol2[i]->to(pxUnit);
-                    point3 = sol2[(i == sol2.size() - 1) ? 0 : i + 1]->to(pxUnit);
-
-                    s1 = point1 - point0;
-                    const Transform::UnitVector s2 = point3 - point2;
+                    const std::size_t next = (i == sol2Size - 1) ? 0 : i + 1;
+                    const double s2X = sol2.x[next] - sol2.x[i];
+                    const double s2Y = sol2.y[next] - sol2.y[i];
+                    const double deltaX = point0X - sol2.x[i];
+                    const double deltaY = point0Y - sol2.y[i];
 
+                    const double denominator = -s2X * tOffset.y + tOffset.x * s2Y;
                     const double s
-                        = (-s1.y * (point0.x - point2.x) + s1.x * (point0.y - point2.y))
-                        / (-s2.x * s1.y + s1.x * s2.y);
-                    const double t
-                        = (s2.x * (point0.y - point2.y) - s2.y * (point0.x - point2.x))
-                        / (-s2.x * s1.y + s1.x * s2.y);
+                        = (-tOffset.y * deltaX + tOffset.x * deltaY) / denominator;
+                    const double t = (s2X * deltaY - s2Y * deltaX) / denominator;
 
                     if (s >= 0 && s <= 1 && t >= 0 && t <= 1)
                     {
                         inFront = true;
-                        const Transform::UnitVector ip
-                            = point0 + (s1 * Transform::UnitVector(t, t, s1.unit));
-
-                        const double distance = std::sqrt(std::pow((point0.x - ip.x), 2)
-                            + std::pow((point0.y - ip.y), 2));
+                        const double xComp = t * tOffset.x;
+                        const double yComp = t * tOffset.y;
+                        const double distance = std::sqrt(xComp * xComp + yComp * yComp);
                         if (distance < minDistance || minDistance == -1)
                         {
                             minDistance = distance;
-                            const double xComp = t * s1.x;
-                            const double yComp = t * s1.y;
                             minDisplacement.set(
                                 (xComp > 0) ? std::floor(xComp) : std::ceil(xComp),
                                 (yComp > 0) ? std::floor(yComp) : std::ceil(yComp));
@@ -257,8 +399,8 @@ namespace obe::Collision
             }
             return std::make_tuple(minDistance, minDisplacement, inFront);
         };
-        const Transform::PolygonPath& fPath = m_points;
-        const Transform::PolygonPath& sPath = collider.getAllPoints();
+        const Transform::PolygonVertices& fPath = this->getVertices();
+        const Transform::PolygonVertices& sPath = collider.getVertices();
 
         auto tdm1 = calcMinDistanceDep(fPath, sPath, tOffset);
         auto tdm2 = calcMinDistanceDep(
@@ -286,42 +428,21 @@ namespace obe::Collision
     bool PolygonalCollider::doesCollide(
         PolygonalCollider& collider, const Transform::UnitVector& offset) const
     {
-        std::vector<Transform::UnitVector> pSet1;
-        pSet1.reserve(m_points.size());
-        std::vector<Transform::UnitVector> pSet2;
-        pSet2.reserve(m_points.size());
+        const Transform::UnitVector pxOffset
+            = offset.to<Transform::Units::ScenePixels>();
+        return testSeparatingAxes(this->getConvexVertices(),
+            collider.getConvexVertices(), pxOffset.x, pxOffset.y);
+    }
 
-        for (const auto& point : m_points)
-            pSet1.push_back(*point);
-        for (const auto& point : collider.getAllPoints())
-            pSet2.push_back(*point);
-        for (auto& applyOffset : pSet1)
-            applyOffset += offset;
-        const auto pointInPolygon = [](const std::vector<Transform::UnitVector>& poly,
-                                        Transform::UnitVector& pTest) -> bool {
-            int i, j, c = 0;
-            const int nPt = poly.size();
-            for (i = 0, j = nPt - 1; i < nPt; j = i++)
-            {
-                if (((poly[i].y > pTest.y) != (poly[j].y > pTest.y))
-                    && (pTest.x < (poly[j].x - poly[i].x) * (pTest.y - poly[i].y)
-                                / (poly[j].y - poly[i].y)
-                            + poly[i].x))
-                    c = !c;
-            }
-            return c;
-        };
-        for (Transform::UnitVector& pTest : pSet1)
-        {
-            if (pointInPolygon(pSet2, pTest))
-                return true;
-        }
-        for (auto& pTest : pSet2)
-        {
-            if (pointInPolygon(pSet1, pTest))
-                return true;
-        }
-        return false;
+    Penetration PolygonalCollider::getPenetration(
+        PolygonalCollider& collider, const Transform::UnitVector& offset) const
+    {
+        const Transform::UnitVector pxOffset
+            = offset.to<Transform::Units::ScenePixels>();
+        Penetration penetration;
+        testSeparatingAxes(this->getConvexVertices(), collider.getConvexVertices(),
+            pxOffset.x, pxOffset.y, &penetration);
+        return penetration;
     }
 
     vili::node PolygonalCollider::dump() const
@@ -376,12 +497,11 @@ namespace obe::Collision
 
     bool PolygonalCollider::checkTags(const PolygonalCollider& collider) const
     {
-        if (this->doesHaveAnyTag(
-                ColliderTagType::Rejected, collider.getAllTags(ColliderTagType::Tag)))
+        const TagMask& tags = collider.getTagMask(ColliderTagType::Tag);
+        if (this->getTagMask(ColliderTagType::Rejected).intersects(tags))
             return false;
-        if (!m_tags.at(ColliderTagType::Accepted).empty()
-            && !this->doesHaveAnyTag(
-                ColliderTagType::Accepted, collider.getAllTags(ColliderTagType::Tag)))
+        const TagMask& accepted = this->getTagMask(ColliderTagType::Accepted);
+        if (!accepted.empty() && !accepted.intersects(tags))
             return false;
         return true;
     }
@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Collision/UniformGrid.hpp>
+
+namespace obe::Collision
+{
+    bool UniformGrid::CellRange::operator==(const CellRange& other) const
+    {
+        return minX == other.minX && minY == other.minY && maxX == other.maxX
+            && maxY == other.maxY;
+    }
+
+    std::size_t UniformGrid::CellRange::getCellCount() const
+    {
+        if (maxX < minX || maxY < minY)
+            return 0;
+        return static_cast<std::size_t>((maxX - minX + 1) * (maxY - minY + 1));
+    }
+
+    UniformGrid::UniformGrid(double cellSize)
+        : m_cellSize(cellSize)
+    {
+    }
+
+    UniformGrid::CellRange UniformGrid::getCellRange(const AABB& bounds) const
+    {
+        CellRange range;
+        range.minX = static_cast<std::int64_t>(std::floor(bounds.minX / m_cellSize));
+        range.minY = static_cast<std::int64_t>(std::floor(bounds.minY / m_cellSize));
+        range.maxX = static_cast<std::int64_t>(std::floor(bounds.maxX / m_cellSize));
+        range.maxY = static_cast<std::int64_t>(std::floor(bounds.maxY / m_cellSize));
+        return range;
+    }
+
+    std::uint64_t UniformGrid::getCellKey(std::int64_t x, std::int64_t y)
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32)
+            | static_cast<std::uint32_t>(y);
+    }
+
+    void UniformGrid::addToCells(ProxyId proxy, const CellRange& cells)
+    {
+        if (cells.getCellCount() > MaxCellsPerProxy)
+        {
+            m_largeProxies.push_back(proxy);
+            return;
+        }
+        for (std::int64_t x = cells.minX; x <= cells.maxX; x++)
+        {
+            for (std::int64_t y = cells.minY; y <= cells.maxY; y++)
+                m_cells[getCellKey(x, y)].push_back(proxy);
+        }
+    }
+
+    void UniformGrid::removeFromCells(ProxyId proxy, const CellRange& cells)
+    {
+        const auto removeFrom = [proxy](std::vector<ProxyId>& content) {
+            const auto it = std::find(content.begin(), content.end(), proxy);
+            if (it != content.end())
+            {
+                *it = content.back();
+                content.pop_back();
+            }
+        };
+        if (cells.getCellCount() > MaxCellsPerProxy)
+        {
+            removeFrom(m_largeProxies);
+            return;
+        }
+        for (std::int64_t x = cells.minX; x <= cells.maxX; x++)
+        {
+            for (std::int64_t y = cells.minY; y <= cells.maxY; y++)
+            {
+                const auto cell = m_cells.find(getCellKey(x, y));
+                if (cell == m_cells.end())
+                    continue;
+                removeFrom(cell->second);
+                if (cell->second.empty())
+                    m_cells.erase(cell);
+            }
+        }
+    }
+
+    ProxyId UniformGrid::insert(PolygonalCollider& collider, const AABB& bounds)
+    {
+        ProxyId proxy;
+        if (m_freeList != NullProxy)
+        {
+            proxy = m_freeList;
+            m_freeList = m_proxies[proxy].nextFree;
+        }
+        else
+        {
+            proxy = static_cast<ProxyId>(m_proxies.size());
+            m_proxies.emplace_back();
+            m_queryStamps.push_back(0);
+        }
+        Proxy& newProxy = m_proxies[proxy];
+        newProxy.collider = &collider;
+        newProxy.bounds = bounds;
+        newProxy.cells = this->getCellRange(bounds);
+        newProxy.nextFree = NullProxy;
+        this->addToCells(proxy, newProxy.cells);
+        m_proxyCount++;
+        return proxy;
+    }
+
+    bool UniformGrid::update(ProxyId proxy, const AABB& bounds)
+    {
+        Proxy& current = m_proxies[proxy];
+        current.bounds = bounds;
+        const CellRange newCells = this->getCellRange(bounds);
+        if (newCells == current.cells)
+            return false;
+        // Large colliders stay in the same list whatever their cells are
+        if (current.cells.getCellCount() > MaxCellsPerProxy
+            && newCells.getCellCount() > MaxCellsPerProxy)
+        {
+            current.cells = newCells;
+            return false;
+        }
+        this->removeFromCells(proxy, current.cells);
+        this->addToCells(proxy, newCells);
+        current.cells = newCells;
+        return true;
+    }
+
+    void UniformGrid::remove(ProxyId proxy)
+    {
+        Proxy& current = m_proxies[proxy];
+        this->removeFromCells(proxy, current.cells);
+        current = Proxy();
+        current.nextFree = m_freeList;
+        m_freeList = proxy;
+        m_proxyCount--;
+    }
+
+    void UniformGrid::query(
+        const AABB& area, std::vector<PolygonalCollider*>& result) const
+    {
+        if (++m_currentStamp == 0)
+        {
+            std::fill(m_queryStamps.begin(), m_queryStamps.end(), 0);
+            m_currentStamp = 1;
+        }
+        const auto visit = [&](const std::vector<ProxyId>& content) {
+            for (const ProxyId proxy : content)
+            {
+                if (m_queryStamps[proxy] == m_currentStamp)
+                    continue;
+                m_queryStamps[proxy] = m_currentStamp;
+                if (m_proxies[proxy].bounds.intersects(area))
+                    result.push_back(m_proxies[proxy].collider);
+            }
+        };
+
+        visit(m_largeProxies);
+        const CellRange cells = this->getCellRange(area);
+        // Very large areas are cheaper to resolve by walking the occupied cells
+        if (cells.getCellCount() > m_cells.size())
+        {
+            for (const auto& [key, content] : m_cells)
+                visit(content);
+            return;
+        }
+        for (std::int64_t x = cells.minX; x <= cells.maxX; x++)
+        {
+            for (std::int64_t y = cells.minY; y <= cells.maxY; y++)
+            {
+                const auto cell = m_cells.find(getCellKey(x, y));
+                if (cell != m_cells.end())
+                    visit(cell->second);
+            }
+        }
+    }
+
+    std::size_t UniformGrid::size() const
+    {
+        return m_proxyCount;
+    }
+
+    BroadPhaseType UniformGrid::getType() const
+    {
+        return BroadPhaseType::UniformGrid;
+    }
+
+    double UniformGrid::getCellSize() const
+    {
+        return m_cellSize;
+    }
+} // namespace obe::Collision
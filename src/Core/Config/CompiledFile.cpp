@@ -0,0 +1,403 @@
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include <Config/CompiledFile.hpp>
+#include <Config/Exceptions.hpp>
+#include <Debug/Logger.hpp>
+#include <Utils/FileUtils.hpp>
+
+#include <fswrapper/fswrapper.hpp>
+#include <vili/parser/parser.hpp>
+
+namespace obe::Config
+{
+    namespace
+    {
+        constexpr char Magic[4] = { 'O', 'B', 'E', 'C' };
+        constexpr std::size_t HeaderSize = 16;
+        constexpr std::size_t NodeSize = 16;
+        constexpr std::uint32_t NoKey = 0xFFFFFFFF;
+
+        // Offsets of the fields of a node
+        constexpr std::size_t TypeField = 0;
+        constexpr std::size_t KeyField = 4;
+        constexpr std::size_t ValueField = 8;
+        // Containers store their first child and their amount of children in
+        // the value field
+        constexpr std::size_t FirstChildField = 8;
+        constexpr std::size_t ChildrenField = 12;
+
+        std::uint32_t readUInt32(const char* data)
+        {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+            return static_cast<std::uint32_t>(bytes[0])
+                | static_cast<std::uint32_t>(bytes[1]) << 8
+                | static_cast<std::uint32_t>(bytes[2]) << 16
+                | static_cast<std::uint32_t>(bytes[3]) << 24;
+        }
+
+        std::uint64_t readUInt64(const char* data)
+        {
+            return static_cast<std::uint64_t>(readUInt32(data))
+                | static_cast<std::uint64_t>(readUInt32(data + 4)) << 32;
+        }
+
+        void writeUInt32(std::string& output, std::uint32_t value)
+        {
+            for (int shift = 0; shift < 32; shift += 8)
+                output.push_back(static_cast<char>((value >> shift) & 0xFF));
+        }
+
+        void writeUInt64(std::string& output, std::uint64_t value)
+        {
+            writeUInt32(output, static_cast<std::uint32_t>(value));
+            writeUInt32(output, static_cast<std::uint32_t>(value >> 32));
+        }
+
+        bool isNewer(const std::string& path, const std::string& reference)
+        {
+            // Compared with the full precision of the file system, a vili file
+            // saved in the same second as its compiled version is still newer
+            std::error_code pathError;
+            std::error_code referenceError;
+            const auto pathTime = std::filesystem::last_write_time(path, pathError);
+            const auto referenceTime
+                = std::filesystem::last_write_time(reference, referenceError);
+            return !pathError && !referenceError && pathTime > referenceTime;
+        }
+    }
+
+    CompiledNode::CompiledNode(const CompiledFile& file, std::uint32_t index)
+        : m_file(&file)
+        , m_record(file.m_nodes + static_cast<std::size_t>(index) * NodeSize)
+    {
+    }
+
+    vili::node_type CompiledNode::getType() const
+    {
+        return static_cast<vili::node_type>(m_record[TypeField]);
+    }
+
+    std::string_view CompiledNode::getKey() const
+    {
+        const std::uint32_t key = readUInt32(m_record + KeyField);
+        if (key == NoKey)
+            return std::string_view();
+        const char* string = m_file->m_strings + key;
+        return std::string_view(string + 4, readUInt32(string));
+    }
+
+    std::size_t CompiledNode::size() const
+    {
+        const vili::node_type type = this->getType();
+        if (type != vili::node_type::array && type != vili::node_type::object)
+            return 0;
+        return readUInt32(m_record + ChildrenField);
+    }
+
+    CompiledNode CompiledNode::getChild(std::size_t index) const
+    {
+        return CompiledNode(*m_file,
+            readUInt32(m_record + FirstChildField) + static_cast<std::uint32_t>(index));
+    }
+
+    vili::integer CompiledNode::asInteger() const
+    {
+        return static_cast<vili::integer>(readUInt64(m_record + ValueField));
+    }
+
+    vili::number CompiledNode::asNumber() const
+    {
+        const std::uint64_t bits = readUInt64(m_record + ValueField);
+        vili::number value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    vili::boolean CompiledNode::asBoolean() const
+    {
+        return readUInt64(m_record + ValueField) != 0;
+    }
+
+    std::string_view CompiledNode::asString() const
+    {
+        const char* string = m_file->m_strings + readUInt32(m_record + ValueField);
+        return std::string_view(string + 4, readUInt32(string));
+    }
+
+    vili::node CompiledNode::toNode() const
+    {
+        vili::node node;
+        this->build(node);
+        return node;
+    }
+
+    void CompiledNode::build(vili::node& node) const
+    {
+        // Children are built in place, inserting built nodes in vili objects
+        // copies them
+        vili::node_data& data = node.data();
+        switch (this->getType())
+        {
+        case vili::node_type::string:
+            data = std::string(this->asString());
+            break;
+        case vili::node_type::integer:
+            data = this->asInteger();
+            break;
+        case vili::node_type::number:
+            data = this->asNumber();
+            break;
+        case vili::node_type::boolean:
+            data = this->asBoolean();
+            break;
+        case vili::node_type::array:
+        {
+            data = vili::array(this->size());
+            vili::array& elements = std::get<vili::array>(data);
+            for (std::size_t i = 0; i < elements.size(); i++)
+                this->getChild(i).build(elements[i]);
+            break;
+        }
+        case vili::node_type::object:
+        {
+            data = vili::object {};
+            vili::object& items = std::get<vili::object>(data);
+            for (std::size_t i = 0; i < this->size(); i++)
+            {
+                const CompiledNode child = this->getChild(i);
+                child.build(items[std::string(child.getKey())]);
+            }
+            break;
+        }
+        default:
+            data = std::monostate {};
+        }
+    }
+
+    CompiledFile::CompiledFile(const std::string& path)
+        : m_file(path)
+    {
+        const char* data = m_file.getData();
+        if (m_file.getSize() < HeaderSize)
+            throw Exceptions::InvalidCompiledFile(path, "file is truncated", EXC_INFO);
+        if (std::memcmp(data, Magic, sizeof(Magic)) != 0)
+            throw Exceptions::InvalidCompiledFile(
+                path, "file is not a compiled vili file", EXC_INFO);
+        const std::uint32_t version = readUInt32(data + 4);
+        if (version != CompiledFileVersion)
+        {
+            throw Exceptions::InvalidCompiledFile(path,
+                fmt::format("file has version {} instead of {}", version,
+                    CompiledFileVersion),
+                EXC_INFO);
+        }
+        m_nodeCount = readUInt32(data + 8);
+        m_stringsSize = readUInt32(data + 12);
+        const std::uint64_t expectedSize = HeaderSize
+            + static_cast<std::uint64_t>(m_nodeCount) * NodeSize + m_stringsSize;
+        if (m_nodeCount == 0 || expectedSize != m_file.getSize())
+            throw Exceptions::InvalidCompiledFile(path, "file is truncated", EXC_INFO);
+        m_nodes = data + HeaderSize;
+        m_strings = m_nodes + static_cast<std::size_t>(m_nodeCount) * NodeSize;
+        this->validate();
+    }
+
+    void CompiledFile::validate() const
+    {
+        // Checked once so nodes can be read without bounds checks
+        const auto isValidString = [this](std::uint32_t offset) {
+            return offset <= m_stringsSize && m_stringsSize - offset >= 4
+                && m_stringsSize - offset - 4 >= readUInt32(m_strings + offset);
+        };
+        for (std::uint32_t index = 0; index < m_nodeCount; index++)
+        {
+            const char* record = m_nodes + static_cast<std::size_t>(index) * NodeSize;
+            const std::uint32_t key = readUInt32(record + KeyField);
+            bool valid = (key == NoKey || isValidString(key));
+            switch (static_cast<vili::node_type>(record[TypeField]))
+            {
+            case vili::node_type::null:
+            case vili::node_type::integer:
+            case vili::node_type::number:
+            case vili::node_type::boolean:
+                break;
+            case vili::node_type::string:
+                valid = valid && isValidString(readUInt32(record + ValueField));
+                break;
+            case vili::node_type::array:
+            case vili::node_type::object:
+            {
+                // Children placed after their parent so the tree has no cycle
+                const std::uint32_t first = readUInt32(record + FirstChildField);
+                const std::uint32_t children = readUInt32(record + ChildrenField);
+                valid = valid && first > index && first <= m_nodeCount
+                    && children <= m_nodeCount - first;
+                break;
+            }
+            default:
+                valid = false;
+            }
+            if (!valid)
+            {
+                throw Exceptions::InvalidCompiledFile(m_file.getPath(),
+                    fmt::format("node {} is corrupted", index), EXC_INFO);
+            }
+        }
+    }
+
+    const std::string& CompiledFile::getPath() const
+    {
+        return m_file.getPath();
+    }
+
+    std::size_t CompiledFile::getNodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+    CompiledNode CompiledFile::getRoot() const
+    {
+        return CompiledNode(*this, 0);
+    }
+
+    std::string CompileNode(const vili::node& data)
+    {
+        struct Entry
+        {
+            const vili::node* node;
+            std::uint32_t key;
+        };
+        std::string strings;
+        std::unordered_map<std::string, std::uint32_t> stringOffsets;
+        const auto addString = [&](const std::string& value) {
+            const auto [offset, added] = stringOffsets.emplace(
+                value, static_cast<std::uint32_t>(strings.size()));
+            if (added)
+            {
+                writeUInt32(strings, static_cast<std::uint32_t>(value.size()));
+                strings += value;
+            }
+            return offset->second;
+        };
+
+        // Nodes are written breadth first so the children of a node are
+        // contiguous
+        std::vector<Entry> entries = { { &data, NoKey } };
+        std::string nodes;
+        for (std::size_t index = 0; index < entries.size(); index++)
+        {
+            const vili::node& node = *entries[index].node;
+            std::uint64_t value = 0;
+            switch (node.type())
+            {
+            case vili::node_type::string:
+                value = addString(node);
+                break;
+            case vili::node_type::integer:
+                value = static_cast<std::uint64_t>(node.as<vili::integer>());
+                break;
+            case vili::node_type::number:
+            {
+                const vili::number number = node.as<vili::number>();
+                std::memcpy(&value, &number, sizeof(value));
+                break;
+            }
+            case vili::node_type::boolean:
+                value = node.as<vili::boolean>();
+                break;
+            case vili::node_type::array:
+                value = entries.size() | static_cast<std::uint64_t>(node.size()) << 32;
+                for (std::size_t i = 0; i < node.size(); i++)
+                    entries.push_back({ &node.at(i), NoKey });
+                break;
+            case vili::node_type::object:
+                value = entries.size() | static_cast<std::uint64_t>(node.size()) << 32;
+                for (const auto& [key, child] : node.items())
+                    entries.push_back({ &child, addString(key) });
+                break;
+            default:
+                break;
+            }
+            nodes.push_back(static_cast<char>(node.type()));
+            nodes.append(3, '\0');
+            writeUInt32(nodes, entries[index].key);
+            writeUInt64(nodes, value);
+        }
+
+        std::string output(Magic, sizeof(Magic));
+        writeUInt32(output, CompiledFileVersion);
+        writeUInt32(output, static_cast<std::uint32_t>(entries.size()));
+        writeUInt32(output, static_cast<std::uint32_t>(strings.size()));
+        output.reserve(output.size() + nodes.size() + strings.size());
+        output += nodes;
+        output += strings;
+        return output;
+    }
+
+    std::string GetCompiledPath(const std::string& path)
+    {
+        constexpr std::string_view viliExtension = ".vili";
+        if (path.size() >= viliExtension.size()
+            && path.compare(path.size() - viliExtension.size(), viliExtension.size(),
+                   viliExtension)
+                == 0)
+        {
+            return path.substr(0, path.size() - viliExtension.size())
+                + std::string(CompiledFileExtension);
+        }
+        return path + std::string(CompiledFileExtension);
+    }
+
+    std::string FindFile(const System::Path& path)
+    {
+        // The compiled file is looked up on its own so a vili file shipped
+        // only in its compiled version is still found
+        const std::string viliPath = path.toString();
+        const std::string compiledPath = GetCompiledPath(viliPath);
+        const std::string foundCompiled
+            = System::Path(path).set(compiledPath).find(System::PathType::File);
+        if (!foundCompiled.empty())
+        {
+            return foundCompiled.substr(0, foundCompiled.size() - compiledPath.size())
+                + viliPath;
+        }
+        return path.find(System::PathType::File);
+    }
+
+    std::unique_ptr<CompiledFile> OpenCompiledFile(const std::string& path)
+    {
+        const std::string compiledPath = GetCompiledPath(path);
+        if (!Utils::File::fileExists(compiledPath))
+            return nullptr;
+        if (isNewer(path, compiledPath))
+        {
+            Debug::Log->warn("<CompiledFile> '{}' is older than '{}', parsing the "
+                             "vili file instead",
+                compiledPath, path);
+            return nullptr;
+        }
+        try
+        {
+            return std::make_unique<CompiledFile>(compiledPath);
+        }
+        catch (const Exception& e)
+        {
+            Debug::Log->warn("<CompiledFile> Parsing '{}' instead of its compiled "
+                             "version : {}",
+                path, e.what());
+            return nullptr;
+        }
+    }
+
+    vili::node LoadFile(const std::string& path, vili::parser::state templates)
+    {
+        if (const std::unique_ptr<CompiledFile> compiled = OpenCompiledFile(path))
+        {
+            Debug::Log->debug("<CompiledFile> Loading '{}'", compiled->getPath());
+            return compiled->getRoot().toNode();
+        }
+        return vili::parser::from_file(path, std::move(templates));
+    }
+}
@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <fstream>
+
+#include <Debug/Exceptions.hpp>
+#include <Debug/Profiler.hpp>
+
+namespace obe::Debug
+{
+    Profiler EngineProfiler;
+
+    namespace
+    {
+        std::string escapeJson(const std::string& value)
+        {
+            std::string escaped;
+            escaped.reserve(value.size());
+            for (const char character : value)
+            {
+                if (character == '"' || character == '\\')
+                    escaped += '\\';
+                if (static_cast<unsigned char>(character) < 0x20)
+                    escaped += fmt::format("\\u{:04x}", static_cast<int>(character));
+                else
+                    escaped += character;
+            }
+            return escaped;
+        }
+    }
+
+    Profiler::Profiler(std::size_t frameCapacity)
+    {
+        this->setFrameCapacity(frameCapacity);
+    }
+
+    std::int64_t Profiler::now() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - m_epoch)
+            .count();
+    }
+
+    std::vector<const ProfilerFrame*> Profiler::getRecordedFrames() const
+    {
+        std::vector<const ProfilerFrame*> frames;
+        frames.reserve(m_recordedFrames);
+        for (std::size_t age = m_recordedFrames; age > 0; age--)
+            frames.push_back(&this->getFrame(age - 1));
+        return frames;
+    }
+
+    void Profiler::setEnabled(bool enabled)
+    {
+        m_enabled = enabled;
+        if (!m_enabled)
+            m_frame = nullptr;
+    }
+
+    bool Profiler::isEnabled() const
+    {
+        return m_enabled;
+    }
+
+    void Profiler::setFrameCapacity(std::size_t frameCapacity)
+    {
+        // The current frame is kept apart from the complete ones
+        m_frames.assign(std::max<std::size_t>(frameCapacity, 1) + 1, ProfilerFrame());
+        m_currentFrame = 0;
+        m_recordedFrames = 0;
+        m_frame = nullptr;
+    }
+
+    std::size_t Profiler::getFrameCapacity() const
+    {
+        return m_frames.size() - 1;
+    }
+
+    ProfilerZoneId Profiler::getZoneId(const std::string& name)
+    {
+        if (const auto zone = m_zoneIds.find(name); zone != m_zoneIds.end())
+            return zone->second;
+        const auto id = static_cast<ProfilerZoneId>(m_zoneNames.size());
+        m_zoneNames.push_back(name);
+        m_zoneIds.emplace(name, id);
+        return id;
+    }
+
+    const std::string& Profiler::getZoneName(ProfilerZoneId id) const
+    {
+        if (id >= m_zoneNames.size())
+            throw Exceptions::UnknownProfilerZone(id, m_zoneNames.size(), EXC_INFO);
+        return m_zoneNames[id];
+    }
+
+    void Profiler::beginFrame()
+    {
+        if (m_frame)
+            this->endFrame();
+        if (!m_enabled)
+            return;
+        ProfilerFrame& frame = m_frames[m_currentFrame];
+        frame.index = m_frameIndex++;
+        frame.start = this->now();
+        frame.end = frame.start;
+        m_frameStartTicks = ticks();
+        frame.zones.clear();
+        frame.counters.clear();
+        m_depth = 0;
+        m_frame = &frame;
+    }
+
+    void Profiler::endFrame()
+    {
+        if (!m_frame)
+            return;
+        const std::int64_t endTicks = ticks();
+        ProfilerFrame& frame = m_frames[m_currentFrame];
+        frame.end = this->now();
+        // Ticks are calibrated against the Clock over the frame itself
+        const double nanosecondsPerTick = (endTicks > m_frameStartTicks)
+            ? static_cast<double>(frame.end - frame.start)
+                / static_cast<double>(endTicks - m_frameStartTicks)
+            : 1.0;
+        const auto toNanoseconds = [&](std::int64_t tick) -> std::int64_t {
+            return frame.start
+                + static_cast<std::int64_t>(
+                    static_cast<double>(tick - m_frameStartTicks) * nanosecondsPerTick);
+        };
+        for (ProfilerZone& zone : frame.zones)
+        {
+            zone.start = toNanoseconds(zone.start);
+            if (zone.end)
+                zone.end = toNanoseconds(zone.end);
+        }
+        for (ProfilerCounter& counter : frame.counters)
+            counter.time = toNanoseconds(counter.time);
+        m_currentFrame = (m_currentFrame + 1) % m_frames.size();
+        m_recordedFrames = std::min(m_recordedFrames + 1, this->getFrameCapacity());
+        m_frame = nullptr;
+    }
+
+    std::size_t Profiler::getFrameCount() const
+    {
+        return m_recordedFrames;
+    }
+
+    const ProfilerFrame& Profiler::getFrame(std::size_t age) const
+    {
+        if (age >= m_recordedFrames)
+            throw Exceptions::UnknownProfilerFrame(age, m_recordedFrames, EXC_INFO);
+        const std::size_t slot = m_currentFrame + m_frames.size() - 1 - age;
+        return m_frames[slot % m_frames.size()];
+    }
+
+    double Profiler::getFrameDuration(std::size_t age) const
+    {
+        const ProfilerFrame& frame = this->getFrame(age);
+        return static_cast<double>(frame.end - frame.start) / 1e6;
+    }
+
+    double Profiler::getZoneDuration(const std::string& name, std::size_t age) const
+    {
+        const auto id = m_zoneIds.find(name);
+        if (id == m_zoneIds.end())
+            return 0;
+        std::int64_t duration = 0;
+        // Zones are stored in entering order, a zone ending before the end
+        // of the previously counted one is nested in it
+        std::int64_t countedUntil = std::numeric_limits<std::int64_t>::min();
+        for (const ProfilerZone& zone : this->getFrame(age).zones)
+        {
+            if (zone.id != id->second || zone.end <= countedUntil)
+                continue;
+            duration += zone.end - zone.start;
+            countedUntil = zone.end;
+        }
+        return static_cast<double>(duration) / 1e6;
+    }
+
+    double Profiler::getAverageZoneDuration(const std::string& name) const
+    {
+        if (m_recordedFrames == 0)
+            return 0;
+        double duration = 0;
+        for (std::size_t age = 0; age < m_recordedFrames; age++)
+            duration += this->getZoneDuration(name, age);
+        return duration / static_cast<double>(m_recordedFrames);
+    }
+
+    double Profiler::getCounterValue(const std::string& name, std::size_t age) const
+    {
+        const auto id = m_zoneIds.find(name);
+        if (id == m_zoneIds.end())
+            return 0;
+        const std::vector<ProfilerCounter>& counters = this->getFrame(age).counters;
+        const auto counter = std::find_if(counters.rbegin(), counters.rend(),
+            [&id](const ProfilerCounter& sample) { return sample.id == id->second; });
+        return (counter != counters.rend()) ? counter->value : 0;
+    }
+
+    void Profiler::clear()
+    {
+        this->setFrameCapacity(this->getFrameCapacity());
+    }
+
+    std::string Profiler::toChromeTrace() const
+    {
+        std::string trace = "{\"traceEvents\":[";
+        bool first = true;
+        const auto addEvent
+            = [&trace, &first](const std::string& name, std::int64_t start,
+                  std::int64_t end, const std::string& args) {
+                  if (!first)
+                      trace += ",";
+                  first = false;
+                  trace += fmt::format("\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,"
+                                       "\"tid\":1,\"ts\":{:.3f},\"dur\":{:.3f}{}}}",
+                      escapeJson(name), start / 1e3, (end - start) / 1e3, args);
+              };
+        for (const ProfilerFrame* frame : this->getRecordedFrames())
+        {
+            addEvent("Frame", frame->start, frame->end,
+                fmt::format(",\"args\":{{\"index\":{}}}", frame->index));
+            for (const ProfilerZone& zone : frame->zones)
+            {
+                // Zones still open when the frame ended are closed with it
+                const std::int64_t end = zone.end ? zone.end : frame->end;
+                addEvent(m_zoneNames[zone.id], zone.start, end, "");
+            }
+            for (const ProfilerCounter& counter : frame->counters)
+            {
+                if (!first)
+                    trace += ",";
+                first = false;
+                trace += fmt::format("\n{{\"name\":\"{0}\",\"ph\":\"C\",\"pid\":1,"
+                                     "\"tid\":1,\"ts\":{1:.3f},"
+                                     "\"args\":{{\"{0}\":{2}}}}}",
+                    escapeJson(m_zoneNames[counter.id]), counter.time / 1e3,
+                    counter.value);
+            }
+        }
+        trace += "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return trace;
+    }
+
+    void Profiler::saveChromeTrace(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (!file)
+            throw Exceptions::ProfilerTraceWriteError(path, EXC_INFO);
+        file << this->toChromeTrace();
+        if (!file)
+            throw Exceptions::ProfilerTraceWriteError(path, EXC_INFO);
+    }
+} // namespace obe::Debug
@@ -1,3 +1,4 @@
+#include <Debug/Profiler.hpp>
 #include <Engine/Engine.hpp>
 #include <Engine/Exceptions.hpp>
 #include <Utils/StringUtils.hpp>
@@ -32,6 +33,10 @@ namespace obe::Engine
         t_game = m_triggers->createTriggerGroup("Event", "Game");
 
         t_game->add("Start").trigger("Start").add("End").add("Update").add("Render");
+        // Resolved once as they are used every frame
+        m_updateTrigger = m_triggers->getTriggerHandle("Event", "Game", "Update");
+        m_renderTrigger = m_triggers->getTriggerHandle("Event", "Game", "Render");
+        m_updateDtArgument = m_triggers->getTrigger(m_updateTrigger).getArgumentId("dt");
     }
     void Engine::initInput()
     {
@@ -48,6 +53,8 @@ namespace obe::Engine
     {
         m_framerate = std::make_unique<Time::FramerateManager>(*m_window);
         m_framerate->configure(m_config.at("Framerate"));
+        m_framerate->setIdleTask(
+            [this](Time::TimeUnit available) { m_garbageCollector->idle(available); });
     }
 
     void Engine::initScript()
@@ -68,6 +75,12 @@ namespace obe::Engine
         m_lua->set_exception_handler(&lua_exception_handler);
 
         (*m_lua)["Engine"] = this;
+
+        m_garbageCollector = std::make_unique<Script::GarbageCollector>(*m_lua);
+        if (m_config.contains("GarbageCollector"))
+        {
+            m_garbageCollector->configure(m_config.at("GarbageCollector"));
+        }
     }
 
     void Engine::initResources()
@@ -82,6 +95,46 @@ namespace obe::Engine
                 Debug::Log->debug("<ResourceManager> AntiAliasing Default is {}",
                     m_resources->defaultAntiAliasing);
             }
+            if (gameConfig.contains("textureAtlas"))
+            {
+                const vili::node& atlasConfig = gameConfig.at("textureAtlas");
+                const vili::integer threshold = atlasConfig.contains("threshold")
+                    ? atlasConfig.at("threshold").as<vili::integer>()
+                    : 256;
+                const vili::integer pageSize = atlasConfig.contains("pageSize")
+                    ? atlasConfig.at("pageSize").as<vili::integer>()
+                    : 2048;
+                m_resources->enableTextureAtlas(threshold, pageSize);
+                Debug::Log->debug("<ResourceManager> Packing textures up to {}px in "
+                                  "{}px atlas pages",
+                    threshold, pageSize);
+            }
+        }
+    }
+
+    void Engine::initJobs()
+    {
+        std::size_t workers = Jobs::ThreadPool::getDefaultWorkerCount();
+        if (m_config.contains("Jobs") && m_config.at("Jobs").contains("workers"))
+        {
+            const vili::integer configWorkers
+                = m_config.at("Jobs").at("workers").as<vili::integer>();
+            if (configWorkers >= 0)
+            {
+                workers = static_cast<std::size_t>(configWorkers);
+            }
+            else
+            {
+                Debug::Log->warn("<ThreadPool> Invalid amount of workers {}, using {}",
+                    configWorkers, workers);
+            }
+        }
+        m_threadPool = std::make_unique<Jobs::ThreadPool>(workers);
+        Debug::Log->debug("<ThreadPool> Started {} workers", workers);
+        for (const auto& plugin : m_plugins)
+        {
+            if (plugin->hasOnLoadJobs())
+                plugin->onLoadJobs(*m_threadPool);
         }
     }
 
@@ -122,6 +175,7 @@ namespace obe::Engine
     {
         m_scene = std::make_unique<Scene::Scene>(*m_triggers, *m_lua);
         m_scene->attachResourceManager(*m_resources);
+        m_scene->attachThreadPool(m_threadPool.get());
     }
 
     void Engine::initLogger() const
@@ -165,6 +219,8 @@ namespace obe::Engine
         m_cursor.reset();
         m_framerate.reset();
         m_scene.reset();
+        m_threadPool.reset();
+        m_garbageCollector.reset();
         if (m_lua)
         {
             m_lua->collect_garbage();
@@ -240,6 +296,7 @@ namespace obe::Engine
         this->initFramerate();
         this->initPlugins();
         this->initResources();
+        this->initJobs();
         this->initScene();
         m_initialized = true;
     }
@@ -275,13 +332,20 @@ namespace obe::Engine
 
         while (m_window->isOpen())
         {
-            m_framerate->update();
+            OBE_PROFILE_FRAME();
+            {
+                OBE_PROFILE_ZONE("FramerateManager::update");
+                m_framerate->update();
+            }
 
-            t_game->pushParameter("Update", "dt", m_framerate->getGameSpeed());
-            t_game->trigger("Update");
+            // Several steps (or none) when the simulation runs with a fixed
+            // timestep, the Scene is then drawn between the two last steps
+            for (unsigned int i = 0; i < m_framerate->getSteps(); i++)
+                this->step();
+            m_scene->setInterpolation(m_framerate->getInterpolation());
 
             if (m_framerate->doRender())
-                t_game->trigger("Render");
+                m_triggers->trigger(m_renderTrigger);
 
             this->update();
             this->render();
@@ -333,24 +397,64 @@ namespace obe::Engine
         return *m_window;
     }
 
+    Script::GarbageCollector& Engine::getGarbageCollector() const
+    {
+        return *m_garbageCollector;
+    }
+
+    Jobs::ThreadPool& Engine::getThreadPool() const
+    {
+        return *m_threadPool;
+    }
+
+    void Engine::step() const
+    {
+        OBE_PROFILE_ZONE("Engine::step");
+        if (m_framerate->isFixedTimestep())
+            m_scene->storePreviousPositions();
+        m_triggers->pushParameter(
+            m_updateTrigger, m_updateDtArgument, m_framerate->getGameSpeed());
+        m_triggers->trigger(m_updateTrigger);
+        m_scene->update();
+    }
+
     void Engine::update() const
     {
+        OBE_PROFILE_ZONE("Engine::update");
         // Events
-        this->handleWindowEvents();
-        m_scene->update();
-        m_triggers->update();
-        m_input->update();
-        m_cursor->update();
+        {
+            OBE_PROFILE_ZONE("Engine::handleWindowEvents");
+            this->handleWindowEvents();
+        }
+        {
+            OBE_PROFILE_ZONE("TriggerManager::update");
+            m_triggers->update();
+        }
+        m_triggers->dispatchQueue();
+        {
+            OBE_PROFILE_ZONE("ThreadPool::runMainThreadTasks");
+            m_threadPool->runMainThreadTasks();
+        }
+        {
+            OBE_PROFILE_ZONE("InputManager::update");
+            m_input->update();
+        }
+        {
+            OBE_PROFILE_ZONE("Cursor::update");
+            m_cursor->update();
+        }
     }
 
     void Engine::render()
     {
-        m_lua->collect_garbage();
+        OBE_PROFILE_ZONE("Engine::render");
+        m_garbageCollector->update();
         if (m_framerate->doRender())
         {
             m_window->clear();
             m_scene->draw(m_window->getTarget());
 
+            OBE_PROFILE_ZONE("Window::display");
             m_window->display();
         }
     }
@@ -6,50 +6,63 @@
 
 namespace obe::Engine
 {
-    const Graphics::Texture& ResourceManager::getTexture(
+    std::unique_ptr<Graphics::Texture> ResourceManager::loadTexture(
         const std::string& path, bool antiAliasing)
     {
-        if (m_textures.find(path) == m_textures.end()
-            || (!m_textures[path].first && !antiAliasing)
-            || (!m_textures[path].second && antiAliasing))
+        std::unique_ptr<sf::Image> image;
+        if (const auto preloaded = m_preloadedImages.find(path);
+            preloaded != m_preloadedImages.end())
+        {
+            Debug::Log->debug("[ResourceManager] Loading <Texture> {} from its "
+                              "preloaded image",
+                path);
+            image = std::move(preloaded->second);
+            m_preloadedImages.erase(preloaded);
+        }
+        else
         {
-            std::shared_ptr<sf::Texture> tempTexture = std::make_shared<sf::Texture>();
             const std::string realPath = System::Path(path).find();
             Debug::Log->debug(
                 "[ResourceManager] Loading <Texture> {} from {}", path, realPath);
-            const bool success = tempTexture->loadFromFile(realPath);
-
-            if (success)
-            {
-                tempTexture->setSmooth(antiAliasing);
-                if (!antiAliasing)
-                {
-                    m_textures[path].first
-                        = std::make_unique<Graphics::Texture>(tempTexture);
-                    return *m_textures[path].first;
-                }
-                else
-                {
-                    m_textures[path].second
-                        = std::make_unique<Graphics::Texture>(tempTexture);
-                    return *m_textures[path].second;
-                }
-            }
-            else
+            image = std::make_unique<sf::Image>();
+            if (!image->loadFromFile(realPath))
                 throw Exceptions::TextureNotFound(
                     path, System::MountablePath::StringPaths(), EXC_INFO);
         }
-        else
+
+        if (m_atlasThreshold && image->getSize().x <= m_atlasThreshold
+            && image->getSize().y <= m_atlasThreshold)
         {
-            if (antiAliasing)
+            std::unique_ptr<Graphics::TextureAtlas>& atlas
+                = antiAliasing ? m_atlases.second : m_atlases.first;
+            if (!atlas)
+                atlas = std::make_unique<Graphics::TextureAtlas>(
+                    m_atlasPageSize, antiAliasing);
+            if (std::optional<Graphics::Texture> packed = atlas->insert(*image))
             {
-                return *m_textures[path].second;
-            }
-            else
-            {
-                return *m_textures[path].first;
+                const sf::Texture& page = *packed;
+                m_packedTextures[&page].emplace_back(path, antiAliasing);
+                return std::make_unique<Graphics::Texture>(*packed);
             }
         }
+
+        std::shared_ptr<sf::Texture> tempTexture = std::make_shared<sf::Texture>();
+        if (!tempTexture->loadFromImage(*image))
+            throw Exceptions::TextureNotFound(
+                path, System::MountablePath::StringPaths(), EXC_INFO);
+        tempTexture->setSmooth(antiAliasing);
+        return std::make_unique<Graphics::Texture>(tempTexture);
+    }
+
+    const Graphics::Texture& ResourceManager::getTexture(
+        const std::string& path, bool antiAliasing)
+    {
+        TexturePair& textures = m_textures[path];
+        std::unique_ptr<Graphics::Texture>& texture
+            = antiAliasing ? textures.second : textures.first;
+        if (!texture)
+            texture = this->loadTexture(path, antiAliasing);
+        return *texture;
     }
 
     const Graphics::Texture& ResourceManager::getTexture(const std::string& path)
@@ -57,19 +70,65 @@ namespace obe::Engine
         return getTexture(path, defaultAntiAliasing);
     }
 
+    void ResourceManager::preloadImage(
+        const std::string& path, std::unique_ptr<sf::Image> image)
+    {
+        m_preloadedImages[path] = std::move(image);
+    }
+
+    void ResourceManager::enableTextureAtlas(
+        unsigned int threshold, unsigned int pageSize)
+    {
+        m_atlasThreshold = threshold;
+        m_atlasPageSize = pageSize;
+    }
+
+    void ResourceManager::disableTextureAtlas()
+    {
+        m_atlasThreshold = 0;
+    }
+
+    bool ResourceManager::isTextureAtlasEnabled() const
+    {
+        return m_atlasThreshold > 0;
+    }
+
     void ResourceManager::clean()
     {
+        m_preloadedImages.clear();
         for (auto& texturePair : m_textures)
         {
-            if (texturePair.second.first && texturePair.second.first->useCount() == 1)
+            if (texturePair.second.first && !texturePair.second.first->hasSubRect()
+                && texturePair.second.first->useCount() == 1)
             {
                 texturePair.second.first.reset();
             }
-            if (texturePair.second.second && texturePair.second.second->useCount() == 1)
+            if (texturePair.second.second && !texturePair.second.second->hasSubRect()
+                && texturePair.second.second->useCount() == 1)
             {
                 texturePair.second.second.reset();
             }
         }
+        // A page is shared by its TextureAtlas and the textures packed in it, it
+        // is unused when nothing else holds a copy of these textures
+        for (auto page = m_packedTextures.begin(); page != m_packedTextures.end();)
+        {
+            const bool antiAliasing = page->second.front().second;
+            TexturePair& first = m_textures[page->second.front().first];
+            Graphics::Texture& texture = antiAliasing ? *first.second : *first.first;
+            if (texture.useCount() != page->second.size() + 1)
+            {
+                ++page;
+                continue;
+            }
+            for (const auto& [path, pathAntiAliasing] : page->second)
+            {
+                TexturePair& textures = m_textures[path];
+                (pathAntiAliasing ? textures.second : textures.first).reset();
+            }
+            (antiAliasing ? m_atlases.second : m_atlases.first)->removePage(*page->first);
+            page = m_packedTextures.erase(page);
+        }
     }
 
     ResourceManager::ResourceManager()
@@ -2,18 +2,107 @@
 
 namespace obe::Graphics
 {
+    namespace
+    {
+        using StockTransformer = double (*)(double, double, int);
+
+        double parallaxTransform(double pos, double cam, int layer)
+        {
+            return (pos * layer - cam) / double(layer);
+        }
+
+        double cameraTransform(double pos, double cam, int layer)
+        {
+            return pos - cam;
+        }
+
+        double positionTransform(double pos, double cam, int layer)
+        {
+            return pos;
+        }
+
+        // Part of the Camera position removed by a built-in kernel (all of
+        // them are translations)
+        double getCameraFactor(TransformerKernel kernel, int layer)
+        {
+            switch (kernel)
+            {
+            case TransformerKernel::Camera:
+                return 1;
+            case TransformerKernel::Parallax:
+                return 1.0 / layer;
+            default:
+                return 0;
+            }
+        }
+
+        // Checks if a Transformers entry is still the stock function of a
+        // built-in kernel (the entries can be replaced)
+        bool isStockTransformer(const std::string& name, StockTransformer stock)
+        {
+            const auto transformer = Transformers.find(name);
+            if (transformer == Transformers.end())
+                return false;
+            const auto* function = transformer->second.target<StockTransformer>();
+            return function && *function == stock;
+        }
+
+        double applyKernel(TransformerKernel kernel,
+            const CoordinateTransformer& transformer, double position, double camera,
+            int layer)
+        {
+            switch (kernel)
+            {
+            case TransformerKernel::Camera:
+                return position - camera;
+            case TransformerKernel::Position:
+                return position;
+            case TransformerKernel::Parallax:
+                return (position * layer - camera) / double(layer);
+            default:
+                return transformer(position, camera, layer);
+            }
+        }
+    }
+
     std::map<std::string, CoordinateTransformer> Transformers;
 
-    CoordinateTransformer Parallax = [](double pos, double cam, int layer) -> double {
-        return (pos * layer - cam) / double(layer);
-    };
-    CoordinateTransformer Camera
-        = [](double pos, double cam, int layer) -> double { return pos - cam; };
-    CoordinateTransformer Position
-        = [](double pos, double cam, int layer) -> double { return pos; };
+    CoordinateTransformer Parallax = parallaxTransform;
+    CoordinateTransformer Camera = cameraTransform;
+    CoordinateTransformer Position = positionTransform;
+
+    TransformerKernel getTransformerKernel(const std::string& transformer)
+    {
+        if (transformer == "Camera" && isStockTransformer(transformer, cameraTransform))
+            return TransformerKernel::Camera;
+        if (transformer == "Position"
+            && isStockTransformer(transformer, positionTransform))
+            return TransformerKernel::Position;
+        if (transformer == "Parallax"
+            && isStockTransformer(transformer, parallaxTransform))
+            return TransformerKernel::Parallax;
+        return TransformerKernel::Custom;
+    }
+
+    void AffineTransform::apply(const double* x, const double* y, float* transformedX,
+        float* transformedY, std::size_t count) const
+    {
+        // Copied to locals so the compiler knows the writes do not change them
+        const double sx = scaleX;
+        const double sy = scaleY;
+        const double ox = offsetX;
+        const double oy = offsetY;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            transformedX[i] = static_cast<float>(x[i] * sx + ox);
+            transformedY[i] = static_cast<float>(y[i] * sy + oy);
+        }
+    }
 
     PositionTransformer::PositionTransformer()
     {
+        m_xKernel = getTransformerKernel(m_xTransformerName);
+        m_yKernel = getTransformerKernel(m_yTransformerName);
         m_xTransformer = Transformers[m_xTransformerName];
         m_yTransformer = Transformers[m_yTransformerName];
     }
@@ -23,6 +112,8 @@ namespace obe::Graphics
     {
         m_xTransformerName = xTransformer;
         m_yTransformerName = yTransformer;
+        m_xKernel = getTransformerKernel(m_xTransformerName);
+        m_yKernel = getTransformerKernel(m_yTransformerName);
         m_xTransformer = Transformers[m_xTransformerName];
         m_yTransformer = Transformers[m_yTransformerName];
     }
@@ -31,24 +122,87 @@ namespace obe::Graphics
         const Transform::UnitVector& position, const Transform::UnitVector& camera,
         int layer) const
     {
+        const Transform::UnitVector localCamera = camera.to(position.unit);
         Transform::UnitVector transformedPosition(position.unit);
         transformedPosition.x
-            = m_xTransformer(position.x, camera.to(position.unit).x, layer);
+            = applyKernel(m_xKernel, m_xTransformer, position.x, localCamera.x, layer);
         transformedPosition.y
-            = m_yTransformer(position.y, camera.to(position.unit).y, layer);
+            = applyKernel(m_yKernel, m_yTransformer, position.y, localCamera.y, layer);
         return transformedPosition;
     }
 
-    CoordinateTransformer& PositionTransformer::getXTransformer()
+    std::optional<AffineTransform> PositionTransformer::getAffineTransform(
+        const Transform::UnitVector& camera, int layer) const
+    {
+        if (m_xKernel == TransformerKernel::Custom
+            || m_yKernel == TransformerKernel::Custom)
+            return std::nullopt;
+        // Parallax divides by the layer
+        if (layer == 0
+            && (m_xKernel == TransformerKernel::Parallax
+                || m_yKernel == TransformerKernel::Parallax))
+            return std::nullopt;
+        const Transform::UnitVector pixelCamera
+            = camera.to<Transform::Units::ScenePixels>();
+        AffineTransform transform;
+        transform.scaleX
+            = Transform::UnitVector::Screen.w / Transform::UnitVector::View.w;
+        transform.scaleY
+            = Transform::UnitVector::Screen.h / Transform::UnitVector::View.h;
+        transform.offsetX = -getCameraFactor(m_xKernel, layer) * pixelCamera.x;
+        transform.offsetY = -getCameraFactor(m_yKernel, layer) * pixelCamera.y;
+        return transform;
+    }
+
+    void PositionTransformer::transform(const double* x, const double* y,
+        float* transformedX, float* transformedY, std::size_t count,
+        const Transform::UnitVector& camera, int layer) const
+    {
+        if (const std::optional<AffineTransform> affine
+            = this->getAffineTransform(camera, layer))
+        {
+            affine->apply(x, y, transformedX, transformedY, count);
+            return;
+        }
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const Transform::UnitVector transformed
+                = (*this)(Transform::UnitVector(x[i], y[i]), camera, layer)
+                      .to<Transform::Units::ScenePixels>();
+            transformedX[i] = static_cast<float>(transformed.x);
+            transformedY[i] = static_cast<float>(transformed.y);
+        }
+    }
+
+    bool PositionTransformer::hasSameKernels(const PositionTransformer& other) const
+    {
+        return m_xKernel != TransformerKernel::Custom
+            && m_yKernel != TransformerKernel::Custom && m_xKernel == other.m_xKernel
+            && m_yKernel == other.m_yKernel;
+    }
+
+    const CoordinateTransformer& PositionTransformer::getXTransformer() const
     {
         return m_xTransformer;
     }
 
-    CoordinateTransformer& PositionTransformer::getYTransformer()
+    void PositionTransformer::setXTransformer(CoordinateTransformer transformer)
+    {
+        m_xTransformer = std::move(transformer);
+        m_xKernel = TransformerKernel::Custom;
+    }
+
+    const CoordinateTransformer& PositionTransformer::getYTransformer() const
     {
         return m_yTransformer;
     }
 
+    void PositionTransformer::setYTransformer(CoordinateTransformer transformer)
+    {
+        m_yTransformer = std::move(transformer);
+        m_yKernel = TransformerKernel::Custom;
+    }
+
     std::string PositionTransformer::getXTransformerName() const
     {
         return m_xTransformerName;
@@ -59,6 +213,16 @@ namespace obe::Graphics
         return m_yTransformerName;
     }
 
+    TransformerKernel PositionTransformer::getXKernel() const
+    {
+        return m_xKernel;
+    }
+
+    TransformerKernel PositionTransformer::getYKernel() const
+    {
+        return m_yKernel;
+    }
+
     void InitPositionTransformer()
     {
         Transformers["Parallax"] = Parallax;
@@ -27,11 +27,6 @@ namespace obe::Graphics
         NullTexture.loadFromImage(nullImage);
     }
 
-    sf::Vertex toSfVertex(const Transform::UnitVector& uv)
-    {
-        return sf::Vertex(sf::Vector2f(uv.x, uv.y));
-    }
-
     Sprite::Sprite(const std::string& id)
         : Selectable(false)
         , Component(id)
@@ -46,6 +41,11 @@ namespace obe::Graphics
         m_positionTransformer = PositionTransformer("Camera", "Camera");
     }
 
+    Sprite::~Sprite()
+    {
+        this->attachSpriteIndex(nullptr);
+    }
+
     void Sprite::useTextureSize()
     {
         const Transform::UnitVector textureSize = this->getTexture().getSize();
@@ -54,24 +54,76 @@ namespace obe::Graphics
         this->setSize(initialSpriteSize);
     }
 
-    void Sprite::draw(RenderTarget surface, const Transform::UnitVector& camera)
+    const std::array<Transform::UnitVector, 4>& Sprite::getCorners() const
     {
-        std::array<sf::Vertex, 4> vertices;
+        if (!m_cornersDirty)
+            return m_corners;
+        const Transform::UnitVector position
+            = m_position.to<Transform::Units::SceneUnits>();
+        const Transform::UnitVector size = m_size.to<Transform::Units::SceneUnits>();
+        const double radAngle = obe::Utils::Math::convertToRadian(-m_angle);
+        const double cosAngle = std::cos(radAngle);
+        const double sinAngle = std::sin(radAngle);
+        const std::array<Transform::Referential, 4> corners
+            = { Transform::Referential::TopLeft, Transform::Referential::BottomLeft,
+                  Transform::Referential::TopRight, Transform::Referential::BottomRight };
+        // Same as Rect::getPosition but the rotation is only computed once
+        for (std::size_t i = 0; i < corners.size(); i++)
+        {
+            const Transform::UnitVector offset = corners[i].getOffset();
+            const double dx = offset.x * size.x;
+            const double dy = offset.y * size.y;
+            m_corners[i].x = position.x + dx * cosAngle - dy * sinAngle;
+            m_corners[i].y = position.y + dx * sinAngle + dy * cosAngle;
+        }
+        m_cornersDirty = false;
+        return m_corners;
+    }
 
-        vertices[0] = toSfVertex(m_positionTransformer(
-            Rect::getPosition(Transform::Referential::TopLeft), camera, m_layer)
-                                     .to<Transform::Units::ScenePixels>());
-        vertices[1] = toSfVertex(m_positionTransformer(
-            Rect::getPosition(Transform::Referential::BottomLeft), camera, m_layer)
-                                     .to<Transform::Units::ScenePixels>());
-        vertices[2] = toSfVertex(m_positionTransformer(
-            Rect::getPosition(Transform::Referential::TopRight), camera, m_layer)
-                                     .to<Transform::Units::ScenePixels>());
-        vertices[3] = toSfVertex(m_positionTransformer(
-            Rect::getPosition(Transform::Referential::BottomRight), camera, m_layer)
-                                     .to<Transform::Units::ScenePixels>());
+    void Sprite::getInterpolatedCorners(double interpolation, double* x, double* y) const
+    {
+        const std::array<Transform::UnitVector, 4>& corners = this->getCorners();
+        // Every corner is moved back towards the previous Position
+        double offsetX = 0;
+        double offsetY = 0;
+        if (m_hasPreviousPosition && interpolation < 1)
+        {
+            const Transform::UnitVector previous
+                = m_previousPosition.to<Transform::Units::SceneUnits>();
+            offsetX = (previous.x - corners[0].x) * (1 - interpolation);
+            offsetY = (previous.y - corners[0].y) * (1 - interpolation);
+        }
+        for (std::size_t i = 0; i < corners.size(); i++)
+        {
+            x[i] = corners[i].x + offsetX;
+            y[i] = corners[i].y + offsetY;
+        }
+    }
 
+    void Sprite::setTransformedCorners(const float* x, const float* y)
+    {
+        std::array<sf::Vertex, 4> vertices;
+        for (std::size_t i = 0; i < vertices.size(); i++)
+            vertices[i].position = sf::Vector2f(x[i], y[i]);
         m_sprite.setVertices(vertices);
+    }
+
+    void Sprite::updateVertices(const Transform::UnitVector& camera, double interpolation)
+    {
+        std::array<double, 4> x;
+        std::array<double, 4> y;
+        std::array<float, 4> transformedX;
+        std::array<float, 4> transformedY;
+        this->getInterpolatedCorners(interpolation, x.data(), y.data());
+        m_positionTransformer.transform(x.data(), y.data(), transformedX.data(),
+            transformedY.data(), x.size(), camera, m_layer);
+        this->setTransformedCorners(transformedX.data(), transformedY.data());
+    }
+
+    void Sprite::draw(
+        RenderTarget surface, const Transform::UnitVector& camera, double interpolation)
+    {
+        this->updateVertices(camera, interpolation);
 
         if (m_shader)
             surface.draw(m_sprite, m_shader);
@@ -84,6 +136,75 @@ namespace obe::Graphics
         }
     }
 
+    void Sprite::addToBatch(
+        SpriteBatch& batch, const Transform::UnitVector& camera, double interpolation)
+    {
+        // A Sprite without texture is not drawn (same as sfe::ComplexSprite)
+        if (!m_sprite.getTexture())
+            return;
+        this->updateVertices(camera, interpolation);
+        batch.add(m_sprite.getTransformedVertices(), m_sprite.getTexture(), m_shader);
+    }
+
+    void Sprite::storePreviousPosition()
+    {
+        m_previousPosition = this->getCorners()[0];
+        m_hasPreviousPosition = true;
+    }
+
+    void Sprite::onRectChanged()
+    {
+        m_cornersDirty = true;
+        if (!m_spriteIndex)
+            return;
+        if (m_spriteIndex->isDeferringUpdates())
+            m_indexUpdateDeferred = true;
+        else
+            m_spriteIndex->update(m_indexProxy);
+    }
+
+    void Sprite::applyDeferredIndexUpdate()
+    {
+        if (m_indexUpdateDeferred && m_spriteIndex)
+            m_spriteIndex->update(m_indexProxy);
+        m_indexUpdateDeferred = false;
+    }
+
+    void Sprite::onCullingGroupChanged()
+    {
+        if (m_spriteIndex)
+            m_spriteIndex->regroup(m_indexProxy);
+    }
+
+    void Sprite::attachSpriteIndex(SpriteIndex* index)
+    {
+        if (m_spriteIndex)
+            m_spriteIndex->remove(m_indexProxy);
+        m_indexProxy = Collision::NullProxy;
+        m_spriteIndex = index;
+        if (m_spriteIndex)
+            m_indexProxy = m_spriteIndex->insert(*this);
+    }
+
+    Collision::ProxyId Sprite::getSpriteIndexProxy() const
+    {
+        return m_indexProxy;
+    }
+
+    Collision::AABB Sprite::getBounds() const
+    {
+        const std::array<Transform::UnitVector, 4>& corners = this->getCorners();
+        Collision::AABB bounds(corners[0].x, corners[0].y, corners[0].x, corners[0].y);
+        for (const Transform::UnitVector& corner : corners)
+        {
+            bounds.minX = std::min(bounds.minX, corner.x);
+            bounds.minY = std::min(bounds.minY, corner.y);
+            bounds.maxX = std::max(bounds.maxX, corner.x);
+            bounds.maxY = std::max(bounds.maxY, corner.y);
+        }
+        return bounds;
+    }
+
     void Sprite::attachResourceManager(Engine::ResourceManager& resources)
     {
         this->setAntiAliasing(resources.defaultAntiAliasing);
@@ -112,8 +233,7 @@ namespace obe::Graphics
             }
 
             m_sprite.setTexture(m_texture);
-            m_sprite.setTextureRect(
-                sf::IntRect(0, 0, m_texture.getSize().x, m_texture.getSize().y));
+            m_sprite.setTextureRect(m_texture.getSubRect());
         }
     }
 
@@ -123,16 +243,19 @@ namespace obe::Graphics
 
     void Sprite::setTexture(const Texture& texture)
     {
-        // m_texture = std::shared_ptr<Texture>(std::shared_ptr<Texture>(), texture);
+        if (&texture != &m_texture)
+            m_texture = texture;
         m_sprite.setTexture(texture);
-        m_sprite.setTextureRect(
-            sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y));
+        m_sprite.setTextureRect(texture.getSubRect());
     }
 
     void Sprite::setTextureRect(
         unsigned int x, unsigned int y, unsigned int width, unsigned int height)
     {
-        m_sprite.setTextureRect(sf::IntRect(x, y, width, height));
+        // Textures packed in an atlas only use a part of their page
+        const sf::IntRect bounds = m_texture.getSubRect();
+        m_sprite.setTextureRect(
+            sf::IntRect(bounds.left + x, bounds.top + y, width, height));
     }
 
     const Graphics::Texture& Sprite::getTexture() const
@@ -144,6 +267,7 @@ namespace obe::Graphics
     {
         m_layer = layer;
         m_layerChanged = true;
+        this->onCullingGroupChanged();
     }
 
     void Sprite::setZDepth(int zdepth)
@@ -251,6 +375,7 @@ namespace obe::Graphics
     void Sprite::setTranslationOrigin(int x, int y)
     {
         m_sprite.setTranslationOrigin(x, y);
+        this->onCullingGroupChanged();
     }
 
     void Sprite::setRotationOrigin(int x, int y)
@@ -350,6 +475,7 @@ namespace obe::Graphics
     void Sprite::setPositionTransformer(const PositionTransformer& transformer)
     {
         m_positionTransformer = transformer;
+        this->onCullingGroupChanged();
     }
 
     PositionTransformer Sprite::getPositionTransformer() const
@@ -0,0 +1,125 @@
+#include <Graphics/Exceptions.hpp>
+#include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteBatch.hpp>
+
+namespace obe::Graphics
+{
+    void SpriteBatch::clear()
+    {
+        for (std::size_t i = 0; i < m_runCount; i++)
+            m_runs[i].vertices.clear();
+        m_runCount = 0;
+        m_vertexCount = 0;
+        m_spriteCount = 0;
+    }
+
+    void SpriteBatch::add(
+        const std::array<sf::Vertex, 4>& quad, const sf::Texture* texture, Shader* shader)
+    {
+        if (m_runCount == 0 || m_runs[m_runCount - 1].texture != texture
+            || m_runs[m_runCount - 1].shader != shader)
+        {
+            if (m_runCount == m_runs.size())
+                m_runs.emplace_back();
+            SpriteBatchRun& newRun = m_runs[m_runCount++];
+            newRun.texture = texture;
+            newRun.shader = shader;
+            newRun.spriteCount = 0;
+        }
+        SpriteBatchRun& run = m_runs[m_runCount - 1];
+        // The quad is stored as a triangle strip, split it in two triangles
+        run.vertices.append(quad[0]);
+        run.vertices.append(quad[1]);
+        run.vertices.append(quad[2]);
+        run.vertices.append(quad[2]);
+        run.vertices.append(quad[1]);
+        run.vertices.append(quad[3]);
+        run.spriteCount++;
+        m_vertexCount += 6;
+        m_spriteCount++;
+    }
+
+    void SpriteBatch::addSprites(const std::vector<Sprite*>& sprites,
+        const Transform::UnitVector& camera, double interpolation)
+    {
+        m_stagedSprites.clear();
+        m_cornersX.resize(MaxStagedSprites * 4);
+        m_cornersY.resize(MaxStagedSprites * 4);
+        m_transformedX.resize(MaxStagedSprites * 4);
+        m_transformedY.resize(MaxStagedSprites * 4);
+        for (Sprite* sprite : sprites)
+        {
+            // A Sprite without texture is not drawn (same as sfe::ComplexSprite)
+            if (!sprite->isVisible() || !sprite->m_sprite.getTexture())
+                continue;
+            if (!m_stagedSprites.empty())
+            {
+                const Sprite& first = *m_stagedSprites.front();
+                if (m_stagedSprites.size() == MaxStagedSprites
+                    || sprite->m_layer != first.m_layer
+                    || !sprite->m_positionTransformer.hasSameKernels(
+                        first.m_positionTransformer))
+                {
+                    this->flushStagedSprites(camera);
+                }
+            }
+            const std::size_t corner = m_stagedSprites.size() * 4;
+            sprite->getInterpolatedCorners(
+                interpolation, &m_cornersX[corner], &m_cornersY[corner]);
+            m_stagedSprites.push_back(sprite);
+        }
+        if (!m_stagedSprites.empty())
+            this->flushStagedSprites(camera);
+    }
+
+    void SpriteBatch::flushStagedSprites(const Transform::UnitVector& camera)
+    {
+        const Sprite& first = *m_stagedSprites.front();
+        first.m_positionTransformer.transform(m_cornersX.data(), m_cornersY.data(),
+            m_transformedX.data(), m_transformedY.data(), m_stagedSprites.size() * 4,
+            camera, first.m_layer);
+        for (std::size_t i = 0; i < m_stagedSprites.size(); i++)
+        {
+            Sprite& sprite = *m_stagedSprites[i];
+            sprite.setTransformedCorners(&m_transformedX[i * 4], &m_transformedY[i * 4]);
+            this->add(sprite.m_sprite.getTransformedVertices(),
+                sprite.m_sprite.getTexture(), sprite.m_shader);
+        }
+        m_stagedSprites.clear();
+    }
+
+    void SpriteBatch::draw(RenderTarget surface) const
+    {
+        for (std::size_t i = 0; i < m_runCount; i++)
+        {
+            const SpriteBatchRun& run = m_runs[i];
+            sf::RenderStates states;
+            states.texture = run.texture;
+            states.shader = run.shader;
+            surface.draw(run.vertices, states);
+        }
+    }
+
+    const SpriteBatchRun& SpriteBatch::getRun(std::size_t index) const
+    {
+        // m_runs keeps the runs of previous batches to reuse their buffers
+        if (index >= m_runCount)
+            throw Exceptions::SpriteBatchRunIndexOverflow(index, m_runCount, EXC_INFO);
+        return m_runs[index];
+    }
+
+    std::size_t SpriteBatch::getDrawCallCount() const
+    {
+        return m_runCount;
+    }
+
+    std::size_t SpriteBatch::getVertexCount() const
+    {
+        return m_vertexCount;
+    }
+
+    std::size_t SpriteBatch::getSpriteCount() const
+    {
+        return m_spriteCount;
+    }
+} // namespace obe::Graphics
@@ -0,0 +1,280 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteIndex.hpp>
+
+namespace obe::Graphics
+{
+    bool SpriteIndex::CellRange::operator==(const CellRange& other) const
+    {
+        return minX == other.minX && minY == other.minY && maxX == other.maxX
+            && maxY == other.maxY;
+    }
+
+    std::size_t SpriteIndex::CellRange::getCellCount() const
+    {
+        if (maxX < minX || maxY < minY)
+            return 0;
+        return static_cast<std::size_t>((maxX - minX + 1) * (maxY - minY + 1));
+    }
+
+    SpriteIndex::SpriteIndex(double cellSize)
+        : m_cellSize(cellSize)
+    {
+    }
+
+    SpriteIndex::CellRange SpriteIndex::getCellRange(const Collision::AABB& bounds) const
+    {
+        CellRange range;
+        range.minX = static_cast<std::int64_t>(std::floor(bounds.minX / m_cellSize));
+        range.minY = static_cast<std::int64_t>(std::floor(bounds.minY / m_cellSize));
+        range.maxX = static_cast<std::int64_t>(std::floor(bounds.maxX / m_cellSize));
+        range.maxY = static_cast<std::int64_t>(std::floor(bounds.maxY / m_cellSize));
+        return range;
+    }
+
+    std::uint64_t SpriteIndex::getCellKey(std::int64_t x, std::int64_t y)
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32)
+            | static_cast<std::uint32_t>(y);
+    }
+
+    void SpriteIndex::link(Collision::ProxyId proxy)
+    {
+        Proxy& current = m_proxies[proxy];
+        if (current.group < 0)
+        {
+            m_uncullableProxies.push_back(proxy);
+            return;
+        }
+        current.cells = this->getCellRange(current.bounds);
+        current.large = current.cells.getCellCount() > MaxCellsPerSprite;
+        if (current.large)
+        {
+            m_largeProxies.push_back(proxy);
+            return;
+        }
+        for (std::int64_t x = current.cells.minX; x <= current.cells.maxX; x++)
+        {
+            for (std::int64_t y = current.cells.minY; y <= current.cells.maxY; y++)
+                m_cells[getCellKey(x, y)].push_back(proxy);
+        }
+    }
+
+    void SpriteIndex::unlink(Collision::ProxyId proxy)
+    {
+        const auto removeFrom = [proxy](std::vector<Collision::ProxyId>& content) {
+            const auto it = std::find(content.begin(), content.end(), proxy);
+            if (it != content.end())
+            {
+                *it = content.back();
+                content.pop_back();
+            }
+        };
+        const Proxy& current = m_proxies[proxy];
+        if (current.group < 0)
+        {
+            removeFrom(m_uncullableProxies);
+            return;
+        }
+        if (current.large)
+        {
+            removeFrom(m_largeProxies);
+            return;
+        }
+        for (std::int64_t x = current.cells.minX; x <= current.cells.maxX; x++)
+        {
+            for (std::int64_t y = current.cells.minY; y <= current.cells.maxY; y++)
+            {
+                const auto cell = m_cells.find(getCellKey(x, y));
+                if (cell == m_cells.end())
+                    continue;
+                removeFrom(cell->second);
+                if (cell->second.empty())
+                    m_cells.erase(cell);
+            }
+        }
+    }
+
+    int SpriteIndex::findGroup(Sprite& sprite)
+    {
+        const sf::Vector2f& translationOrigin = sprite.getSprite().getTranslationOrigin();
+        if (translationOrigin.x != 0 || translationOrigin.y != 0)
+            return -1;
+        const PositionTransformer transformer = sprite.getPositionTransformer();
+        const TransformerKernel x = transformer.getXKernel();
+        const TransformerKernel y = transformer.getYKernel();
+        if (x == TransformerKernel::Custom || y == TransformerKernel::Custom)
+            return -1;
+        const bool parallax
+            = (x == TransformerKernel::Parallax || y == TransformerKernel::Parallax);
+        // Parallax divides by the layer, the layer is only relevant for it
+        if (parallax && sprite.getLayer() == 0)
+            return -1;
+        const int layer = parallax ? sprite.getLayer() : 0;
+        for (std::size_t i = 0; i < m_groups.size(); i++)
+        {
+            const Group& group = m_groups[i];
+            if (group.x == x && group.y == y && group.layer == layer)
+                return static_cast<int>(i);
+        }
+        m_groups.push_back(Group { x, y, layer });
+        return static_cast<int>(m_groups.size() - 1);
+    }
+
+    Collision::AABB SpriteIndex::getVisibleArea(const Group& group,
+        const Transform::UnitVector& camera, const Transform::UnitVector& viewSize) const
+    {
+        // Inverse of the CoordinateTransformer : position where it returns 0
+        const auto getStart = [&group](TransformerKernel kernel, double camera) {
+            if (kernel == TransformerKernel::Camera)
+                return camera;
+            if (kernel == TransformerKernel::Parallax)
+                return camera / group.layer;
+            return 0.0;
+        };
+        const double x = getStart(group.x, camera.x);
+        const double y = getStart(group.y, camera.y);
+        return Collision::AABB(x, y, x + viewSize.x, y + viewSize.y);
+    }
+
+    Collision::ProxyId SpriteIndex::insert(Sprite& sprite)
+    {
+        Collision::ProxyId proxy;
+        if (m_freeList != Collision::NullProxy)
+        {
+            proxy = m_freeList;
+            m_freeList = m_proxies[proxy].nextFree;
+        }
+        else
+        {
+            proxy = static_cast<Collision::ProxyId>(m_proxies.size());
+            m_proxies.emplace_back();
+            m_queryStamps.push_back(0);
+        }
+        Proxy& newProxy = m_proxies[proxy];
+        newProxy.sprite = &sprite;
+        newProxy.bounds = sprite.getBounds();
+        newProxy.group = this->findGroup(sprite);
+        newProxy.nextFree = Collision::NullProxy;
+        if (newProxy.group >= 0)
+            m_groups[newProxy.group].size++;
+        this->link(proxy);
+        m_proxyCount++;
+        return proxy;
+    }
+
+    void SpriteIndex::update(Collision::ProxyId proxy)
+    {
+        Proxy& current = m_proxies[proxy];
+        current.bounds = current.sprite->getBounds();
+        if (current.group < 0)
+            return;
+        const CellRange newCells = this->getCellRange(current.bounds);
+        if (newCells == current.cells)
+            return;
+        this->unlink(proxy);
+        this->link(proxy);
+    }
+
+    void SpriteIndex::regroup(Collision::ProxyId proxy)
+    {
+        this->unlink(proxy);
+        Proxy& current = m_proxies[proxy];
+        if (current.group >= 0)
+            m_groups[current.group].size--;
+        current.bounds = current.sprite->getBounds();
+        current.group = this->findGroup(*current.sprite);
+        if (current.group >= 0)
+            m_groups[current.group].size++;
+        this->link(proxy);
+    }
+
+    void SpriteIndex::remove(Collision::ProxyId proxy)
+    {
+        this->unlink(proxy);
+        Proxy& current = m_proxies[proxy];
+        if (current.group >= 0)
+            m_groups[current.group].size--;
+        current = Proxy();
+        current.nextFree = m_freeList;
+        m_freeList = proxy;
+        m_proxyCount--;
+    }
+
+    void SpriteIndex::setDrawOrder(Collision::ProxyId proxy, std::size_t drawOrder)
+    {
+        m_proxies[proxy].drawOrder = drawOrder;
+    }
+
+    void SpriteIndex::query(const Transform::UnitVector& camera,
+        const Transform::UnitVector& viewSize, std::vector<Sprite*>& result) const
+    {
+        if (++m_currentStamp == 0)
+        {
+            std::fill(m_queryStamps.begin(), m_queryStamps.end(), 0);
+            m_currentStamp = 1;
+        }
+        m_found = m_uncullableProxies;
+        for (std::size_t group = 0; group < m_groups.size(); group++)
+        {
+            if (m_groups[group].size == 0)
+                continue;
+            const Collision::AABB area
+                = this->getVisibleArea(m_groups[group], camera, viewSize);
+            const auto visit = [&](const std::vector<Collision::ProxyId>& content) {
+                for (const Collision::ProxyId proxy : content)
+                {
+                    if (m_queryStamps[proxy] == m_currentStamp
+                        || m_proxies[proxy].group != static_cast<int>(group))
+                        continue;
+                    m_queryStamps[proxy] = m_currentStamp;
+                    if (m_proxies[proxy].bounds.intersects(area))
+                        m_found.push_back(proxy);
+                }
+            };
+
+            visit(m_largeProxies);
+            const CellRange cells = this->getCellRange(area);
+            // Very large areas are cheaper to resolve by walking the occupied cells
+            if (cells.getCellCount() > m_cells.size())
+            {
+                for (const auto& [key, content] : m_cells)
+                    visit(content);
+                continue;
+            }
+            for (std::int64_t x = cells.minX; x <= cells.maxX; x++)
+            {
+                for (std::int64_t y = cells.minY; y <= cells.maxY; y++)
+                {
+                    const auto cell = m_cells.find(getCellKey(x, y));
+                    if (cell != m_cells.end())
+                        visit(cell->second);
+                }
+            }
+        }
+
+        std::sort(m_found.begin(), m_found.end(),
+            [this](Collision::ProxyId first, Collision::ProxyId second) {
+                return m_proxies[first].drawOrder < m_proxies[second].drawOrder;
+            });
+        for (const Collision::ProxyId proxy : m_found)
+            result.push_back(m_proxies[proxy].sprite);
+    }
+
+    void SpriteIndex::setDeferUpdates(bool defer)
+    {
+        m_deferUpdates = defer;
+    }
+
+    bool SpriteIndex::isDeferringUpdates() const
+    {
+        return m_deferUpdates;
+    }
+
+    std::size_t SpriteIndex::size() const
+    {
+        return m_proxyCount;
+    }
+} // namespace obe::Graphics
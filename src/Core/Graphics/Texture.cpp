@@ -16,6 +16,12 @@ namespace obe::Graphics
         m_texture = texture;
     }
 
+    Texture::Texture(std::shared_ptr<sf::Texture> texture, const sf::IntRect& subRect)
+    {
+        m_texture = texture;
+        m_subRect = subRect;
+    }
+
     Texture::Texture(const sf::Texture& texture)
     {
         m_texture = &texture;
@@ -35,14 +41,25 @@ namespace obe::Graphics
         {
             m_texture = std::get<const sf::Texture*>(copy.m_texture);
         }
+        m_subRect = copy.m_subRect;
     }
 
     Texture::~Texture()
     {
     }
 
+    void Texture::checkNotPacked(std::string_view method) const
+    {
+        // Other Textures are packed in the same page
+        if (m_subRect)
+        {
+            throw Exceptions::ReadOnlyTexture(method, EXC_INFO);
+        }
+    }
+
     bool Texture::create(unsigned width, unsigned height)
     {
+        this->checkNotPacked("create");
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
             return std::get<sf::Texture>(m_texture).create(width, height);
@@ -61,6 +78,7 @@ namespace obe::Graphics
 
     bool Texture::loadFromFile(const std::string& filename)
     {
+        this->checkNotPacked("loadFromFile");
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
             return std::get<sf::Texture>(m_texture).loadFromFile(filename);
@@ -79,6 +97,7 @@ namespace obe::Graphics
 
     bool Texture::loadFromFile(const std::string& filename, const Transform::Rect& rect)
     {
+        this->checkNotPacked("loadFromFile");
         const Transform::UnitVector position
             = rect.getPosition().to<Transform::Units::ScenePixels>();
         const Transform::UnitVector size
@@ -102,6 +121,7 @@ namespace obe::Graphics
 
     bool Texture::loadFromImage(const sf::Image& image)
     {
+        this->checkNotPacked("loadFromImage");
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
             return std::get<sf::Texture>(m_texture).loadFromImage(image);
@@ -120,6 +140,11 @@ namespace obe::Graphics
 
     Transform::UnitVector Texture::getSize() const
     {
+        if (m_subRect)
+        {
+            return Transform::UnitVector(
+                m_subRect->width, m_subRect->height, Transform::Units::ScenePixels);
+        }
         sf::Vector2u textureSize;
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
@@ -137,8 +162,22 @@ namespace obe::Graphics
             textureSize.x, textureSize.y, Transform::Units::ScenePixels);
     }
 
+    bool Texture::hasSubRect() const
+    {
+        return m_subRect.has_value();
+    }
+
+    sf::IntRect Texture::getSubRect() const
+    {
+        if (m_subRect)
+            return *m_subRect;
+        const Transform::UnitVector size = this->getSize();
+        return sf::IntRect(0, 0, size.x, size.y);
+    }
+
     void Texture::setAntiAliasing(bool antiAliasing)
     {
+        this->checkNotPacked("setAntiAliasing");
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
             return std::get<sf::Texture>(m_texture).setSmooth(antiAliasing);
@@ -173,6 +212,7 @@ namespace obe::Graphics
 
     void Texture::setRepeated(bool repeated)
     {
+        this->checkNotPacked("setRepeated");
         if (std::holds_alternative<sf::Texture>(m_texture))
         {
             return std::get<sf::Texture>(m_texture).setRepeated(repeated);
@@ -208,6 +248,7 @@ namespace obe::Graphics
     void Texture::reset()
     {
         m_texture = sf::Texture {};
+        m_subRect.reset();
     }
 
     unsigned Texture::useCount()
@@ -267,18 +308,21 @@ namespace obe::Graphics
         {
             m_texture = std::get<const sf::Texture*>(copy.m_texture);
         }
+        m_subRect = copy.m_subRect;
         return *this;
     }
 
     Texture& Texture::operator=(const sf::Texture& texture)
     {
         m_texture = &texture;
+        m_subRect.reset();
         return *this;
     }
 
     Texture& Texture::operator=(std::shared_ptr<sf::Texture> texture)
     {
         m_texture = texture;
+        m_subRect.reset();
         return *this;
     }
 }
@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <limits>
+
+#include <Graphics/TextureAtlas.hpp>
+
+namespace obe::Graphics
+{
+    SkylinePacker::SkylinePacker(int width, int height)
+        : m_width(width)
+        , m_height(height)
+    {
+        this->clear();
+    }
+
+    std::optional<int> SkylinePacker::fit(std::size_t index, int width, int height) const
+    {
+        const int x = m_skyline[index].x;
+        if (x + width > m_width)
+            return std::nullopt;
+        // The rectangle rests on the highest segment below its whole width
+        int y = m_skyline[index].y;
+        int widthLeft = width;
+        for (std::size_t i = index; widthLeft > 0; i++)
+        {
+            y = std::max(y, m_skyline[i].y);
+            if (y + height > m_height)
+                return std::nullopt;
+            widthLeft -= m_skyline[i].width;
+        }
+        return y;
+    }
+
+    void SkylinePacker::addSegment(std::size_t index, const sf::IntRect& rect)
+    {
+        m_skyline.insert(m_skyline.begin() + index,
+            Segment { rect.left, rect.top + rect.height, rect.width });
+        // Shrinks or removes the segments now covered by the new one
+        for (std::size_t i = index + 1; i < m_skyline.size();)
+        {
+            const Segment& previous = m_skyline[i - 1];
+            const int overlap = previous.x + previous.width - m_skyline[i].x;
+            if (overlap <= 0)
+                break;
+            if (m_skyline[i].width <= overlap)
+            {
+                m_skyline.erase(m_skyline.begin() + i);
+                continue;
+            }
+            m_skyline[i].x += overlap;
+            m_skyline[i].width -= overlap;
+            break;
+        }
+        for (std::size_t i = 0; i + 1 < m_skyline.size();)
+        {
+            if (m_skyline[i].y == m_skyline[i + 1].y)
+            {
+                m_skyline[i].width += m_skyline[i + 1].width;
+                m_skyline.erase(m_skyline.begin() + i + 1);
+            }
+            else
+                i++;
+        }
+    }
+
+    std::optional<sf::IntRect> SkylinePacker::insert(int width, int height)
+    {
+        if (width <= 0 || height <= 0)
+            return std::nullopt;
+        std::size_t bestIndex = m_skyline.size();
+        int bestTop = std::numeric_limits<int>::max();
+        int bestWidth = std::numeric_limits<int>::max();
+        int bestY = 0;
+        for (std::size_t i = 0; i < m_skyline.size(); i++)
+        {
+            if (const std::optional<int> y = this->fit(i, width, height))
+            {
+                const int top = *y + height;
+                if (top < bestTop || (top == bestTop && m_skyline[i].width < bestWidth))
+                {
+                    bestIndex = i;
+                    bestTop = top;
+                    bestWidth = m_skyline[i].width;
+                    bestY = *y;
+                }
+            }
+        }
+        if (bestIndex == m_skyline.size())
+            return std::nullopt;
+        const sf::IntRect rect(m_skyline[bestIndex].x, bestY, width, height);
+        this->addSegment(bestIndex, rect);
+        m_usedArea += static_cast<std::size_t>(width) * height;
+        return rect;
+    }
+
+    void SkylinePacker::clear()
+    {
+        m_skyline.clear();
+        m_skyline.push_back(Segment { 0, 0, m_width });
+        m_usedArea = 0;
+    }
+
+    double SkylinePacker::getOccupancy() const
+    {
+        return static_cast<double>(m_usedArea)
+            / (static_cast<double>(m_width) * static_cast<double>(m_height));
+    }
+
+    TextureAtlas::TextureAtlas(
+        unsigned int pageSize, bool antiAliasing, unsigned int padding)
+        : m_pageSize(pageSize)
+        , m_padding(padding)
+        , m_antiAliasing(antiAliasing)
+    {
+    }
+
+    std::optional<Texture> TextureAtlas::insert(const sf::Image& image)
+    {
+        if (image.getSize().x == 0 || image.getSize().y == 0)
+            return std::nullopt;
+        const int width = image.getSize().x + m_padding;
+        const int height = image.getSize().y + m_padding;
+        if (width > static_cast<int>(m_pageSize) || height > static_cast<int>(m_pageSize))
+            return std::nullopt;
+
+        for (Page& page : m_pages)
+        {
+            if (const std::optional<sf::IntRect> area = page.packer.insert(width, height))
+            {
+                page.texture->update(image, area->left, area->top);
+                return Texture(page.texture,
+                    sf::IntRect(area->left, area->top, image.getSize().x,
+                        image.getSize().y));
+            }
+        }
+
+        // Pages are cleared so the padding does not sample uninitialized pixels
+        sf::Image blank;
+        blank.create(m_pageSize, m_pageSize, sf::Color::Transparent);
+        Page& page = m_pages.emplace_back(Page { std::make_shared<sf::Texture>(),
+            SkylinePacker(m_pageSize, m_pageSize) });
+        page.texture->loadFromImage(blank);
+        page.texture->setSmooth(m_antiAliasing);
+        const sf::IntRect area = *page.packer.insert(width, height);
+        page.texture->update(image, area.left, area.top);
+        return Texture(page.texture,
+            sf::IntRect(area.left, area.top, image.getSize().x, image.getSize().y));
+    }
+
+    bool TextureAtlas::removePage(const sf::Texture& page)
+    {
+        const auto found = std::find_if(m_pages.begin(), m_pages.end(),
+            [&page](const Page& current) { return current.texture.get() == &page; });
+        if (found == m_pages.end())
+            return false;
+        m_pages.erase(found);
+        return true;
+    }
+
+    std::size_t TextureAtlas::getPageCount() const
+    {
+        return m_pages.size();
+    }
+
+    double TextureAtlas::getOccupancy() const
+    {
+        if (m_pages.empty())
+            return 0;
+        double occupancy = 0;
+        for (const Page& page : m_pages)
+            occupancy += page.packer.getOccupancy();
+        return occupancy / m_pages.size();
+    }
+} // namespace obe::Graphics
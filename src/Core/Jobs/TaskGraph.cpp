@@ -0,0 +1,158 @@
+#include <chrono>
+#include <exception>
+
+#include <Jobs/Exceptions.hpp>
+#include <Jobs/TaskGraph.hpp>
+
+namespace obe::Jobs
+{
+    namespace
+    {
+        struct GraphRun
+        {
+            std::unique_ptr<std::atomic<std::size_t>[]> remaining;
+            std::atomic<std::size_t> done = 0;
+            std::atomic<bool> failed = false;
+            std::exception_ptr error;
+            std::mutex mutex;
+            std::condition_variable finished;
+        };
+    }
+
+    void TaskGraph::checkTask(TaskId task) const
+    {
+        if (task >= m_nodes.size())
+            throw Exceptions::UnknownTask(task, m_nodes.size(), EXC_INFO);
+    }
+
+    void TaskGraph::checkAcyclic() const
+    {
+        std::vector<std::size_t> remaining(m_nodes.size());
+        std::vector<TaskId> ready;
+        for (TaskId task = 0; task < m_nodes.size(); task++)
+        {
+            remaining[task] = m_nodes[task].dependencies;
+            if (remaining[task] == 0)
+                ready.push_back(task);
+        }
+        std::size_t visited = 0;
+        while (!ready.empty())
+        {
+            const TaskId task = ready.back();
+            ready.pop_back();
+            visited++;
+            for (const TaskId successor : m_nodes[task].successors)
+            {
+                if (--remaining[successor] == 0)
+                    ready.push_back(successor);
+            }
+        }
+        if (visited != m_nodes.size())
+        {
+            throw Exceptions::CyclicTaskGraph(
+                m_nodes.size(), m_nodes.size() - visited, EXC_INFO);
+        }
+    }
+
+    TaskGraph::TaskId TaskGraph::add(Task task)
+    {
+        m_nodes.push_back(Node { std::move(task), {}, 0 });
+        return m_nodes.size() - 1;
+    }
+
+    void TaskGraph::precede(TaskId task, TaskId successor)
+    {
+        this->checkTask(task);
+        this->checkTask(successor);
+        m_nodes[task].successors.push_back(successor);
+        m_nodes[successor].dependencies++;
+    }
+
+    void TaskGraph::run(ThreadPool& pool) const
+    {
+        if (m_nodes.empty())
+            return;
+        this->checkAcyclic();
+
+        // Shared with the tasks as the last one may still be notifying when
+        // the caller returns
+        const auto state = std::make_shared<GraphRun>();
+        state->remaining = std::make_unique<std::atomic<std::size_t>[]>(m_nodes.size());
+        for (TaskId task = 0; task < m_nodes.size(); task++)
+            state->remaining[task] = m_nodes[task].dependencies;
+
+        const std::size_t tasksAmount = m_nodes.size();
+        const auto execute = [this, &pool, state, tasksAmount](
+                                 TaskId task, const auto& self) -> void {
+            // Copied as the caller returns (destroying this closure) as soon as
+            // the last task is counted
+            const std::shared_ptr<GraphRun> run = state;
+            const std::size_t total = tasksAmount;
+            // The last successor made ready runs on this thread, the others
+            // are submitted
+            while (true)
+            {
+                const Node& node = m_nodes[task];
+                if (!run->failed)
+                {
+                    try
+                    {
+                        node.task();
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard lock(run->mutex);
+                        if (!run->error)
+                            run->error = std::current_exception();
+                        run->failed = true;
+                    }
+                }
+                bool hasNext = false;
+                TaskId next = 0;
+                for (const TaskId successor : node.successors)
+                {
+                    if (--run->remaining[successor] != 0)
+                        continue;
+                    if (hasNext)
+                        pool.submit([next, &self]() { self(next, self); });
+                    next = successor;
+                    hasNext = true;
+                }
+                if (run->done.fetch_add(1) + 1 == total)
+                {
+                    std::lock_guard lock(run->mutex);
+                    run->finished.notify_all();
+                }
+                if (!hasNext)
+                    return;
+                task = next;
+            }
+        };
+        for (TaskId task = 0; task < m_nodes.size(); task++)
+        {
+            if (m_nodes[task].dependencies == 0)
+                pool.submit([task, &execute]() { execute(task, execute); });
+        }
+
+        while (state->done != m_nodes.size())
+        {
+            if (pool.runPendingTask())
+                continue;
+            std::unique_lock lock(state->mutex);
+            state->finished.wait_for(lock, std::chrono::milliseconds(1),
+                [&state, this]() { return state->done == m_nodes.size(); });
+        }
+        if (state->error)
+            std::rethrow_exception(state->error);
+    }
+
+    std::size_t TaskGraph::size() const
+    {
+        return m_nodes.size();
+    }
+
+    void TaskGraph::clear()
+    {
+        m_nodes.clear();
+    }
+} // namespace obe::Jobs
@@ -0,0 +1,256 @@
+#include <algorithm>
+#include <exception>
+
+#include <Debug/Logger.hpp>
+#include <Jobs/ThreadPool.hpp>
+
+namespace obe::Jobs
+{
+    namespace
+    {
+        thread_local const ThreadPool* CurrentPool = nullptr;
+        thread_local std::size_t CurrentWorker = 0;
+
+        void runTask(const Task& task)
+        {
+            try
+            {
+                task();
+            }
+            catch (const std::exception& e)
+            {
+                Debug::Log->error("<ThreadPool> Task failed : {}", e.what());
+            }
+            catch (...)
+            {
+                // Escaping the worker would terminate the program
+                Debug::Log->error("<ThreadPool> Task failed with an unknown exception");
+            }
+        }
+
+        struct Loop
+        {
+            std::size_t count;
+            std::size_t grain;
+            std::size_t chunks;
+            std::atomic<std::size_t> next = 0;
+            std::atomic<std::size_t> done = 0;
+            std::atomic<bool> failed = false;
+            std::exception_ptr error;
+            std::mutex mutex;
+            std::condition_variable finished;
+
+            // Takes chunks until there are none left, the body is only used
+            // for a taken chunk so the caller is still waiting for it
+            void run(const RangeTask& body)
+            {
+                std::size_t chunk;
+                while ((chunk = next.fetch_add(1)) < chunks)
+                {
+                    if (!failed)
+                    {
+                        const std::size_t begin = chunk * grain;
+                        try
+                        {
+                            body(begin, std::min(begin + grain, count));
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard lock(mutex);
+                            if (!error)
+                                error = std::current_exception();
+                            failed = true;
+                        }
+                    }
+                    if (done.fetch_add(1) + 1 == chunks)
+                    {
+                        std::lock_guard lock(mutex);
+                        finished.notify_all();
+                    }
+                }
+            }
+        };
+    }
+
+    std::size_t ThreadPool::getDefaultWorkerCount()
+    {
+        const unsigned int threads = std::thread::hardware_concurrency();
+        return (threads > 1) ? threads - 1 : 0;
+    }
+
+    ThreadPool::ThreadPool(std::size_t workers)
+    {
+        m_queues.reserve(workers);
+        for (std::size_t i = 0; i < workers; i++)
+            m_queues.push_back(std::make_unique<Queue>());
+        m_workers.reserve(workers);
+        for (std::size_t i = 0; i < workers; i++)
+            m_workers.emplace_back(&ThreadPool::work, this, i);
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(m_sleepMutex);
+            m_stopping = true;
+        }
+        m_wakeUp.notify_all();
+        for (std::thread& worker : m_workers)
+            worker.join();
+    }
+
+    bool ThreadPool::pop(std::size_t worker, Task& task)
+    {
+        // Newest task of its own queue first (its data is likely still in
+        // cache), then the oldest task of the other queues
+        for (std::size_t i = 0; i < m_queues.size(); i++)
+        {
+            Queue& queue = *m_queues[(worker + i) % m_queues.size()];
+            std::lock_guard lock(queue.mutex);
+            if (queue.tasks.empty())
+                continue;
+            if (i == 0)
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            m_pending--;
+            return true;
+        }
+        return false;
+    }
+
+    void ThreadPool::work(std::size_t worker)
+    {
+        CurrentPool = this;
+        CurrentWorker = worker;
+        Task task;
+        while (true)
+        {
+            if (this->pop(worker, task))
+            {
+                runTask(task);
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock lock(m_sleepMutex);
+            m_wakeUp.wait(lock, [this]() { return m_stopping || m_pending > 0; });
+            if (m_stopping && m_pending <= 0)
+                return;
+        }
+    }
+
+    void ThreadPool::submit(Task task)
+    {
+        if (m_workers.empty())
+        {
+            runTask(task);
+            return;
+        }
+        const std::size_t queueIndex = this->isWorkerThread()
+            ? CurrentWorker
+            : m_nextQueue.fetch_add(1) % m_queues.size();
+        {
+            Queue& queue = *m_queues[queueIndex];
+            std::lock_guard lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        {
+            // Counted once queued so a woken worker always finds it
+            std::lock_guard lock(m_sleepMutex);
+            m_pending++;
+        }
+        m_wakeUp.notify_one();
+    }
+
+    void ThreadPool::parallelFor(
+        std::size_t count, std::size_t grain, const RangeTask& body)
+    {
+        if (count == 0)
+            return;
+        grain = std::max<std::size_t>(grain, 1);
+        const std::size_t chunks = (count + grain - 1) / grain;
+        if (m_workers.empty() || chunks == 1)
+        {
+            for (std::size_t begin = 0; begin < count; begin += grain)
+                body(begin, std::min(begin + grain, count));
+            return;
+        }
+
+        const auto loop = std::make_shared<Loop>();
+        loop->count = count;
+        loop->grain = grain;
+        loop->chunks = chunks;
+        const std::size_t helpers = std::min(chunks - 1, m_workers.size());
+        for (std::size_t i = 0; i < helpers; i++)
+            this->submit([loop, &body]() { loop->run(body); });
+        loop->run(body);
+        {
+            std::unique_lock lock(loop->mutex);
+            loop->finished.wait(lock, [&loop]() { return loop->done == loop->chunks; });
+        }
+        if (loop->error)
+            std::rethrow_exception(loop->error);
+    }
+
+    bool ThreadPool::runPendingTask()
+    {
+        if (m_queues.empty())
+            return false;
+        const std::size_t queueIndex = this->isWorkerThread()
+            ? CurrentWorker
+            : m_nextQueue.load() % m_queues.size();
+        Task task;
+        if (!this->pop(queueIndex, task))
+            return false;
+        runTask(task);
+        return true;
+    }
+
+    void ThreadPool::postToMainThread(Task task)
+    {
+        std::lock_guard lock(m_mainThreadMutex);
+        m_mainThreadTasks.push_back(std::move(task));
+    }
+
+    std::size_t ThreadPool::runMainThreadTasks()
+    {
+        std::vector<Task> tasks;
+        {
+            std::lock_guard lock(m_mainThreadMutex);
+            tasks.swap(m_mainThreadTasks);
+        }
+        for (std::size_t i = 0; i < tasks.size(); i++)
+        {
+            try
+            {
+                tasks[i]();
+            }
+            catch (...)
+            {
+                // The tasks following the failed one run on the next call
+                std::lock_guard lock(m_mainThreadMutex);
+                m_mainThreadTasks.insert(m_mainThreadTasks.begin(),
+                    std::make_move_iterator(tasks.begin() + i + 1),
+                    std::make_move_iterator(tasks.end()));
+                throw;
+            }
+        }
+        return tasks.size();
+    }
+
+    std::size_t ThreadPool::getWorkerCount() const
+    {
+        return m_workers.size();
+    }
+
+    bool ThreadPool::isWorkerThread() const
+    {
+        return CurrentPool == this;
+    }
+} // namespace obe::Jobs
@@ -63,4 +63,19 @@ namespace obe::Scene
     {
         return m_size;
     }
+
+    Transform::UnitVector Camera::getInterpolatedPosition(double interpolation) const
+    {
+        const Transform::UnitVector position
+            = Rect::getPosition(Transform::Referential::TopLeft);
+        if (!m_hasPreviousPosition || interpolation >= 1)
+            return position;
+        return m_previousPosition + (position - m_previousPosition) * interpolation;
+    }
+
+    void Camera::storePreviousPosition()
+    {
+        m_previousPosition = Rect::getPosition(Transform::Referential::TopLeft);
+        m_hasPreviousPosition = true;
+    }
 } // namespace obe::Scene
\ No newline at end of file
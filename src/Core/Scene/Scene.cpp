@@ -1,4 +1,13 @@
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <optional>
+
+#include <SFML/Graphics/Image.hpp>
+
 #include <Config/Templates/Scene.hpp>
+#include <Debug/Profiler.hpp>
+#include <Jobs/ThreadPool.hpp>
 #include <Scene/Exceptions.hpp>
 #include <Scene/Scene.hpp>
 #include <Script/ViliLuaBridge.hpp>
@@ -13,6 +22,129 @@
 
 namespace obe::Scene
 {
+    namespace
+    {
+        // GameObjects updated by a task of the native update phase
+        constexpr std::size_t NativeUpdateGrain = 64;
+
+        bool isDrawnBefore(const std::unique_ptr<Graphics::Sprite>& sprite1,
+            const std::unique_ptr<Graphics::Sprite>& sprite2)
+        {
+            if (sprite1->getLayer() == sprite2->getLayer())
+            {
+                return sprite1->getZDepth() > sprite2->getZDepth();
+            }
+            else
+            {
+                return sprite1->getLayer() > sprite2->getLayer();
+            }
+        }
+
+        template <class T>
+        T* findById(
+            const std::unordered_map<std::string, T*>& index, const std::string& id)
+        {
+            const auto element = index.find(id);
+            return (element != index.end()) ? element->second : nullptr;
+        }
+
+        template <class T>
+        typename std::vector<std::unique_ptr<T>>::iterator findByAddress(
+            std::vector<std::unique_ptr<T>>& elements, const T* element)
+        {
+            return std::find_if(elements.begin(), elements.end(),
+                [element](const std::unique_ptr<T>& ptr) {
+                    return ptr.get() == element;
+                });
+        }
+    }
+
+    struct Scene::AsyncLoad
+    {
+        enum class ElementType
+        {
+            Sprite,
+            Collider,
+            GameObject
+        };
+        struct Element
+        {
+            ElementType type;
+            const std::string* id;
+            vili::node* data;
+        };
+
+        std::string path;
+        std::string previousScene;
+        std::atomic<bool> cancelled = false;
+        // Written by a worker, only read on the main thread once ready
+        vili::node data;
+        std::vector<std::pair<std::string, std::unique_ptr<sf::Image>>> images;
+        std::exception_ptr error;
+        bool ready = false;
+        // Created on the main thread, a few at each update
+        bool started = false;
+        std::vector<Element> elements;
+        std::size_t created = 0;
+
+        void read(Jobs::ThreadPool& threadPool);
+        void listElements();
+    };
+
+    void Scene::AsyncLoad::read(Jobs::ThreadPool& threadPool)
+    {
+        try
+        {
+            data = Config::LoadFile(Config::FindFile(System::Path(path)),
+                Config::Templates::getSceneTemplates());
+            std::vector<std::string> paths;
+            if (data.contains("Sprites"))
+            {
+                for (auto& [spriteId, sprite] : data.at("Sprites").items())
+                {
+                    if (!sprite.contains("path"))
+                        continue;
+                    const std::string spritePath = sprite.at("path");
+                    paths.push_back(spritePath);
+                }
+            }
+            std::sort(paths.begin(), paths.end());
+            paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+
+            // Images failing to decode are read again (and reported) by the
+            // ResourceManager
+            images.resize(paths.size());
+            const auto decode = [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end && !cancelled; i++)
+                {
+                    auto image = std::make_unique<sf::Image>();
+                    if (image->loadFromFile(System::Path(paths[i]).find()))
+                        images[i] = std::make_pair(paths[i], std::move(image));
+                }
+            };
+            threadPool.parallelFor(paths.size(), 1, decode);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    }
+
+    void Scene::AsyncLoad::listElements()
+    {
+        const std::pair<const char*, ElementType> sections[]
+            = { { "Sprites", ElementType::Sprite },
+                  { "Collisions", ElementType::Collider },
+                  { "GameObjects", ElementType::GameObject } };
+        for (const auto& [section, type] : sections)
+        {
+            if (!data.contains(section))
+                continue;
+            for (auto& [id, element] : data.at(section).items())
+                elements.push_back(Element { type, &id, &element });
+        }
+    }
+
     Scene::Scene(Triggers::TriggerManager& triggers, sol::state_view lua)
         : m_lua(lua)
         , m_triggers(triggers)
@@ -22,78 +154,83 @@ namespace obe::Scene
         triggers.createNamespace("Map"); // TODO: Add namespace handle
         m_showElements["SceneNodes"] = false;
 
+        t_scene->add("Loading");
         t_scene->add("Loaded");
     }
 
+    Scene::~Scene()
+    {
+        if (m_asyncLoad)
+            m_asyncLoad->cancelled = true;
+    }
+
     void Scene::attachResourceManager(Engine::ResourceManager& resources)
     {
         m_resources = &resources;
     }
 
+    void Scene::attachThreadPool(Jobs::ThreadPool* threadPool)
+    {
+        m_threadPool = threadPool;
+    }
+
     Graphics::Sprite& Scene::createSprite(const std::string& id, bool addToSceneRoot)
     {
+        this->checkIds();
         std::string createId = id;
-        if (createId.empty())
+        while (createId.empty() || m_spriteIds.count(createId))
         {
-            int i = 0;
-            std::string testId = "sprite" + std::to_string(this->getColliderAmount() + i);
-            while (this->doesSpriteExists(testId))
+            if (!id.empty())
             {
-                testId = "sprite" + std::to_string(this->getSpriteAmount() + i++);
+                Debug::Log->warn("<Scene> Sprite '{0}' already exists !", createId);
+                return *m_spriteIds.at(createId);
             }
-            createId = testId;
+            createId = "sprite" + std::to_string(m_nextSpriteId++);
         }
-        if (!this->doesSpriteExists(createId))
-        {
-            std::unique_ptr<Graphics::Sprite> newSprite
-                = std::make_unique<Graphics::Sprite>(createId);
-            if (m_resources)
-                newSprite->attachResourceManager(*m_resources);
-
-            Graphics::Sprite* returnSprite = newSprite.get();
-            m_spriteArray.push_back(move(newSprite));
-
-            if (addToSceneRoot)
-                m_sceneRoot.addChild(*returnSprite);
 
-            this->reorganizeLayers();
-            return *returnSprite;
-        }
-        else
-        {
-            Debug::Log->warn("<Scene> Sprite '{0}' already exists !", createId);
-            return this->getSprite(createId);
-        }
+        std::unique_ptr<Graphics::Sprite> newSprite
+            = std::make_unique<Graphics::Sprite>(createId);
+        if (m_resources)
+            newSprite->attachResourceManager(*m_resources);
+        newSprite->attachSpriteIndex(&m_spriteIndex);
+
+        Graphics::Sprite* returnSprite = newSprite.get();
+        m_spriteIds.emplace(createId, returnSprite);
+        // Sprites with a changed layer may be out of order until the next
+        // reorganizeChangedLayers, the new Sprite is sorted along with them
+        newSprite->m_layerChanged = true;
+        m_spriteArray.push_back(move(newSprite));
+        if (!m_deferLayerSort)
+            this->updateDrawOrder(m_spriteArray.size() - 1);
+
+        if (addToSceneRoot)
+            m_sceneRoot.addChild(*returnSprite);
+        return *returnSprite;
     }
 
     Collision::PolygonalCollider& Scene::createCollider(
         const std::string& id, bool addToSceneRoot)
     {
+        this->checkIds();
         std::string createId = id;
-        if (createId.empty())
+        while (createId.empty() || m_colliderIds.count(createId))
         {
-            int i = 0;
-            std::string testId
-                = "collider" + std::to_string(this->getColliderAmount() + i);
-            while (this->doesColliderExists(testId))
+            if (!id.empty())
             {
-                testId = "collider" + std::to_string(this->getColliderAmount() + i++);
+                Debug::Log->warn("<Scene> Collider '{0}' already exists !", createId);
+                return *m_colliderIds.at(createId);
             }
-            createId = testId;
-        }
-        if (!this->doesColliderExists(createId))
-        {
-            m_colliderArray.push_back(
-                std::make_unique<Collision::PolygonalCollider>(createId));
-            if (addToSceneRoot)
-                m_sceneRoot.addChild(*m_colliderArray.back());
-            return *m_colliderArray.back().get();
-        }
-        else
-        {
-            Debug::Log->warn("<Scene> Collider '{0}' already exists !", createId);
-            return this->getCollider(createId);
+            createId = "collider" + std::to_string(m_nextColliderId++);
         }
+
+        m_colliderArray.push_back(
+            std::make_unique<Collision::PolygonalCollider>(createId));
+        Collision::PolygonalCollider* returnCollider = m_colliderArray.back().get();
+        m_colliderIds.emplace(createId, returnCollider);
+        returnCollider->attachBroadPhase(m_broadPhase.get());
+        if (addToSceneRoot)
+            m_sceneRoot.addChild(*returnCollider);
+        return *returnCollider;
     }
 
     std::size_t Scene::getColliderAmount() const
@@ -126,8 +263,14 @@ namespace obe::Scene
         Debug::Log->debug("<Scene> Cleared Scene");
 
         m_levelFileName = path;
-        vili::node sceneFile = vili::parser::from_file(
-            System::Path(path).find(), Config::Templates::getSceneTemplates());
+        const std::string filePath = Config::FindFile(System::Path(path));
+        if (const auto compiled = Config::OpenCompiledFile(filePath))
+        {
+            this->loadCompiled(compiled->getRoot());
+            return;
+        }
+        vili::node sceneFile
+            = vili::parser::from_file(filePath, Config::Templates::getSceneTemplates());
         this->load(sceneFile);
     }
 
@@ -143,8 +286,138 @@ namespace obe::Scene
         m_onLoadCallback = callback;
     }
 
+    void Scene::setLoadingBudget(Time::TimeUnit budget)
+    {
+        m_loadingBudget = budget;
+    }
+
+    Time::TimeUnit Scene::getLoadingBudget() const
+    {
+        return m_loadingBudget;
+    }
+
+    bool Scene::isLoading() const
+    {
+        return m_asyncLoad != nullptr;
+    }
+
+    double Scene::getLoadingProgress() const
+    {
+        if (!m_asyncLoad || !m_asyncLoad->started)
+            return 0;
+        if (m_asyncLoad->elements.empty())
+            return 1;
+        return static_cast<double>(m_asyncLoad->created)
+            / static_cast<double>(m_asyncLoad->elements.size());
+    }
+
+    void Scene::startAsyncLoad(const std::string& path)
+    {
+        Debug::Log->debug("<Scene> Loading Scene from map file : '{0}' in the "
+                          "background",
+            path);
+        if (m_asyncLoad)
+            m_asyncLoad->cancelled = true;
+        const auto load = std::make_shared<AsyncLoad>();
+        load->path = path;
+        load->previousScene = m_levelFileName;
+        m_asyncLoad = load;
+
+        Jobs::ThreadPool& threadPool = *m_threadPool;
+        threadPool.submit([load, &threadPool]() {
+            if (!load->cancelled)
+                load->read(threadPool);
+            // A cancelled load is not referenced by its Scene anymore
+            threadPool.postToMainThread([weakLoad = std::weak_ptr<AsyncLoad>(load)]() {
+                if (const std::shared_ptr<AsyncLoad> load = weakLoad.lock())
+                    load->ready = true;
+            });
+        });
+    }
+
+    void Scene::continueAsyncLoad()
+    {
+        const std::shared_ptr<AsyncLoad> load = m_asyncLoad;
+        if (!load->ready)
+            return;
+        OBE_PROFILE_ZONE("Scene::continueAsyncLoad");
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+        const std::chrono::duration<double> maxDuration(m_loadingBudget);
+        try
+        {
+            if (load->error)
+                std::rethrow_exception(load->error);
+            if (!load->started)
+            {
+                this->clear();
+                Debug::Log->debug("<Scene> Cleared Scene");
+                m_levelFileName = load->path;
+                for (auto& [path, image] : load->images)
+                {
+                    if (m_resources && image)
+                        m_resources->preloadImage(path, std::move(image));
+                }
+                load->images.clear();
+                this->loadView(load->data);
+                load->listElements();
+                load->started = true;
+            }
+            while (load->created < load->elements.size())
+            {
+                const AsyncLoad::Element& element = load->elements[load->created++];
+                switch (element.type)
+                {
+                case AsyncLoad::ElementType::Sprite:
+                    this->createSprite(*element.id).load(*element.data);
+                    break;
+                case AsyncLoad::ElementType::Collider:
+                    this->createCollider(*element.id).load(*element.data);
+                    break;
+                case AsyncLoad::ElementType::GameObject:
+                    this->loadGameObject(*element.id, *element.data);
+                    break;
+                }
+                if (Clock::now() - start >= maxDuration)
+                    break;
+            }
+        }
+        catch (...)
+        {
+            m_asyncLoad.reset();
+            m_deferLayerSort = false;
+            throw;
+        }
+
+        t_scene->pushParameter("Loading", "name", load->path);
+        t_scene->pushParameter("Loading", "progress", this->getLoadingProgress());
+        t_scene->trigger("Loading");
+        if (load->created < load->elements.size())
+            return;
+        m_asyncLoad.reset();
+        this->finishLoading(load->data);
+        this->runLoadCallback(load->previousScene, load->path);
+    }
+
+    void Scene::runLoadCallback(
+        const std::string& previousScene, const std::string& loadedScene)
+    {
+        if (!m_onLoadCallback)
+            return;
+        sol::protected_function_result result = m_onLoadCallback(loadedScene);
+        if (!result.valid())
+        {
+            const auto error = result.get<sol::error>();
+            const std::string errMsg = "\n        \""
+                + Utils::String::replace(error.what(), "\n", "\n        ") + "\"";
+            throw Exceptions::SceneOnLoadCallbackError(
+                previousScene, loadedScene, errMsg, EXC_INFO);
+        }
+    }
+
     void Scene::clear()
     {
+        m_deferLayerSort = false;
         if (m_resources)
         {
             m_resources->clean();
@@ -158,10 +431,14 @@ namespace obe::Scene
             }
         }
         Debug::Log->debug("<Scene> Cleaning GameObject Array");
+        this->checkIds();
         m_gameObjectArray.erase(
             std::remove_if(m_gameObjectArray.begin(), m_gameObjectArray.end(),
-                [](const std::unique_ptr<Script::GameObject>& ptr) {
-                    return (!ptr->isPermanent());
+                [this](const std::unique_ptr<Script::GameObject>& ptr) {
+                    if (ptr->isPermanent())
+                        return false;
+                    m_gameObjectIds.erase(ptr->getId());
+                    return true;
                 }),
             m_gameObjectArray.end());
         Debug::Log->debug("<Scene> Cleaning Sprite Array");
@@ -170,6 +447,7 @@ namespace obe::Scene
                                     if (!ptr->getParentId().empty()
                                         && this->doesGameObjectExists(ptr->getParentId()))
                                         return false;
+                                    m_spriteIds.erase(ptr->getId());
                                     return true;
                                 }),
             m_spriteArray.end());
@@ -180,9 +458,13 @@ namespace obe::Scene
                     if (!ptr->getParentId().empty()
                         && this->doesGameObjectExists(ptr->getParentId()))
                         return false;
+                    m_colliderIds.erase(ptr->getId());
                     return true;
                 }),
             m_colliderArray.end());
+        m_nextSpriteId = 0;
+        m_nextColliderId = 0;
+        m_nextGameObjectId = 0;
         Debug::Log->debug("<Scene> Clearing MapScript Array");
         m_scriptArray.clear();
         Debug::Log->debug("<Scene> Scene Cleared !");
@@ -250,8 +532,9 @@ namespace obe::Scene
         return result;
     }
 
-    void Scene::load(vili::node& data)
+    void Scene::loadView(vili::node& data)
     {
+        m_deferLayerSort = true;
         if (!data["Meta"].is_null())
         {
             vili::node& meta = data.at("Meta");
@@ -298,20 +581,45 @@ namespace obe::Scene
         }
         else
             throw Exceptions::MissingSceneFileBlock(m_levelFileName, "View", EXC_INFO);
+    }
+
+    void Scene::loadGameObject(const std::string& id, vili::node& data)
+    {
+        if (!this->doesGameObjectExists(id))
+        {
+            const std::string gameObjectType = data.at("type");
+            Script::GameObject& newObject = this->createGameObject(gameObjectType, id);
+            if (!data["Requires"].is_null())
+            {
+                vili::node& objectRequirements = data.at("Requires");
+                Script::GameObjectDatabase::ApplyRequirements(
+                    newObject.getEnvironment(), objectRequirements);
+            }
+            if (newObject.doesHaveScriptEngine())
+                newObject.exec("LuaCore.InjectInitInjectionTable()");
+        }
+        else if (!this->getGameObject(id).isPermanent())
+        {
+            throw Exceptions::GameObjectAlreadyExists(
+                m_levelFileName, this->getGameObject(id).getType(), id, EXC_INFO);
+        }
+    }
+
+    void Scene::load(vili::node& data)
+    {
+        this->loadView(data);
 
         if (!data["Sprites"].is_null())
         {
-            for (auto [spriteId, sprite] : data.at("Sprites").items())
+            for (auto& [spriteId, sprite] : data.at("Sprites").items())
             {
                 this->createSprite(spriteId).load(sprite);
             }
         }
 
-        this->reorganizeLayers();
-
         if (!data["Collisions"].is_null())
         {
-            for (auto [collisionId, collision] : data.at("Collisions").items())
+            for (auto& [collisionId, collision] : data.at("Collisions").items())
             {
                 this->createCollider(collisionId).load(collision);
             }
@@ -319,32 +627,64 @@ namespace obe::Scene
 
         if (!data["GameObjects"].is_null())
         {
-            vili::node& gameObjects = data.at("GameObjects");
-            for (auto [gameObjectId, gameObject] : gameObjects.items())
+            for (auto& [gameObjectId, gameObject] : data.at("GameObjects").items())
             {
-                if (!this->doesGameObjectExists(gameObjectId))
-                {
-                    const std::string gameObjectType = gameObject.at("type");
-                    Script::GameObject& newObject
-                        = this->createGameObject(gameObjectType, gameObjectId);
-                    if (!gameObject["Requires"].is_null())
-                    {
-                        vili::node& objectRequirements = gameObject.at("Requires");
-                        Script::GameObjectDatabase::ApplyRequirements(
-                            newObject.getEnvironment(), objectRequirements);
-                    }
-                    if (newObject.doesHaveScriptEngine())
-                        newObject.exec("LuaCore.InjectInitInjectionTable()");
-                }
-                else if (!this->getGameObject(gameObjectId).isPermanent())
-                {
-                    throw Exceptions::GameObjectAlreadyExists(m_levelFileName,
-                        this->getGameObject(gameObjectId).getType(), gameObjectId,
-                        EXC_INFO);
-                }
+                this->loadGameObject(gameObjectId, gameObject);
             }
         }
 
+        this->finishLoading(data);
+    }
+
+    void Scene::loadCompiled(const Config::CompiledNode& data)
+    {
+        // Only the small blocks are built as a whole
+        vili::node blocks = vili::object {};
+        std::optional<Config::CompiledNode> sprites;
+        std::optional<Config::CompiledNode> collisions;
+        std::optional<Config::CompiledNode> gameObjects;
+        for (std::size_t i = 0; i < data.size(); i++)
+        {
+            const Config::CompiledNode block = data.getChild(i);
+            const std::string_view key = block.getKey();
+            if (key == "Sprites")
+                sprites = block;
+            else if (key == "Collisions")
+                collisions = block;
+            else if (key == "GameObjects")
+                gameObjects = block;
+            else
+                blocks[std::string(key)] = block.toNode();
+        }
+        this->loadView(blocks);
+
+        for (std::size_t i = 0; sprites && i < sprites->size(); i++)
+        {
+            const Config::CompiledNode sprite = sprites->getChild(i);
+            vili::node spriteData = sprite.toNode();
+            this->createSprite(std::string(sprite.getKey())).load(spriteData);
+        }
+        for (std::size_t i = 0; collisions && i < collisions->size(); i++)
+        {
+            const Config::CompiledNode collision = collisions->getChild(i);
+            vili::node collisionData = collision.toNode();
+            this->createCollider(std::string(collision.getKey())).load(collisionData);
+        }
+        for (std::size_t i = 0; gameObjects && i < gameObjects->size(); i++)
+        {
+            const Config::CompiledNode gameObject = gameObjects->getChild(i);
+            vili::node gameObjectData = gameObject.toNode();
+            this->loadGameObject(std::string(gameObject.getKey()), gameObjectData);
+        }
+
+        this->finishLoading(blocks);
+    }
+
+    void Scene::finishLoading(vili::node& data)
+    {
+        m_deferLayerSort = false;
+        this->reorganizeLayers();
+
         if (!data["Script"].is_null())
         {
             vili::node& script = data.at("Script");
@@ -375,36 +715,92 @@ namespace obe::Scene
         t_scene->trigger("Loaded");
     }
 
+    void Scene::updateGameObjectsNative()
+    {
+        OBE_PROFILE_ZONE("Scene::updateGameObjectsNative");
+        m_nativeUpdates.clear();
+        for (const auto& gameObject : m_gameObjectArray)
+        {
+            if (gameObject->needsNativeUpdate())
+                m_nativeUpdates.push_back(gameObject.get());
+        }
+        const auto updateRange = [this](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                m_nativeUpdates[i]->updateNative();
+        };
+        // Sprites changing size would otherwise all modify the SpriteIndex
+        const auto applyIndexUpdates = [this]() {
+            m_spriteIndex.setDeferUpdates(false);
+            for (Script::GameObject* gameObject : m_nativeUpdates)
+            {
+                if (gameObject->m_sprite)
+                    gameObject->m_sprite->applyDeferredIndexUpdate();
+            }
+        };
+        m_spriteIndex.setDeferUpdates(true);
+        try
+        {
+            if (m_threadPool)
+            {
+                m_threadPool->parallelFor(
+                    m_nativeUpdates.size(), NativeUpdateGrain, updateRange);
+            }
+            else
+            {
+                // Zones can only be recorded from this thread, GameObjects are
+                // only timed when their updates are not parallel
+                for (Script::GameObject* gameObject : m_nativeUpdates)
+                {
+                    OBE_PROFILE_ZONE_ID(gameObject->m_profilerZone);
+                    gameObject->updateNative();
+                }
+            }
+        }
+        catch (...)
+        {
+            applyIndexUpdates();
+            throw;
+        }
+        applyIndexUpdates();
+    }
+
     void Scene::update()
     {
+        OBE_PROFILE_ZONE("Scene::update");
         if (!m_futureLoad.empty())
         {
             const std::string futureLoadBuffer = std::move(m_futureLoad);
-            const std::string currentScene = m_levelFileName;
-            this->loadFromFile(futureLoadBuffer);
-            if (m_onLoadCallback)
+            m_futureLoad.clear();
+            if (m_threadPool)
             {
-                sol::protected_function_result result
-                    = m_onLoadCallback(futureLoadBuffer);
-                if (!result.valid())
-                {
-                    const auto error = result.get<sol::error>();
-                    const std::string errMsg = "\n        \""
-                        + Utils::String::replace(error.what(), "\n", "\n        ") + "\"";
-                    throw Exceptions::SceneOnLoadCallbackError(
-                        currentScene, futureLoadBuffer, errMsg, EXC_INFO);
-                }
+                this->startAsyncLoad(futureLoadBuffer);
+            }
+            else
+            {
+                const std::string currentScene = m_levelFileName;
+                this->loadFromFile(futureLoadBuffer);
+                this->runLoadCallback(currentScene, futureLoadBuffer);
             }
         }
+        if (m_asyncLoad)
+        {
+            this->continueAsyncLoad();
+            // The new GameObjects are initialized once all of them exist
+            if (m_asyncLoad && m_asyncLoad->started)
+                return;
+        }
         if (m_updateState)
         {
+            this->updateGameObjectsNative();
+            // Initializing a GameObject runs Lua so it stays on this thread
             const size_t arraySize = m_gameObjectArray.size();
             for (size_t i = 0; i < arraySize; i++)
             {
                 Script::GameObject& gameObject = *m_gameObjectArray[i];
-                if (!gameObject.deletable)
+                if (!gameObject.deletable && !gameObject.m_active)
                     gameObject.update();
             }
+            this->checkIds();
             m_gameObjectArray.erase(
                 std::remove_if(m_gameObjectArray.begin(), m_gameObjectArray.end(),
                     [this](const std::unique_ptr<Script::GameObject>& ptr) {
@@ -416,6 +812,7 @@ namespace obe::Scene
                                 this->removeSprite(ptr->getSprite().getId());
                             if (ptr->m_collider)
                                 this->removeCollider(ptr->getCollider().getId());
+                            m_gameObjectIds.erase(ptr->getId());
                             return true;
                         }
                         return false;
@@ -426,26 +823,28 @@ namespace obe::Scene
 
     void Scene::draw(Graphics::RenderTarget surface)
     {
-        for (auto it = m_spriteArray.begin(); it != m_spriteArray.end(); ++it)
-        {
-            if (it->get()->m_layerChanged)
-            {
-                for (auto it2 = it; it2 != m_spriteArray.end(); ++it2)
-                {
-                    it2->get()->m_layerChanged = false;
-                }
-                this->reorganizeLayers();
-                break;
-            }
-        }
+        OBE_PROFILE_ZONE("Scene::draw");
+        this->reorganizeChangedLayers();
 
+        const Transform::UnitVector cameraPosition
+            = m_camera.getInterpolatedPosition(m_interpolation);
         const Transform::UnitVector pixelCamera
-            = m_camera.getPosition().to<Transform::Units::ScenePixels>();
+            = cameraPosition.to<Transform::Units::ScenePixels>();
+        const Transform::UnitVector viewSize(
+            Transform::UnitVector::View.w, Transform::UnitVector::View.h);
+        m_visibleSprites.clear();
+        m_spriteIndex.query(cameraPosition.to<Transform::Units::SceneUnits>(), viewSize,
+            m_visibleSprites);
+        m_culledSpriteAmount = m_spriteArray.size() - m_visibleSprites.size();
+        m_spriteBatch.clear();
+        m_spriteBatch.addSprites(m_visibleSprites, pixelCamera, m_interpolation);
+        m_drawnSpriteAmount = m_spriteBatch.getSpriteCount();
+        m_spriteBatch.draw(surface);
         for (auto& sprite : m_spriteArray)
         {
-            if (sprite->isVisible())
+            if (sprite->isVisible() && sprite->isSelected())
             {
-                sprite->draw(surface, pixelCamera);
+                sprite->drawHandle(surface, pixelCamera);
             }
         }
 
@@ -471,6 +870,23 @@ namespace obe::Scene
         }
     }
 
+    void Scene::storePreviousPositions()
+    {
+        m_camera.storePreviousPosition();
+        for (auto& sprite : m_spriteArray)
+            sprite->storePreviousPosition();
+    }
+
+    void Scene::setInterpolation(double interpolation)
+    {
+        m_interpolation = std::clamp(interpolation, 0.0, 1.0);
+    }
+
+    double Scene::getInterpolation() const
+    {
+        return m_interpolation;
+    }
+
     std::string Scene::getLevelName() const
     {
         return m_levelName;
@@ -505,11 +921,9 @@ namespace obe::Scene
 
     Script::GameObject& Scene::getGameObject(const std::string& id)
     {
-        for (auto& gameObject : m_gameObjectArray)
-        {
-            if (gameObject->getId() == id)
-                return *gameObject;
-        }
+        this->checkIds();
+        if (Script::GameObject* gameObject = findById(m_gameObjectIds, id))
+            return *gameObject;
         std::vector<std::string> objectIds;
         objectIds.reserve(m_gameObjectArray.size());
         for (const auto& object : m_gameObjectArray)
@@ -521,22 +935,18 @@ namespace obe::Scene
 
     bool Scene::doesGameObjectExists(const std::string& id)
     {
-        for (auto& gameObject : m_gameObjectArray)
-        {
-            if (gameObject->getId() == id)
-                return true;
-        }
-        return false;
+        this->checkIds();
+        return m_gameObjectIds.count(id);
     }
 
     void Scene::removeGameObject(const std::string& id)
     {
-        m_gameObjectArray.erase(
-            std::remove_if(m_gameObjectArray.begin(), m_gameObjectArray.end(),
-                [&id](const std::unique_ptr<Script::GameObject>& ptr) {
-                    return (ptr->getId() == id);
-                }),
-            m_gameObjectArray.end());
+        this->checkIds();
+        Script::GameObject* gameObject = findById(m_gameObjectIds, id);
+        if (!gameObject)
+            return;
+        m_gameObjectIds.erase(id);
+        m_gameObjectArray.erase(findByAddress(m_gameObjectArray, gameObject));
     }
 
     std::vector<Script::GameObject*> Scene::getAllGameObjects(
@@ -558,10 +968,7 @@ namespace obe::Scene
         if (useId.empty())
         {
             while (useId.empty() || this->doesGameObjectExists(useId))
-            {
-                useId = Utils::String::getRandomKey(
-                    Utils::String::Alphabet + Utils::String::Numbers, 8);
-            }
+                useId = "gameobject" + std::to_string(m_nextGameObjectId++);
         }
         else if (this->doesGameObjectExists(useId))
         {
@@ -575,6 +982,7 @@ namespace obe::Scene
             = Script::GameObjectDatabase::GetDefinitionForGameObject(obj);
         newGameObject->loadGameObject(*this, gameObjectData, m_resources);
 
+        m_gameObjectIds.emplace(useId, newGameObject.get());
         m_gameObjectArray.push_back(move(newGameObject));
 
         return *m_gameObjectArray.back();
@@ -585,19 +993,54 @@ namespace obe::Scene
         return m_gameObjectArray.size();
     }
 
+    void Scene::updateDrawOrder(std::size_t from)
+    {
+        for (std::size_t i = from; i < m_spriteArray.size(); i++)
+        {
+            m_spriteIndex.setDrawOrder(m_spriteArray[i]->getSpriteIndexProxy(), i);
+        }
+    }
+
     void Scene::reorganizeLayers()
     {
-        std::sort(
-            m_spriteArray.begin(), m_spriteArray.end(), [](auto& sprite1, auto& sprite2) {
-                if (sprite1->getLayer() == sprite2->getLayer())
-                {
-                    return sprite1->getZDepth() > sprite2->getZDepth();
-                }
-                else
-                {
-                    return sprite1->getLayer() > sprite2->getLayer();
-                }
+        std::stable_sort(m_spriteArray.begin(), m_spriteArray.end(), isDrawnBefore);
+        for (auto& sprite : m_spriteArray)
+        {
+            sprite->m_layerChanged = false;
+        }
+        this->updateDrawOrder();
+    }
+
+    void Scene::reorganizeChangedLayers()
+    {
+        if (m_deferLayerSort)
+            return;
+        const auto firstChanged = std::find_if(m_spriteArray.begin(), m_spriteArray.end(),
+            [](const std::unique_ptr<Graphics::Sprite>& sprite) {
+                return sprite->m_layerChanged;
             });
+        if (firstChanged == m_spriteArray.end())
+            return;
+        // Unchanged Sprites are still sorted, only the changed ones are sorted
+        // before being merged back
+        const auto middle = std::stable_partition(firstChanged, m_spriteArray.end(),
+            [](const std::unique_ptr<Graphics::Sprite>& sprite) {
+                return !sprite->m_layerChanged;
+            });
+        for (auto it = middle; it != m_spriteArray.end(); ++it)
+        {
+            it->get()->m_layerChanged = false;
+        }
+        std::stable_sort(middle, m_spriteArray.end(), isDrawnBefore);
+        // Sprites placed before the first changed one and before the place
+        // where the changed Sprites are merged keep their draw order
+        const auto firstMerged
+            = std::upper_bound(m_spriteArray.begin(), middle, *middle, isDrawnBefore);
+        const std::size_t firstMoved = std::distance(
+            m_spriteArray.begin(), std::min(firstChanged, firstMerged));
+        std::inplace_merge(
+            m_spriteArray.begin(), middle, m_spriteArray.end(), isDrawnBefore);
+        this->updateDrawOrder(firstMoved);
     }
 
     std::size_t Scene::getSpriteAmount() const
@@ -658,11 +1101,9 @@ namespace obe::Scene
 
     Graphics::Sprite& Scene::getSprite(const std::string& id)
     {
-        for (int i = 0; i < m_spriteArray.size(); i++)
-        {
-            if (m_spriteArray[i]->getId() == id)
-                return *m_spriteArray[i];
-        }
+        this->checkIds();
+        if (Graphics::Sprite* sprite = findById(m_spriteIds, id))
+            return *sprite;
         std::vector<std::string> spritesIds;
         spritesIds.reserve(m_spriteArray.size());
         for (const auto& sprite : m_spriteArray)
@@ -674,22 +1115,34 @@ namespace obe::Scene
 
     bool Scene::doesSpriteExists(const std::string& id)
     {
-        for (int i = 0; i < m_spriteArray.size(); i++)
-        {
-            if (m_spriteArray[i]->getId() == id)
-                return true;
-        }
-        return false;
+        this->checkIds();
+        return m_spriteIds.count(id);
     }
 
     void Scene::removeSprite(const std::string& id)
     {
         Debug::Log->debug("<Scene> Removing Sprite {0}", id);
-        m_spriteArray.erase(std::remove_if(m_spriteArray.begin(), m_spriteArray.end(),
-                                [&id](std::unique_ptr<Graphics::Sprite>& Sprite) {
-                                    return (Sprite->getId() == id);
-                                }),
-            m_spriteArray.end());
+        this->checkIds();
+        Graphics::Sprite* sprite = findById(m_spriteIds, id);
+        if (!sprite)
+            return;
+        m_spriteIds.erase(id);
+        m_spriteArray.erase(findByAddress(m_spriteArray, sprite));
+    }
+
+    const Graphics::SpriteBatch& Scene::getSpriteBatch() const
+    {
+        return m_spriteBatch;
+    }
+
+    std::size_t Scene::getDrawnSpriteAmount() const
+    {
+        return m_drawnSpriteAmount;
+    }
+
+    std::size_t Scene::getCulledSpriteAmount() const
+    {
+        return m_culledSpriteAmount;
     }
 
     void Scene::enableShowSceneNodes(bool showNodes)
@@ -754,13 +1207,9 @@ namespace obe::Scene
 
     Collision::PolygonalCollider& Scene::getCollider(const std::string& id)
     {
-        for (const auto& collider : m_colliderArray)
-        {
-            if (id == collider->getId())
-            {
-                return *collider;
-            }
-        }
+        this->checkIds();
+        if (Collision::PolygonalCollider* collider = findById(m_colliderIds, id))
+            return *collider;
         std::vector<std::string> collidersIds;
         collidersIds.reserve(m_colliderArray.size());
         for (const auto& collider : m_colliderArray)
@@ -772,24 +1221,55 @@ namespace obe::Scene
 
     bool Scene::doesColliderExists(const std::string& id)
     {
-        for (auto& collider : m_colliderArray)
-        {
-            if (collider->getId() == id)
-            {
-                return true;
-            }
-        }
-        return false;
+        this->checkIds();
+        return m_colliderIds.count(id);
     }
 
     void Scene::removeCollider(const std::string& id)
     {
-        m_colliderArray.erase(
-            std::remove_if(m_colliderArray.begin(), m_colliderArray.end(),
-                [&id](std::unique_ptr<Collision::PolygonalCollider>& collider) {
-                    return (collider->getId() == id);
-                }),
-            m_colliderArray.end());
+        this->checkIds();
+        Collision::PolygonalCollider* collider = findById(m_colliderIds, id);
+        if (!collider)
+            return;
+        m_colliderIds.erase(id);
+        m_colliderArray.erase(findByAddress(m_colliderArray, collider));
+    }
+
+    void Scene::checkIds()
+    {
+        // An element renamed through Identifiable::setId (from Lua for
+        // instance) is still indexed under its previous id
+        const std::size_t renameCount = Types::Identifiable::GetRenameCount();
+        if (renameCount == m_idsRenameCount)
+            return;
+        m_spriteIds.clear();
+        for (const auto& sprite : m_spriteArray)
+            m_spriteIds.emplace(sprite->getId(), sprite.get());
+        m_colliderIds.clear();
+        for (const auto& collider : m_colliderArray)
+            m_colliderIds.emplace(collider->getId(), collider.get());
+        m_gameObjectIds.clear();
+        for (const auto& gameObject : m_gameObjectArray)
+            m_gameObjectIds.emplace(gameObject->getId(), gameObject.get());
+        m_idsRenameCount = renameCount;
+    }
+
+    void Scene::setBroadPhase(Collision::BroadPhaseType type)
+    {
+        if (type == this->getBroadPhaseType())
+            return;
+        for (auto& collider : m_colliderArray)
+            collider->attachBroadPhase(nullptr);
+        m_broadPhase = Collision::makeBroadPhase(type);
+        for (auto& collider : m_colliderArray)
+            collider->attachBroadPhase(m_broadPhase.get());
+    }
+
+    Collision::BroadPhaseType Scene::getBroadPhaseType() const
+    {
+        if (m_broadPhase)
+            return m_broadPhase->getType();
+        return Collision::BroadPhaseType::None;
     }
 
     SceneNode& Scene::getSceneRootNode()
@@ -1,3 +1,4 @@
+#include <Config/CompiledFile.hpp>
 #include <Config/Templates/GameObject.hpp>
 #include <Scene/Scene.hpp>
 #include <Script/Exceptions.hpp>
@@ -10,8 +11,6 @@
 
 #include <utility>
 
-#include <vili/parser/parser.hpp>
-
 namespace obe::Script
 {
     sol::table GameObject::access() const
@@ -34,11 +33,8 @@ namespace obe::Script
     {
         if (allRequires[type].is_null())
         {
-            vili::node getGameObjectFile
-                = vili::parser::from_file(System::Path("Data/GameObjects/")
-                                              .add(type)
-                                              .add(type + ".obj.vili")
-                                              .find());
+            vili::node getGameObjectFile = Config::LoadFile(Config::FindFile(
+                System::Path("Data/GameObjects/").add(type).add(type + ".obj.vili")));
             if (!getGameObjectFile["Requires"].is_null())
             {
                 vili::node& requiresData = getGameObjectFile.at("Requires");
@@ -54,13 +50,11 @@ namespace obe::Script
     {
         if (allDefinitions[type].is_null())
         {
-            const std::string objectDefinitionPath = System::Path("Data/GameObjects/")
-                                                         .add(type)
-                                                         .add(type + ".obj.vili")
-                                                         .find();
+            const std::string objectDefinitionPath = Config::FindFile(
+                System::Path("Data/GameObjects/").add(type).add(type + ".obj.vili"));
             if (objectDefinitionPath.empty())
                 throw Exceptions::ObjectDefinitionNotFound(type, EXC_INFO);
-            vili::node getGameObjectFile = vili::parser::from_file(
+            vili::node getGameObjectFile = Config::LoadFile(
                 objectDefinitionPath, Config::Templates::getGameObjectTemplates());
             if (!getGameObjectFile[type].is_null())
             {
@@ -96,6 +90,10 @@ namespace obe::Script
         , m_lua(std::move(lua))
     {
         m_type = type;
+#if defined(OBE_ENABLE_PROFILER)
+        // One zone per type so spawning GameObjects does not register new zones
+        m_profilerZone = Debug::EngineProfiler.getZoneId("GameObject " + type);
+#endif
     }
 
     void GameObject::initialize()
@@ -220,7 +218,7 @@ namespace obe::Script
             m_sprite->setParentId(m_id);
             if (m_hasScriptEngine)
                 m_environment["Object"]["Sprite"] = m_sprite;
-            scene.reorganizeLayers();
+            scene.reorganizeChangedLayers();
         }
         if (!obj["Animator"].is_null())
         {
@@ -254,19 +252,12 @@ namespace obe::Script
 
     void GameObject::update()
     {
+        OBE_PROFILE_ZONE_ID(m_profilerZone);
         if (m_canUpdate)
         {
             if (m_active)
             {
-                if (m_animator)
-                {
-                    if (m_animator->getKey() != "")
-                        m_animator->update();
-                    if (m_sprite)
-                    {
-                        m_sprite->setTexture(m_animator->getTexture());
-                    }
-                }
+                this->updateNative();
             }
             else
             {
@@ -275,6 +266,24 @@ namespace obe::Script
         }
     }
 
+    void GameObject::updateNative()
+    {
+        if (m_animator)
+        {
+            if (m_animator->getKey() != "")
+                m_animator->update();
+            if (m_sprite)
+            {
+                m_sprite->setTexture(m_animator->getTexture());
+            }
+        }
+    }
+
+    bool GameObject::needsNativeUpdate() const
+    {
+        return m_canUpdate && m_active && !deletable && m_animator;
+    }
+
     std::string GameObject::getType() const
     {
         return m_type;
@@ -353,38 +362,21 @@ namespace obe::Script
         }
         else
         {
-            bool triggerNotFound = true;
-            for (auto& triggerPair : m_registeredTriggers)
-            {
-                if (triggerPair.first.lock()
-                    == m_triggers.getTrigger(trNsp, trGrp, trName).lock())
-                {
-                    triggerNotFound = false;
-                }
-            }
+            const Triggers::TriggerHandle handle
+                = m_triggers.getTriggerHandle(trNsp, trGrp, trName);
+            Triggers::Trigger& trigger = m_triggers.getTrigger(handle);
+            const bool triggerNotFound = std::none_of(m_registeredTriggers.begin(),
+                m_registeredTriggers.end(), [&trigger](const auto& triggerPair) {
+                    return triggerPair.first.lock().get() == &trigger;
+                });
+            const std::string callbackName = (callAlias.empty())
+                ? trNsp + "." + trGrp + "." + trName
+                : callAlias;
             if (triggerNotFound)
-            {
-                const std::string callbackName = (callAlias.empty())
-                    ? trNsp + "." + trGrp + "." + trName
-                    : callAlias;
-                this->registerTrigger(
-                    m_triggers.getTrigger(trNsp, trGrp, trName), callbackName);
-                m_triggers.getTrigger(trNsp, trGrp, trName)
-                    .lock()
-                    ->registerEnvironment(m_id, m_environment, callbackName, &m_active);
-            }
+                this->registerTrigger(trigger.weak_from_this(), callbackName);
             else
-            {
-                const std::string callbackName = (callAlias.empty())
-                    ? trNsp + "." + trGrp + "." + trName
-                    : callAlias;
-                m_triggers.getTrigger(trNsp, trGrp, trName)
-                    .lock()
-                    ->unregisterEnvironment(m_environment);
-                m_triggers.getTrigger(trNsp, trGrp, trName)
-                    .lock()
-                    ->registerEnvironment(m_id, m_environment, callbackName, &m_active);
-            }
+                trigger.unregisterEnvironment(m_environment);
+            trigger.registerEnvironment(m_id, m_environment, callbackName, &m_active);
         }
     }
 
@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
+#include <Script/Exceptions.hpp>
+#include <Script/GarbageCollector.hpp>
+
+namespace obe::Script
+{
+    namespace
+    {
+        double getNumber(const vili::node& node)
+        {
+            if (node.is_integer())
+                return static_cast<double>(node.as<vili::integer>());
+            return node.as<vili::number>();
+        }
+    }
+
+    GarbageCollectorMode stringToGarbageCollectorMode(const std::string& mode)
+    {
+        if (mode == "Full")
+            return GarbageCollectorMode::Full;
+        if (mode == "Incremental")
+            return GarbageCollectorMode::Incremental;
+        if (mode == "Generational")
+            return GarbageCollectorMode::Generational;
+        throw Exceptions::UnknownGarbageCollectorMode(mode, EXC_INFO);
+    }
+
+    GarbageCollector::GarbageCollector(sol::state_view lua)
+        : m_lua(lua.lua_state())
+    {
+        m_memoryAfterCycle = this->getMemoryUsage();
+        this->applyMode();
+    }
+
+    GarbageCollector::~GarbageCollector()
+    {
+        lua_gc(m_lua, LUA_GCRESTART);
+    }
+
+    void GarbageCollector::applyMode()
+    {
+        // 0 keeps the current parameters of the collector, the step size is
+        // given to Lua as a power of 2 of bytes
+        const int stepSizeLog2
+            = static_cast<int>(std::ceil(std::log2(m_stepSize * 1024.0)));
+        if (m_mode == GarbageCollectorMode::Generational)
+            lua_gc(m_lua, LUA_GCGEN, 0, 0);
+        else
+            lua_gc(m_lua, LUA_GCINC, 0, 0, stepSizeLog2);
+        // Incremental cycles are only driven by the GarbageCollector, otherwise
+        // Lua keeps restarting cycles interleaved with every allocation
+        if (m_mode == GarbageCollectorMode::Incremental)
+            lua_gc(m_lua, LUA_GCSTOP);
+        else
+            lua_gc(m_lua, LUA_GCRESTART);
+        m_cycleRunning = false;
+    }
+
+    void GarbageCollector::step(Time::TimeUnit budget)
+    {
+        OBE_PROFILE_ZONE("GarbageCollector::step");
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+        const std::size_t memoryBefore = this->getMemoryUsage();
+        const double growth = static_cast<double>(memoryBefore)
+            / static_cast<double>(std::max<std::size_t>(m_memoryAfterCycle, 1));
+        if (!m_cycleRunning)
+            m_cycleRunning = growth >= m_pause;
+        // When the garbage grows faster than the budget allows to collect it,
+        // the cycle is finished whatever it costs
+        const bool overBudget = growth >= m_pause * 2;
+        const std::chrono::duration<double> maxDuration(budget);
+        while (m_cycleRunning)
+        {
+            // A basic step (0) does a fixed amount of work without adding to the
+            // collector debt, a generational step is a whole young collection
+            if (lua_gc(m_lua, LUA_GCSTEP, 0)
+                || m_mode == GarbageCollectorMode::Generational)
+            {
+                m_cycleRunning = false;
+                m_memoryAfterCycle = this->getMemoryUsage();
+            }
+            if (!overBudget && Clock::now() - start >= maxDuration)
+                break;
+        }
+        const std::size_t memoryAfter = this->getMemoryUsage();
+        m_lastCollectedBytes
+            = (memoryBefore > memoryAfter) ? memoryBefore - memoryAfter : 0;
+        m_lastPause = std::chrono::duration<double>(Clock::now() - start).count();
+        OBE_PROFILE_COUNTER("Lua memory (KB)", memoryAfter / 1024.0);
+        OBE_PROFILE_COUNTER("Lua collected (KB)", m_lastCollectedBytes / 1024.0);
+    }
+
+    void GarbageCollector::configure(const vili::node& config)
+    {
+        if (config.contains("mode"))
+            this->setMode(stringToGarbageCollectorMode(config.at("mode")));
+        if (config.contains("frameBudget"))
+            m_frameBudget = getNumber(config.at("frameBudget")) * Time::milliseconds;
+        if (config.contains("idleBudget"))
+            m_idleBudget = getNumber(config.at("idleBudget")) * Time::milliseconds;
+        if (config.contains("stepSize"))
+            this->setStepSize(config.at("stepSize").as<vili::integer>());
+        if (config.contains("pause"))
+            this->setPause(getNumber(config.at("pause")));
+        Debug::Log->info("<GarbageCollector> Frame budget {}ms, idle budget {}ms, step "
+                         "size {}KB, pause {}",
+            m_frameBudget / Time::milliseconds, m_idleBudget / Time::milliseconds,
+            m_stepSize, m_pause);
+    }
+
+    void GarbageCollector::update()
+    {
+        if (m_mode == GarbageCollectorMode::Full)
+            this->collect();
+        else
+            this->step(m_frameBudget);
+    }
+
+    void GarbageCollector::idle(Time::TimeUnit available)
+    {
+        if (m_mode != GarbageCollectorMode::Full)
+            this->step(std::min(available, m_idleBudget));
+    }
+
+    void GarbageCollector::collect()
+    {
+        OBE_PROFILE_ZONE("GarbageCollector::collect");
+        const auto start = std::chrono::steady_clock::now();
+        const std::size_t memoryBefore = this->getMemoryUsage();
+        lua_gc(m_lua, LUA_GCCOLLECT);
+        m_cycleRunning = false;
+        m_memoryAfterCycle = this->getMemoryUsage();
+        m_lastCollectedBytes
+            = (memoryBefore > m_memoryAfterCycle) ? memoryBefore - m_memoryAfterCycle : 0;
+        m_lastPause = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start)
+                          .count();
+        OBE_PROFILE_COUNTER("Lua memory (KB)", m_memoryAfterCycle / 1024.0);
+        OBE_PROFILE_COUNTER("Lua collected (KB)", m_lastCollectedBytes / 1024.0);
+    }
+
+    void GarbageCollector::setMode(GarbageCollectorMode mode)
+    {
+        m_mode = mode;
+        this->applyMode();
+    }
+
+    GarbageCollectorMode GarbageCollector::getMode() const
+    {
+        return m_mode;
+    }
+
+    void GarbageCollector::setFrameBudget(Time::TimeUnit budget)
+    {
+        m_frameBudget = budget;
+    }
+
+    Time::TimeUnit GarbageCollector::getFrameBudget() const
+    {
+        return m_frameBudget;
+    }
+
+    void GarbageCollector::setIdleBudget(Time::TimeUnit budget)
+    {
+        m_idleBudget = budget;
+    }
+
+    Time::TimeUnit GarbageCollector::getIdleBudget() const
+    {
+        return m_idleBudget;
+    }
+
+    void GarbageCollector::setStepSize(int kilobytes)
+    {
+        m_stepSize = std::max(kilobytes, 1);
+        this->applyMode();
+    }
+
+    int GarbageCollector::getStepSize() const
+    {
+        return m_stepSize;
+    }
+
+    void GarbageCollector::setPause(double pause)
+    {
+        m_pause = std::max(pause, 1.0);
+    }
+
+    double GarbageCollector::getPause() const
+    {
+        return m_pause;
+    }
+
+    std::size_t GarbageCollector::getMemoryUsage() const
+    {
+        return static_cast<std::size_t>(lua_gc(m_lua, LUA_GCCOUNT)) * 1024
+            + static_cast<std::size_t>(lua_gc(m_lua, LUA_GCCOUNTB));
+    }
+
+    std::size_t GarbageCollector::getLastCollectedBytes() const
+    {
+        return m_lastCollectedBytes;
+    }
+
+    Time::TimeUnit GarbageCollector::getLastPause() const
+    {
+        return m_lastPause;
+    }
+} // namespace obe::Script
@@ -0,0 +1,120 @@
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <System/Exceptions.hpp>
+#include <System/MappedFile.hpp>
+
+namespace obe::System
+{
+#ifdef _WIN32
+    MappedFile::MappedFile(const std::string& path)
+        : m_path(path)
+    {
+        m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+        {
+            m_file = nullptr;
+            throw Exceptions::FileMappingFailed(path, "can not open file", EXC_INFO);
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(m_file, &size))
+        {
+            this->close();
+            throw Exceptions::FileMappingFailed(path, "can not get file size", EXC_INFO);
+        }
+        m_size = static_cast<std::size_t>(size.QuadPart);
+        // Empty files can not be mapped
+        if (m_size == 0)
+            return;
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mapping)
+            m_data = static_cast<const char*>(
+                MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!m_data)
+        {
+            this->close();
+            throw Exceptions::FileMappingFailed(path, "can not map file", EXC_INFO);
+        }
+    }
+
+    void MappedFile::close()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping)
+            CloseHandle(m_mapping);
+        if (m_file)
+            CloseHandle(m_file);
+        m_data = nullptr;
+        m_mapping = nullptr;
+        m_file = nullptr;
+    }
+#else
+    MappedFile::MappedFile(const std::string& path)
+        : m_path(path)
+    {
+        const int file = open(path.c_str(), O_RDONLY);
+        if (file == -1)
+            throw Exceptions::FileMappingFailed(path, std::strerror(errno), EXC_INFO);
+        struct stat status;
+        if (fstat(file, &status) == -1)
+        {
+            const int error = errno;
+            ::close(file);
+            throw Exceptions::FileMappingFailed(path, std::strerror(error), EXC_INFO);
+        }
+        m_size = static_cast<std::size_t>(status.st_size);
+        // Empty files can not be mapped
+        if (m_size == 0)
+        {
+            ::close(file);
+            return;
+        }
+        // The mapping stays valid once the file is closed
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+        const int error = errno;
+        ::close(file);
+        if (data == MAP_FAILED)
+            throw Exceptions::FileMappingFailed(path, std::strerror(error), EXC_INFO);
+        m_data = static_cast<const char*>(data);
+    }
+
+    void MappedFile::close()
+    {
+        if (m_data)
+            munmap(const_cast<char*>(m_data), m_size);
+        m_data = nullptr;
+    }
+#endif
+
+    MappedFile::~MappedFile()
+    {
+        this->close();
+    }
+
+    const std::string& MappedFile::getPath() const
+    {
+        return m_path;
+    }
+
+    const char* MappedFile::getData() const
+    {
+        return m_data;
+    }
+
+    std::size_t MappedFile::getSize() const
+    {
+        return m_size;
+    }
+} // namespace obe::System
@@ -10,6 +10,7 @@ namespace obe::System
     {
         m_hasOnInitFn = false;
         m_hasOnLoadBindingsFn = false;
+        m_hasOnLoadJobsFn = false;
         m_hasOnUpdateFn = false;
         m_hasOnRenderFn = false;
         m_hasOnExitFn = false;
@@ -50,6 +51,18 @@ namespace obe::System
         {
         }
         try
+        {
+            m_onLoadJobsFn
+                = getPluginFunction<void(Jobs::ThreadPool&)>(m_dl, "OnLoadJobs");
+            m_onLoadJobsFn->init();
+            m_hasOnLoadJobsFn = true;
+            Debug::Log->debug(
+                "<System:Plugins> : (Plugin '{}') > Found function OnLoadJobs", id);
+        }
+        catch (const dynamicLinker::dynamicLinkerException& e)
+        {
+        }
+        try
         {
             m_onUpdateFn = getPluginFunction<void(double)>(m_dl, "OnUpdate");
             m_onUpdateFn->init();
@@ -91,6 +104,11 @@ namespace obe::System
         m_onLoadBindingsFn->operator()(lua);
     }
 
+    void Plugin::onLoadJobs(Jobs::ThreadPool& pool) const
+    {
+        m_onLoadJobsFn->operator()(pool);
+    }
+
     void Plugin::onUpdate(double dt) const
     {
         m_onUpdateFn->operator()(dt);
@@ -116,6 +134,11 @@ namespace obe::System
         return m_hasOnLoadBindingsFn;
     }
 
+    bool Plugin::hasOnLoadJobs() const
+    {
+        return m_hasOnLoadJobsFn;
+    }
+
     bool Plugin::hasOnUpdate() const
     {
         return m_hasOnUpdateFn;
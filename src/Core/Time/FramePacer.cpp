@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include <Time/FramePacer.hpp>
+
+namespace obe::Time
+{
+    namespace
+    {
+        void sleepFor(TimeUnit duration)
+        {
+            if (duration > 0)
+                std::this_thread::sleep_for(std::chrono::duration<TimeUnit>(duration));
+            else
+                std::this_thread::yield();
+        }
+
+        TimeUnit getPercentile(const std::vector<TimeUnit>& sorted, double percentile)
+        {
+            const auto rank = static_cast<std::size_t>(
+                std::ceil(percentile * static_cast<double>(sorted.size())));
+            return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+        }
+    }
+
+    FramePacer::FramePacer(std::size_t sampleCapacity)
+        : FramePacer(precise, sleepFor, sampleCapacity)
+    {
+    }
+
+    FramePacer::FramePacer(
+        ClockFunction clock, SleepFunction sleep, std::size_t sampleCapacity)
+        : m_clock(std::move(clock))
+        , m_sleep(std::move(sleep))
+        , m_sampleCapacity(std::max<std::size_t>(sampleCapacity, 1))
+    {
+        m_frameTimes.reserve(m_sampleCapacity);
+        m_latenesses.reserve(m_sampleCapacity);
+    }
+
+    void FramePacer::record(TimeUnit frameTime, TimeUnit lateness)
+    {
+        if (m_frameTimes.size() < m_sampleCapacity)
+        {
+            m_frameTimes.push_back(frameTime);
+            m_latenesses.push_back(lateness);
+        }
+        else
+        {
+            m_frameTimes[m_nextSample] = frameTime;
+            m_latenesses[m_nextSample] = lateness;
+        }
+        m_nextSample = (m_nextSample + 1) % m_sampleCapacity;
+    }
+
+    void FramePacer::setInterval(TimeUnit interval)
+    {
+        m_interval = std::max(interval, 0.0);
+    }
+
+    TimeUnit FramePacer::getInterval() const
+    {
+        return m_interval;
+    }
+
+    void FramePacer::setSpinThreshold(TimeUnit threshold)
+    {
+        m_spinThreshold = std::max(threshold, 0.0);
+    }
+
+    TimeUnit FramePacer::getSpinThreshold() const
+    {
+        return m_spinThreshold;
+    }
+
+    TimeUnit FramePacer::waitForNextFrame(const std::function<void(TimeUnit)>& idleTask)
+    {
+        const TimeUnit deadline = m_nextDeadline;
+        if (m_interval > 0)
+        {
+            // Sleeping is not precise enough to reach the deadline, the end
+            // of the wait is spent spinning
+            const TimeUnit sleepUntil = deadline - m_spinThreshold;
+            if (idleTask && sleepUntil > m_clock())
+                idleTask(sleepUntil - m_clock());
+            if (const TimeUnit sleepTime = sleepUntil - m_clock(); sleepTime > 0)
+                m_sleep(sleepTime);
+            while (m_clock() < deadline)
+                m_sleep(0);
+        }
+        const TimeUnit frameStart = m_clock();
+        if (m_lastFrameStart >= 0)
+        {
+            this->record(frameStart - m_lastFrameStart,
+                (m_interval > 0) ? std::max(frameStart - deadline, 0.0) : 0);
+        }
+        m_lastFrameStart = frameStart;
+        m_nextDeadline = deadline + m_interval;
+        if (m_nextDeadline <= frameStart)
+            m_nextDeadline = frameStart + m_interval;
+        return frameStart;
+    }
+
+    TimeUnit FramePacer::getNextDeadline() const
+    {
+        return m_nextDeadline;
+    }
+
+    FrameStatistics FramePacer::getStatistics() const
+    {
+        FrameStatistics statistics;
+        statistics.frames = m_frameTimes.size();
+        if (m_frameTimes.empty())
+            return statistics;
+        const auto frames = static_cast<double>(statistics.frames);
+        for (std::size_t i = 0; i < m_frameTimes.size(); i++)
+        {
+            statistics.mean += m_frameTimes[i];
+            statistics.lateness += m_latenesses[i];
+        }
+        statistics.mean /= frames;
+        statistics.lateness /= frames;
+        TimeUnit variance = 0;
+        for (const TimeUnit frameTime : m_frameTimes)
+            variance += (frameTime - statistics.mean) * (frameTime - statistics.mean);
+        statistics.jitter = std::sqrt(variance / frames);
+
+        std::vector<TimeUnit> sorted = m_frameTimes;
+        std::sort(sorted.begin(), sorted.end());
+        statistics.p95 = getPercentile(sorted, 0.95);
+        statistics.p99 = getPercentile(sorted, 0.99);
+        return statistics;
+    }
+
+    void FramePacer::reset()
+    {
+        m_frameTimes.clear();
+        m_latenesses.clear();
+        m_nextSample = 0;
+        m_lastFrameStart = -1;
+    }
+} // namespace obe::Time
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <fmt/format.h>
+
 #include <System/Window.hpp>
 #include <Time/FramerateCounter.hpp>
 
@@ -5,25 +7,35 @@ namespace obe::Time
 {
     void FramerateCounter::tick()
     {
-        if (epoch() - m_lastTick <= 1000)
+        if (now() - m_lastTick <= 1)
             m_framerateBuffer++;
     }
 
     void FramerateCounter::uTick()
     {
-        if (epoch() - m_lastTick <= 1000)
+        if (now() - m_lastTick <= 1)
             m_updatesBuffer++;
         else
         {
             m_updatesCounter = m_updatesBuffer;
             m_updatesBuffer = 0;
-            m_lastTick = epoch();
+            m_lastTick = now();
             m_canUpdateFPS = true;
             m_framerateCounter = m_framerateBuffer;
             m_framerateBuffer = 0;
         }
     }
 
+    void FramerateCounter::setFrameStatistics(const FrameStatistics& statistics)
+    {
+        m_statistics = statistics;
+    }
+
+    FrameStatistics FramerateCounter::getFrameStatistics() const
+    {
+        return m_statistics;
+    }
+
     void FramerateCounter::loadFont(Graphics::Font& font)
     {
         m_text.setFont(font);
@@ -36,8 +48,12 @@ namespace obe::Time
         if (m_canUpdateFPS)
         {
             m_canUpdateFPS = false;
-            m_text.setString(std::to_string(m_framerateCounter) + " FPS / "
-                + std::to_string(m_updatesCounter) + " UPS");
+            m_text.setString(fmt::format(
+                "{} FPS / {} UPS\nmean {:.2f}ms / p95 {:.2f}ms / p99 {:.2f}ms / "
+                "jitter {:.2f}ms",
+                m_framerateCounter, m_updatesCounter,
+                m_statistics.mean / milliseconds, m_statistics.p95 / milliseconds,
+                m_statistics.p99 / milliseconds, m_statistics.jitter / milliseconds));
         }
         // System::MainWindow.draw(m_text);
     }
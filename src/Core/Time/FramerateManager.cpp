@@ -1,19 +1,22 @@
+#include <algorithm>
 #include <cmath>
 
 #include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
 #include <System/Window.hpp>
 #include <Time/FramerateManager.hpp>
-#include <thread>
 
 namespace obe::Time
 {
     FramerateManager::FramerateManager(System::Window& window)
         : m_window(window)
     {
-        m_frameLimiterClock = epoch();
-        m_currentFrame = 0;
-        m_frameProgression = 0;
-        m_needToRender = false;
+        m_lastFrameTime = now();
+    }
+
+    void FramerateManager::applyPacing()
+    {
+        m_pacer.setInterval(m_limitFramerate ? m_reqFramerateInterval : 0);
     }
 
     void FramerateManager::configure(vili::node& config)
@@ -31,39 +34,59 @@ namespace obe::Time
         {
             m_syncUpdateRender = config["syncUpdateToRender"];
         }
+        if (!config["fixedTimestep"].is_null())
+        {
+            m_fixedTimestep = config["fixedTimestep"];
+        }
+        if (!config["tickRate"].is_null())
+        {
+            this->setTickRate(
+                static_cast<unsigned int>(config["tickRate"].as<vili::integer>()));
+        }
+        if (!config["maxCatchUpSteps"].is_null())
+        {
+            this->setMaxCatchUpSteps(
+                static_cast<unsigned int>(config["maxCatchUpSteps"].as<vili::integer>()));
+        }
         m_reqFramerateInterval = 1.0 / static_cast<double>(m_framerateTarget);
+        this->applyPacing();
         Debug::Log->info("Framerate parameters : {} FPS {}, V-sync {}, Update Lock {}",
             m_framerateTarget, (m_limitFramerate) ? "capped" : "uncapped",
             (m_vsyncEnabled) ? "enabled" : "disabled",
             (m_syncUpdateRender) ? "enabled" : "disabled");
+        if (m_fixedTimestep)
+        {
+            Debug::Log->info("Fixed timestep : {} steps per second, {} steps per frame "
+                             "at most",
+                m_tickRate, m_maxCatchUpSteps);
+        }
 
         m_window.setVerticalSyncEnabled(m_vsyncEnabled);
     }
 
     void FramerateManager::update()
     {
-        const sf::Time timeBuffer = m_deltaClock.restart();
-        m_deltaTime = static_cast<double>(timeBuffer.asMicroseconds()) * microseconds;
-        if (m_limitFramerate)
         {
-            if (epoch() - m_frameLimiterClock > 1)
-            {
-                m_frameLimiterClock = epoch();
-                m_currentFrame = 0;
-            }
-            m_frameProgression
-                = round((epoch() - m_frameLimiterClock) / (m_reqFramerateInterval));
-            m_needToRender = false;
-            if (m_frameProgression > m_currentFrame)
-            {
-                m_currentFrame = m_frameProgression;
-                m_needToRender = true;
-            }
-            else
-            {
-                std::this_thread::sleep_for(
-                    std::chrono::duration<double>(m_reqFramerateInterval));
-            }
+            OBE_PROFILE_ZONE("FramerateManager::wait");
+            m_pacer.waitForNextFrame(m_idleTask);
+        }
+        const TimeUnit frameTime = advanceFrame();
+        m_deltaTime = frameTime - m_lastFrameTime;
+        m_lastFrameTime = frameTime;
+        if (m_fixedTimestep)
+        {
+            const TimeUnit step = 1.0 / static_cast<double>(m_tickRate);
+            m_accumulator += m_deltaTime * m_speedCoefficient;
+            const auto dueSteps = static_cast<unsigned int>(m_accumulator / step);
+            m_steps = std::min(dueSteps, m_maxCatchUpSteps);
+            m_accumulator -= m_steps * step;
+            // Time that can not be caught up is dropped, keeping the phase
+            if (dueSteps > m_steps)
+                m_accumulator = std::fmod(m_accumulator, step);
+        }
+        else
+        {
+            m_steps = 1;
         }
     }
 
@@ -74,6 +97,8 @@ namespace obe::Time
 
     double FramerateManager::getGameSpeed() const
     {
+        if (m_fixedTimestep)
+            return 1.0 / static_cast<double>(m_tickRate);
         return m_deltaTime * m_speedCoefficient;
     }
 
@@ -97,6 +122,33 @@ namespace obe::Time
         return m_vsyncEnabled;
     }
 
+    bool FramerateManager::isFixedTimestep() const
+    {
+        return m_fixedTimestep;
+    }
+
+    unsigned int FramerateManager::getTickRate() const
+    {
+        return m_tickRate;
+    }
+
+    unsigned int FramerateManager::getMaxCatchUpSteps() const
+    {
+        return m_maxCatchUpSteps;
+    }
+
+    unsigned int FramerateManager::getSteps() const
+    {
+        return m_steps;
+    }
+
+    double FramerateManager::getInterpolation() const
+    {
+        if (!m_fixedTimestep)
+            return 1.0;
+        return m_accumulator * static_cast<double>(m_tickRate);
+    }
+
     void FramerateManager::setSpeedCoefficient(const double speed)
     {
         m_speedCoefficient = speed;
@@ -105,11 +157,14 @@ namespace obe::Time
     void FramerateManager::limitFramerate(const bool state)
     {
         m_limitFramerate = state;
+        this->applyPacing();
     }
 
     void FramerateManager::setFramerateTarget(const unsigned int limit)
     {
-        m_framerateTarget = limit;
+        m_framerateTarget = std::max(limit, 1u);
+        m_reqFramerateInterval = 1.0 / static_cast<double>(m_framerateTarget);
+        this->applyPacing();
     }
 
     void FramerateManager::setVSyncEnabled(const bool vsync)
@@ -118,8 +173,40 @@ namespace obe::Time
         m_window.setVerticalSyncEnabled(vsync);
     }
 
+    void FramerateManager::setFixedTimestep(bool fixedTimestep)
+    {
+        m_fixedTimestep = fixedTimestep;
+        m_accumulator = 0;
+    }
+
+    void FramerateManager::setTickRate(unsigned int tickRate)
+    {
+        m_tickRate = std::max(tickRate, 1u);
+    }
+
+    void FramerateManager::setMaxCatchUpSteps(unsigned int maxCatchUpSteps)
+    {
+        m_maxCatchUpSteps = std::max(maxCatchUpSteps, 1u);
+    }
+
+    void FramerateManager::setIdleTask(std::function<void(TimeUnit)> task)
+    {
+        m_idleTask = std::move(task);
+    }
+
     bool FramerateManager::doRender() const
     {
-        return (!m_limitFramerate || m_needToRender);
+        // Frames are paced before they start, every frame is rendered
+        return true;
+    }
+
+    FrameStatistics FramerateManager::getFrameStatistics() const
+    {
+        return m_pacer.getStatistics();
+    }
+
+    FramePacer& FramerateManager::getFramePacer()
+    {
+        return m_pacer;
     }
 } // namespace obe::Time
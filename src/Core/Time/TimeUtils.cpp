@@ -1,9 +1,22 @@
+#include <atomic>
 #include <chrono>
 
 #include <Time/TimeUtils.hpp>
 
 namespace obe::Time
 {
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+        const Clock::time_point ClockOrigin = Clock::now();
+        // Frame time is read from any thread but only stamped by the main one
+        std::atomic<TimeUnit> FrameTime { 0 };
+        // Added to the real time so that the clock does not jump when leaving
+        // the fixed step mode
+        TimeUnit ClockOffset = 0;
+        TimeUnit FixedStep = 0;
+    }
+
     TimeUnit epoch()
     {
         return double(std::chrono::duration_cast<std::chrono::microseconds>(
@@ -11,4 +24,34 @@ namespace obe::Time
                           .count())
             * microseconds;
     }
+
+    TimeUnit now()
+    {
+        return FrameTime.load(std::memory_order_relaxed);
+    }
+
+    TimeUnit precise()
+    {
+        return std::chrono::duration<TimeUnit>(Clock::now() - ClockOrigin).count();
+    }
+
+    TimeUnit advanceFrame()
+    {
+        const TimeUnit frameTime = (FixedStep > 0) ? now() + FixedStep
+                                                   : precise() + ClockOffset;
+        FrameTime.store(frameTime, std::memory_order_relaxed);
+        return frameTime;
+    }
+
+    void setFixedStep(TimeUnit step)
+    {
+        if (FixedStep > 0 && step <= 0)
+            ClockOffset = now() - precise();
+        FixedStep = (step > 0) ? step : 0;
+    }
+
+    TimeUnit getFixedStep()
+    {
+        return FixedStep;
+    }
 } // namespace obe::Time
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include <Time/TimerWheel.hpp>
+
+namespace obe::Time
+{
+    TimerWheel::TimerWheel(Tick start)
+        : m_currentTick(start)
+    {
+        m_heads.fill(None);
+        m_tails.fill(None);
+    }
+
+    std::size_t TimerWheel::getBucket(Tick deadline) const
+    {
+        const Tick delta = (deadline > m_currentTick) ? deadline - m_currentTick : 0;
+        for (unsigned int level = 0; level < Levels; level++)
+        {
+            const unsigned int shift = SlotBits * level;
+            if (delta < (SlotsPerLevel << shift))
+                return level * SlotsPerLevel + ((deadline >> shift) & SlotMask);
+        }
+        return OverflowBucket;
+    }
+
+    void TimerWheel::link(TimerId id, std::size_t bucket)
+    {
+        Timer& timer = m_timers[id];
+        timer.bucket = static_cast<std::uint32_t>(bucket);
+        timer.previous = m_tails[bucket];
+        timer.next = None;
+        if (m_tails[bucket] != None)
+            m_timers[m_tails[bucket]].next = id;
+        else
+            m_heads[bucket] = id;
+        m_tails[bucket] = id;
+    }
+
+    void TimerWheel::unlink(TimerId id)
+    {
+        Timer& timer = m_timers[id];
+        if (timer.previous != None)
+            m_timers[timer.previous].next = timer.next;
+        else
+            m_heads[timer.bucket] = timer.next;
+        if (timer.next != None)
+            m_timers[timer.next].previous = timer.previous;
+        else
+            m_tails[timer.bucket] = timer.previous;
+        timer.bucket = None;
+    }
+
+    void TimerWheel::cascade(std::size_t bucket)
+    {
+        TimerId id = m_heads[bucket];
+        m_heads[bucket] = None;
+        m_tails[bucket] = None;
+        while (id != None)
+        {
+            const TimerId next = m_timers[id].next;
+            this->link(id, this->getBucket(m_timers[id].deadline));
+            id = next;
+        }
+    }
+
+    void TimerWheel::insert(TimerId id, Tick deadline)
+    {
+        if (id >= m_timers.size())
+            m_timers.resize(id + 1);
+        if (m_timers[id].bucket != None)
+            this->unlink(id);
+        else
+            m_size++;
+        m_timers[id].deadline = deadline;
+        this->link(
+            id, (deadline <= m_currentTick) ? ExpiredBucket : this->getBucket(deadline));
+    }
+
+    void TimerWheel::remove(TimerId id)
+    {
+        if (!this->contains(id))
+            return;
+        this->unlink(id);
+        m_size--;
+    }
+
+    bool TimerWheel::contains(TimerId id) const
+    {
+        return id < m_timers.size() && m_timers[id].bucket != None;
+    }
+
+    void TimerWheel::advance(Tick tick, std::vector<TimerId>& due)
+    {
+        const auto fire = [this, &due](std::size_t bucket) {
+            for (TimerId id = m_heads[bucket]; id != None; id = m_timers[id].next)
+            {
+                m_timers[id].bucket = None;
+                due.push_back(id);
+                m_size--;
+            }
+            m_heads[bucket] = None;
+            m_tails[bucket] = None;
+        };
+        fire(ExpiredBucket);
+        while (m_currentTick < tick)
+        {
+            if (m_size == 0)
+            {
+                m_currentTick = tick;
+                break;
+            }
+            m_currentTick++;
+            // The slots of a level are brought down to the lower levels each
+            // time the lower levels wrap, starting from the highest level
+            unsigned int wrapped = 0;
+            while (wrapped < Levels - 1
+                && (m_currentTick & ((SlotsPerLevel << (SlotBits * wrapped)) - 1)) == 0)
+            {
+                wrapped++;
+            }
+            if (wrapped == Levels - 1
+                && (m_currentTick & ((SlotsPerLevel << (SlotBits * wrapped)) - 1)) == 0)
+            {
+                this->cascade(OverflowBucket);
+            }
+            for (unsigned int level = wrapped; level > 0; level--)
+            {
+                const Tick slot = (m_currentTick >> (SlotBits * level)) & SlotMask;
+                this->cascade(level * SlotsPerLevel + slot);
+            }
+            fire(m_currentTick & SlotMask);
+        }
+    }
+
+    TimerWheel::Tick TimerWheel::getCurrentTick() const
+    {
+        return m_currentTick;
+    }
+
+    std::size_t TimerWheel::size() const
+    {
+        return m_size;
+    }
+
+    void TimerWheel::clear()
+    {
+        m_timers.clear();
+        m_heads.fill(None);
+        m_tails.fill(None);
+        m_size = 0;
+    }
+} // namespace obe::Time
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cmath>
+
 #include <Debug/Logger.hpp>
 #include <Transform/Exceptions.hpp>
 #include <Transform/Polygon.hpp>
@@ -16,8 +19,7 @@ namespace obe::Transform
         Polygon& parent, std::size_t index, const Transform::UnitVector& position)
         : PolygonPoint(parent, index)
     {
-        this->x = position.x;
-        this->y = position.y;
+        UnitVector::set(position.x, position.y);
     }
 
     void PolygonPoint::remove() const
@@ -31,6 +33,7 @@ namespace obe::Transform
         m_parent.m_points.erase(m_parent.m_points.begin() + index);
         for (point_index_t i = index; i < m_parent.m_points.size(); i++)
             m_parent.m_points[i]->rw_index = i;
+        m_parent.invalidatePoints();
     }
 
     double PolygonPoint::distance(const Transform::UnitVector& position) const
@@ -62,6 +65,19 @@ namespace obe::Transform
     void PolygonPoint::move(const Transform::UnitVector& position)
     {
         this->add(position);
+        m_parent.invalidatePoints();
+    }
+
+    void PolygonPoint::set(const Transform::UnitVector& position)
+    {
+        UnitVector::set(position);
+        m_parent.invalidatePoints();
+    }
+
+    void PolygonPoint::set(double x, double y)
+    {
+        UnitVector::set(x, y);
+        m_parent.invalidatePoints();
     }
 
     PolygonSegment::PolygonSegment(const PolygonPoint& first, const PolygonPoint& second)
@@ -86,6 +102,79 @@ namespace obe::Transform
     {
     }
 
+    void Polygon::onPointsChanged()
+    {
+    }
+
+    void Polygon::invalidatePoints()
+    {
+        m_verticesDirty = true;
+        this->onPointsChanged();
+    }
+
+    const PolygonVertices& Polygon::getVertices() const
+    {
+        const double scaleX = UnitVector::Screen.w / UnitVector::View.w;
+        const double scaleY = UnitVector::Screen.h / UnitVector::View.h;
+        if (!m_verticesDirty && scaleX == m_verticesScaleX && scaleY == m_verticesScaleY)
+            return m_vertices;
+
+        const std::size_t pointsAmount = m_points.size();
+        m_vertices.x.resize(pointsAmount);
+        m_vertices.y.resize(pointsAmount);
+        for (std::size_t i = 0; i < pointsAmount; i++)
+        {
+            m_vertices.x[i] = m_points[i]->x * scaleX;
+            m_vertices.y[i] = m_points[i]->y * scaleY;
+        }
+
+        m_vertices.minX = m_vertices.maxX = m_vertices.centroidX = 0;
+        m_vertices.minY = m_vertices.maxY = m_vertices.centroidY = 0;
+        if (pointsAmount > 0)
+        {
+            const auto [minX, maxX]
+                = std::minmax_element(m_vertices.x.begin(), m_vertices.x.end());
+            const auto [minY, maxY]
+                = std::minmax_element(m_vertices.y.begin(), m_vertices.y.end());
+            m_vertices.minX = *minX;
+            m_vertices.maxX = *maxX;
+            m_vertices.minY = *minY;
+            m_vertices.maxY = *maxY;
+
+            double signedArea = 0.0;
+            double centroidX = 0.0;
+            double centroidY = 0.0;
+            for (std::size_t i = 0, j = pointsAmount - 1; i < pointsAmount; j = i++)
+            {
+                const double a = m_vertices.x[j] * m_vertices.y[i]
+                    - m_vertices.x[i] * m_vertices.y[j];
+                signedArea += a;
+                centroidX += (m_vertices.x[j] + m_vertices.x[i]) * a;
+                centroidY += (m_vertices.y[j] + m_vertices.y[i]) * a;
+            }
+            if (signedArea != 0)
+            {
+                m_vertices.centroidX = centroidX / (3.0 * signedArea);
+                m_vertices.centroidY = centroidY / (3.0 * signedArea);
+            }
+            else
+            {
+                // Flat polygons have no area, use the average of the points instead
+                for (std::size_t i = 0; i < pointsAmount; i++)
+                {
+                    m_vertices.centroidX += m_vertices.x[i] / pointsAmount;
+                    m_vertices.centroidY += m_vertices.y[i] / pointsAmount;
+                }
+            }
+        }
+
+        m_vertices.revision++;
+        m_verticesDirty = false;
+        m_verticesScaleX = scaleX;
+        m_verticesScaleY = scaleY;
+        return m_vertices;
+    }
+
     std::size_t Polygon::getPointsAmount() const
     {
         return m_points.size();
@@ -104,6 +193,7 @@ namespace obe::Transform
             for (point_index_t i = pointIndex; i < m_points.size(); i++)
                 m_points[i]->rw_index = i;
         }
+        this->invalidatePoints();
     }
 
     PolygonPoint& Polygon::findClosestPoint(const Transform::UnitVector& position,
@@ -112,12 +202,17 @@ namespace obe::Transform
         if (!m_points.empty())
         {
             const Transform::UnitVector pVec
-                = position.to<Transform::Units::SceneUnits>();
+                = position.to<Transform::Units::ScenePixels>();
+            const PolygonVertices& vertices = this->getVertices();
+            const auto distanceTo = [&vertices, &pVec](std::size_t i) {
+                return std::sqrt(std::pow(pVec.x - vertices.x[i], 2)
+                    + std::pow(pVec.y - vertices.y[i], 2));
+            };
             int closestPoint = 0;
             double tiniestDist = -1;
             for (std::size_t i = 0; i < m_points.size(); i++)
             {
-                const double currentPointDist = m_points[i]->distance(pVec);
+                const double currentPointDist = distanceTo(i);
                 if ((tiniestDist == -1 || tiniestDist > currentPointDist)
                     && !Utils::Vector::contains(i, excludedPoints))
                 {
@@ -133,8 +228,8 @@ namespace obe::Transform
                     leftNeighbor = m_points.size() - 1;
                 if (rightNeighbor >= m_points.size())
                     rightNeighbor = 0;
-                const int leftNeighborDist = m_points[leftNeighbor]->distance(position);
-                const int rightNeighborDist = m_points[rightNeighbor]->distance(position);
+                const double leftNeighborDist = distanceTo(leftNeighbor);
+                const double rightNeighborDist = distanceTo(rightNeighbor);
                 if (leftNeighborDist > rightNeighborDist)
                 {
                     closestPoint++;
@@ -149,48 +244,50 @@ namespace obe::Transform
 
     PolygonSegment Polygon::findClosestSegment(const Transform::UnitVector& position)
     {
-        const Transform::UnitVector p3 = position.to<Transform::Units::SceneUnits>();
-        const auto distanceLineFromPoint = [](const Transform::UnitVector& point,
-                                               const Transform::UnitVector& lineP1,
-                                               const Transform::UnitVector& lineP2) {
-            Transform::UnitVector lineDiff = lineP2 - lineP1;
-            if (lineDiff.x == 0 && lineDiff.y == 0)
+        const Transform::UnitVector p3 = position.to<Transform::Units::ScenePixels>();
+        const auto distanceLineFromPoint = [](double pointX, double pointY, double x1,
+                                               double y1, double x2, double y2) {
+            double diffX = x2 - x1;
+            double diffY = y2 - y1;
+            if (diffX == 0 && diffY == 0)
             {
-                lineDiff = point - lineP1;
-                return sqrt(lineDiff.x * lineDiff.x + lineDiff.y * lineDiff.y);
+                diffX = pointX - x1;
+                diffY = pointY - y1;
+                return std::sqrt(diffX * diffX + diffY * diffY);
             }
 
-            const double t
-                = ((point.x - lineP1.x) * lineDiff.x + (point.y - lineP1.y) * lineDiff.y)
-                / (lineDiff.x * lineDiff.x + lineDiff.y * lineDiff.y);
+            const double t = ((pointX - x1) * diffX + (pointY - y1) * diffY)
+                / (diffX * diffX + diffY * diffY);
 
             if (t < 0)
             {
                 // point is nearest to the first point i.e x1 and y1
-                lineDiff = point - lineP1;
+                diffX = pointX - x1;
+                diffY = pointY - y1;
             }
             else if (t > 1)
             {
                 // point is nearest to the end point i.e x2 and y2
-                lineDiff = point - lineP2;
+                diffX = pointX - x2;
+                diffY = pointY - y2;
             }
             else
             {
                 // if perpendicular line intersect the line segment.
-                lineDiff.x = point.x - (lineP1.x + t * lineDiff.x);
-                lineDiff.y = point.y - (lineP1.y + t * lineDiff.y);
+                diffX = pointX - (x1 + t * diffX);
+                diffY = pointY - (y1 + t * diffY);
             }
 
             // returning shortest distance
-            return sqrt(lineDiff.x * lineDiff.x + lineDiff.y * lineDiff.y);
+            return std::sqrt(diffX * diffX + diffY * diffY);
         };
+        const PolygonVertices& vertices = this->getVertices();
         double shortestDistance = -1;
         std::size_t shortestIndex = 0;
-        for (std::size_t i = 0, j = getAllPoints().size() - 1; i < getAllPoints().size();
-             j = i++)
+        for (std::size_t i = 0, j = m_points.size() - 1; i < m_points.size(); j = i++)
         {
-            const double currentDistance
-                = distanceLineFromPoint(p3, this->get(i), this->get(j));
+            const double currentDistance = distanceLineFromPoint(p3.x, p3.y,
+                vertices.x[i], vertices.y[i], vertices.x[j], vertices.y[j]);
             if (shortestDistance == -1 || currentDistance < shortestDistance)
             {
                 shortestDistance = currentDistance;
@@ -223,56 +320,34 @@ namespace obe::Transform
 
     UnitVector Polygon::getCentroid() const
     {
-        Transform::UnitVector centroid = { 0, 0 };
-        double signedArea = 0.0;
-        double x0, y0, x1, y1, a;
-
-        std::size_t i;
-        for (i = 0; i < m_points.size() - 1; ++i)
-        {
-            x0 = m_points[i]->x;
-            y0 = m_points[i]->y;
-            x1 = m_points[i + 1]->x;
-            y1 = m_points[i + 1]->y;
-            a = x0 * y1 - x1 * y0;
-            signedArea += a;
-            centroid.x += (x0 + x1) * a;
-            centroid.y += (y0 + y1) * a;
-        }
-
-        x0 = m_points[i]->x;
-        y0 = m_points[i]->y;
-        x1 = m_points[0]->x;
-        y1 = m_points[0]->y;
-        a = x0 * y1 - x1 * y0;
-        signedArea += a;
-        centroid.x += (x0 + x1) * a;
-        centroid.y += (y0 + y1) * a;
-
-        signedArea *= 0.5;
-        centroid.x /= (6.0 * signedArea);
-        centroid.y /= (6.0 * signedArea);
-
-        return centroid;
+        const PolygonVertices& vertices = this->getVertices();
+        return Transform::UnitVector(
+            vertices.centroidX, vertices.centroidY, Transform::Units::ScenePixels)
+            .to<Transform::Units::SceneUnits>();
     }
 
     std::optional<PolygonPoint*> Polygon::getPointAroundPosition(
         const Transform::UnitVector& position, const Transform::UnitVector& tolerance)
     {
-        const Transform::UnitVector pVec = position.to<Transform::Units::SceneUnits>();
+        const Transform::UnitVector pVec = position.to<Transform::Units::ScenePixels>();
         const Transform::UnitVector pTolerance
-            = tolerance.to<Transform::Units::SceneUnits>();
-        point_index_t i = 0;
-        for (auto& m_point : m_points)
+            = tolerance.to<Transform::Units::ScenePixels>();
+        const PolygonVertices& vertices = this->getVertices();
+        if (m_points.empty()
+            || !Utils::Math::isBetween(pVec.x, vertices.minX - pTolerance.x,
+                vertices.maxX + pTolerance.x)
+            || !Utils::Math::isBetween(pVec.y, vertices.minY - pTolerance.y,
+                vertices.maxY + pTolerance.y))
+            return std::nullopt;
+        for (point_index_t i = 0; i < m_points.size(); i++)
         {
-            if (Utils::Math::isBetween(
-                    pVec.x, m_point->x - pTolerance.x, m_point->x + pTolerance.x))
+            if (Utils::Math::isBetween(pVec.x, vertices.x[i] - pTolerance.x,
+                    vertices.x[i] + pTolerance.x))
             {
-                if (Utils::Math::isBetween(
-                        pVec.y, m_point->y - pTolerance.y, m_point->y + pTolerance.y))
-                    return std::optional<PolygonPoint*>(m_point.get());
+                if (Utils::Math::isBetween(pVec.y, vertices.y[i] - pTolerance.y,
+                        vertices.y[i] + pTolerance.y))
+                    return std::optional<PolygonPoint*>(m_points[i].get());
             }
-            i++;
         }
         return std::nullopt;
     }
@@ -280,15 +355,15 @@ namespace obe::Transform
     bool Polygon::isCentroidAroundPosition(const Transform::UnitVector& position,
         const Transform::UnitVector& tolerance) const
     {
-        const Transform::UnitVector pVec = position.to<Transform::Units::SceneUnits>();
+        const Transform::UnitVector pVec = position.to<Transform::Units::ScenePixels>();
         const Transform::UnitVector pTolerance
-            = tolerance.to<Transform::Units::SceneUnits>();
-        const Transform::UnitVector centroid = this->getCentroid();
-        if (Utils::Math::isBetween(
-                pVec.x, centroid.x - pTolerance.x, centroid.x + pTolerance.x))
+            = tolerance.to<Transform::Units::ScenePixels>();
+        const PolygonVertices& vertices = this->getVertices();
+        if (Utils::Math::isBetween(pVec.x, vertices.centroidX - pTolerance.x,
+                vertices.centroidX + pTolerance.x))
         {
-            if (Utils::Math::isBetween(
-                    pVec.y, centroid.y - pTolerance.x, centroid.y + pTolerance.y))
+            if (Utils::Math::isBetween(pVec.y, vertices.centroidY - pTolerance.y,
+                    vertices.centroidY + pTolerance.y))
                 return true;
         }
         return false;
@@ -324,11 +399,12 @@ namespace obe::Transform
         const double radAngle = (Utils::Math::pi / 180.0) * -angle;
         for (auto& point : m_points)
         {
-            point->set(std::cos(radAngle) * (point->x - origin.x)
+            point->UnitVector::set(std::cos(radAngle) * (point->x - origin.x)
                     - std::sin(radAngle) * (point->y - origin.y) + origin.x,
                 std::sin(radAngle) * (point->x - origin.x)
                     + std::cos(radAngle) * (point->y - origin.y) + origin.y);
         }
+        this->invalidatePoints();
     }
 
     void Polygon::move(const Transform::UnitVector& position)
@@ -337,6 +413,7 @@ namespace obe::Transform
         {
             for (auto& point : m_points)
                 *point += position;
+            this->invalidatePoints();
         }
     }
 
@@ -348,11 +425,12 @@ namespace obe::Transform
                 = position.to<Transform::Units::SceneUnits>();
             const Transform::UnitVector addPosition = pVec - *m_points[0];
 
-            m_points[0]->set(pVec);
+            m_points[0]->UnitVector::set(pVec);
             for (auto& point : m_points)
             {
                 *point += addPosition;
             }
+            this->invalidatePoints();
         }
     }
 
@@ -369,6 +447,7 @@ namespace obe::Transform
             {
                 *point += addPosition;
             }
+            this->invalidatePoints();
         }
     }
 
@@ -40,6 +40,11 @@ namespace obe::Transform
         m_angle += angle;
         if (m_angle < 0 || m_angle > 360)
             m_angle = Utils::Math::normalize(m_angle, 0, 360);
+        this->onRectChanged();
+    }
+
+    void Rect::onRectChanged()
+    {
     }
 
     void Rect::transformRef(
@@ -192,6 +197,7 @@ namespace obe::Transform
         UnitVector pVec = position.to<Units::SceneUnits>();
         this->transformRef(pVec, ref, ConversionType::To);
         m_position.set(pVec);
+        this->onRectChanged();
     }
 
     void Rect::setSize(const UnitVector& size, const Referential& ref)
@@ -214,6 +220,7 @@ namespace obe::Transform
     void Rect::move(const UnitVector& position)
     {
         m_position += position;
+        this->onRectChanged();
     }
 
     void Rect::scale(const UnitVector& size, const Referential& ref)
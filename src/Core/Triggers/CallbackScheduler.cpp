@@ -1,25 +1,15 @@
 #include <Triggers/CallbackScheduler.hpp>
+#include <Triggers/TriggerManager.hpp>
 
 namespace obe::Triggers
 {
     void CallbackScheduler::execute()
     {
-        if (!m_repeat)
+        m_currentTimes++;
+        if (!m_repeat || (m_times > 0 && m_currentTimes >= m_times))
         {
             m_state = CallbackSchedulerState::Done;
         }
-        else
-        {
-            if (m_times > 0 && m_times == (m_currentTimes - 1))
-            {
-                m_state = CallbackSchedulerState::Done;
-            }
-            else
-            {
-                m_start = Time::epoch();
-                m_currentTimes++;
-            }
-        }
         m_callback();
     }
 
@@ -48,15 +38,22 @@ namespace obe::Triggers
         return *this;
     }
 
-    void CallbackScheduler::run(const Callback& callback)
+    CallbackHandle CallbackScheduler::run(const Callback& callback)
     {
         m_callback = callback;
         m_state = CallbackSchedulerState::Ready;
-        m_start = Time::epoch();
+        m_currentTimes = 0;
+        m_triggers.startScheduler(*this);
+        return m_handle;
     }
 
     void CallbackScheduler::stop()
     {
-        m_state = CallbackSchedulerState::Done;
+        m_triggers.stopScheduler(*this);
+    }
+
+    CallbackHandle CallbackScheduler::getHandle() const
+    {
+        return m_handle;
     }
 }
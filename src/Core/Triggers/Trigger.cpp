@@ -6,33 +6,63 @@
 
 namespace obe::Triggers
 {
+    namespace
+    {
+        std::vector<std::string> getCallbackParameters(const sol::function& callback)
+        {
+            lua_State* L = callback.lua_state();
+            lua_Debug info;
+            callback.push();
+            lua_pushvalue(L, -1);
+            lua_getinfo(L, ">u", &info);
+            std::vector<std::string> parameters;
+            parameters.reserve(info.nparams);
+            for (int i = 1; i <= info.nparams; i++)
+                parameters.emplace_back(lua_getlocal(L, nullptr, i));
+            lua_pop(L, 1);
+            return parameters;
+        }
+
+        int tracebackHandler(lua_State* L)
+        {
+            const char* message = lua_tostring(L, 1);
+            luaL_traceback(L, L, message ? message : "(error object is not a string)", 1);
+            return 1;
+        }
+    }
+
     sol::protected_function makeCallback(
-        sol::state_view lua, const std::string& triggerTableName, TriggerEnv& env)
-    {
-        const sol::protected_function MakeCallback
-            = lua["LuaCore"]["MakeCallback"].get<sol::protected_function>();
-        env.environment.set_on(MakeCallback);
-        sol::protected_function callback
-            = lua.safe_script("return " + env.callback, env.environment)
-                  .get<sol::protected_function>();
-        const sol::protected_function_result makeCallbackResult
-            = MakeCallback.call(triggerTableName, callback, env.callback);
-        if (!makeCallbackResult.valid())
+        sol::state_view lua, Trigger& trigger, TriggerEnv& env)
+    {
+        const std::string triggerTableName = trigger.getTriggerLuaTableName();
+        const sol::protected_function_result callbackResult = lua.safe_script(
+            "return " + env.callback, env.environment, sol::script_pass_on_error);
+        if (!callbackResult.valid())
         {
-            const auto errObj = makeCallbackResult.get<sol::error>();
-            const auto errMsg = errObj.what();
+            const auto errObj = callbackResult.get<sol::error>();
             throw Exceptions::CallbackCreationError(
-                triggerTableName, env.id, env.callback, errMsg, EXC_INFO);
+                triggerTableName, env.id, env.callback, errObj.what(), EXC_INFO);
+        }
+        if (callbackResult.get_type() != sol::type::function)
+        {
+            throw Exceptions::CallbackCreationError(triggerTableName, env.id,
+                env.callback, "callback is not a function", EXC_INFO);
+        }
+        // The callback is resolved once, its argument ids are matched with its
+        // parameters so they can be pushed on the Lua stack in order
+        sol::protected_function callback = callbackResult.get<sol::protected_function>();
+        env.arguments.clear();
+        for (const std::string& parameter :
+            getCallbackParameters(callbackResult.get<sol::function>()))
+        {
+            env.arguments.push_back(trigger.getArgumentId(parameter));
         }
-        sol::protected_function callbackWithArgs
-            = makeCallbackResult.get<sol::protected_function>();
-        env.environment.set_on(callbackWithArgs);
-        return callbackWithArgs;
+        return callback;
     }
 
-    std::string Trigger::getTriggerLuaTableName() const
+    const std::string& Trigger::getTriggerLuaTableName() const
     {
-        return this->getNamespace() + "__" + this->getGroup() + "__" + m_name;
+        return m_luaTableName;
     }
 
     Trigger::Trigger(TriggerGroup& parent, const std::string& name, bool startState)
@@ -43,9 +73,14 @@ namespace obe::Triggers
         m_parent = parent;
         m_enabled = startState;
         m_fullName = this->getNamespace() + "." + this->getGroup() + "." + m_name;
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()].get_or_create<sol::table>();
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"]
-            .get_or_create<sol::table>();
+#if defined(OBE_ENABLE_PROFILER)
+        // Zones are shared by the Triggers of all namespaces, GameObjects have
+        // their own namespace and would register a new zone each
+        m_profilerZone = Debug::EngineProfiler.getZoneId(
+            "Trigger " + this->getGroup() + "." + m_name);
+#endif
+        m_luaTableName = this->getNamespace() + "__" + this->getGroup() + "__" + m_name;
+        m_luaTable = m_lua["__TRIGGERS"][m_luaTableName].get_or_create<sol::table>();
         Debug::Log->trace(
             "<Trigger> Creating Trigger {0} @{1}", m_fullName, fmt::ptr(this));
     }
@@ -78,9 +113,7 @@ namespace obe::Triggers
             environment.pointer(), m_name, callback);
         m_registeredEnvs.emplace_back(id, environment, callback, active);
 
-        sol::table triggerRef = environment["__TRIGGERS"][this->getTriggerLuaTableName()]
-                                    .get_or_create<sol::table>();
-        triggerRef["callback"] = callback;
+        m_luaTable["callback"] = callback;
         if (m_onRegisterCallback)
         {
             Debug::Log->trace(
@@ -122,7 +155,16 @@ namespace obe::Triggers
 
     void Trigger::execute()
     {
+        OBE_PROFILE_ZONE_ID(m_profilerZone);
         m_currentlyTriggered = true;
+        struct ExecutionGuard
+        {
+            Trigger& trigger;
+            ~ExecutionGuard()
+            {
+                trigger.endExecution();
+            }
+        } guard { *this };
         Debug::Log->trace("<Trigger> Executing Trigger {0}", m_fullName);
         for (std::size_t i = 0; i < m_registeredEnvs.size(); i++)
         {
@@ -136,36 +178,46 @@ namespace obe::Triggers
 
                 if (!rEnv.call)
                 {
-                    rEnv.call = makeCallback(m_lua, this->getTriggerLuaTableName(), rEnv);
+                    rEnv.call = makeCallback(m_lua, *this, rEnv);
                 }
 
-                sol::protected_function_result result = rEnv.call();
-                if (!result.valid())
+                // Arguments go from their slots to the Lua stack without any table
+                lua_State* L = m_lua.lua_state();
+                lua_pushcfunction(L, tracebackHandler);
+                rEnv.call.push(L);
+                for (const std::size_t argument : rEnv.arguments)
+                    m_arguments[argument].push(L);
+                const int status = lua_pcall(L, static_cast<int>(rEnv.arguments.size()),
+                    0, -static_cast<int>(rEnv.arguments.size()) - 2);
+                if (status != LUA_OK)
                 {
-                    const auto errObj = result.get<sol::error>();
+                    const std::string error = lua_tostring(L, -1);
+                    lua_pop(L, 2);
                     const std::string errMsg = "\n        \""
-                        + Utils::String::replace(errObj.what(), "\n", "\n        ")
-                        + "\"";
+                        + Utils::String::replace(error, "\n", "\n        ") + "\"";
                     const std::string fullName = this->getNamespace() + "."
                         + this->getGroup() + "." + this->getName();
                     throw Exceptions::TriggerExecutionError(
                         fullName, rEnv.id, rEnv.callback, errMsg, EXC_INFO);
                 }
+                lua_pop(L, 1);
             }
         }
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"].set(
-            sol::new_table());
-        if (!m_envsToRemove.empty())
+    }
+
+    void Trigger::endExecution()
+    {
+        for (sol::object& argument : m_arguments)
+            argument = sol::object();
+        for (sol::environment envToRemove : m_envsToRemove)
         {
-            for (sol::environment envToRemove : m_envsToRemove)
-            {
-                m_registeredEnvs.erase(
-                    std::remove_if(m_registeredEnvs.begin(), m_registeredEnvs.end(),
-                        [&envToRemove](
-                            TriggerEnv& env) { return env.environment == envToRemove; }),
-                    m_registeredEnvs.end());
-            }
+            m_registeredEnvs.erase(
+                std::remove_if(m_registeredEnvs.begin(), m_registeredEnvs.end(),
+                    [&envToRemove](
+                        TriggerEnv& env) { return env.environment == envToRemove; }),
+                m_registeredEnvs.end());
         }
+        m_envsToRemove.clear();
         m_currentlyTriggered = false;
     }
 
@@ -174,7 +226,42 @@ namespace obe::Triggers
         Debug::Log->trace(
             "<Trigger> Pushing parameter {0} (type: {1}) to Trigger {2} (From Lua)", name,
             static_cast<int>(parameter.get_type()), m_fullName);
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"][name] = parameter;
+        m_arguments[this->getArgumentId(name)] = std::move(parameter);
+    }
+
+    std::vector<std::pair<std::size_t, sol::object>> Trigger::takeParameters()
+    {
+        std::vector<std::pair<std::size_t, sol::object>> parameters;
+        for (std::size_t argument = 0; argument < m_arguments.size(); argument++)
+        {
+            if (m_arguments[argument].valid())
+            {
+                parameters.emplace_back(argument, std::move(m_arguments[argument]));
+                m_arguments[argument] = sol::object();
+            }
+        }
+        return parameters;
+    }
+
+    std::size_t Trigger::getArgumentId(const std::string& name)
+    {
+        const auto argument
+            = std::find(m_argumentNames.begin(), m_argumentNames.end(), name);
+        if (argument != m_argumentNames.end())
+            return std::distance(m_argumentNames.begin(), argument);
+        m_argumentNames.push_back(name);
+        m_arguments.emplace_back();
+        return m_argumentNames.size() - 1;
+    }
+
+    void Trigger::setCoalesced(bool coalesced)
+    {
+        m_coalesced = coalesced;
+    }
+
+    bool Trigger::isCoalesced() const
+    {
+        return m_coalesced;
     }
 
     void Trigger::onRegister(std::function<void(const TriggerEnv&)> callback)
@@ -1,3 +1,5 @@
+#include <cassert>
+
 #include <Debug/Logger.hpp>
 #include <Triggers/Exceptions.hpp>
 #include <Triggers/TriggerGroup.hpp>
@@ -19,11 +21,19 @@ namespace obe::Triggers
             "<TriggerGroup> Deleting TriggerGroup '{}.{}'", m_fromNsp, m_name);
     }
 
+    void TriggerGroup::checkQueuedThread() const
+    {
+        // Parameters are turned into Lua objects as soon as they are pushed
+        assert(!m_queued || !m_manager
+            || std::this_thread::get_id() == m_manager->m_thread);
+    }
+
     std::weak_ptr<Trigger> TriggerGroup::get(const std::string& triggerName)
     {
-        if (m_triggerMap.find(triggerName) != m_triggerMap.end())
+        if (const auto trigger = m_triggerMap.find(triggerName);
+            trigger != m_triggerMap.end())
         {
-            return m_triggerMap[triggerName];
+            return trigger->second;
         }
         throw Exceptions::UnknownTrigger(
             m_fromNsp, m_name, triggerName, this->getTriggersNames(), EXC_INFO);
@@ -33,7 +43,10 @@ namespace obe::Triggers
     {
         Debug::Log->debug("<TriggerGroup> Add Trigger {0} to TriggerGroup {1}.{2}",
             triggerName, m_fromNsp, m_name);
-        m_triggerMap[triggerName] = std::make_unique<Trigger>(*this, triggerName);
+        std::shared_ptr<Trigger>& trigger = m_triggerMap[triggerName];
+        trigger = std::make_unique<Trigger>(*this, triggerName);
+        if (m_manager)
+            m_manager->attachTrigger(*trigger);
         return *this;
     }
 
@@ -41,8 +54,13 @@ namespace obe::Triggers
     {
         Debug::Log->debug("<TriggerGroup> Remove Trigger {0} from TriggerGroup {1}.{2}",
             triggerName, m_fromNsp, m_name);
-        if (m_triggerMap.find(triggerName) != m_triggerMap.end())
-            m_triggerMap.erase(triggerName);
+        if (const auto trigger = m_triggerMap.find(triggerName);
+            trigger != m_triggerMap.end())
+        {
+            if (m_manager)
+                m_manager->detachTrigger(*trigger->second);
+            m_triggerMap.erase(trigger);
+        }
         else
         {
             throw Exceptions::UnknownTrigger(
@@ -55,7 +73,22 @@ namespace obe::Triggers
     {
         Debug::Log->trace("<TriggerGroup> Trigger {0} from TriggerGroup {1}.{2}",
             triggerName, m_fromNsp, m_name);
-        this->get(triggerName).lock()->execute();
+        this->checkQueuedThread();
+        const std::shared_ptr<Trigger> trigger = this->get(triggerName).lock();
+        if (m_queued && m_manager)
+        {
+            // The parameters pushed so far are queued with the execution
+            const TriggerHandle handle
+                = m_manager->getTriggerHandle(m_fromNsp, m_name, triggerName);
+            m_manager->enqueue(handle,
+                [handle, parameters = trigger->takeParameters()](
+                    TriggerManager& triggers) {
+                    for (const auto& [argument, value] : parameters)
+                        triggers.pushParameter(handle, argument, value);
+                });
+        }
+        else
+            trigger->execute();
         return *this;
     }
 
@@ -69,9 +102,20 @@ namespace obe::Triggers
         return m_joinable;
     }
 
+    void TriggerGroup::setQueued(bool queued)
+    {
+        m_queued = queued;
+    }
+
+    bool TriggerGroup::isQueued() const
+    {
+        return m_queued;
+    }
+
     void TriggerGroup::pushParameterFromLua(const std::string& triggerName,
         const std::string& parameterName, sol::object parameter)
     {
+        this->checkQueuedThread();
         this->get(triggerName).lock()->pushParameterFromLua(parameterName, parameter);
     }
 
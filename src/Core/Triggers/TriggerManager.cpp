@@ -1,18 +1,105 @@
+#include <algorithm>
+#include <cmath>
+
 #include <Triggers/Exceptions.hpp>
 #include <Triggers/TriggerManager.hpp>
 
 namespace obe::Triggers
 {
+    namespace
+    {
+        constexpr std::uint32_t getHandleSlot(TriggerHandle handle)
+        {
+            return static_cast<std::uint32_t>(handle);
+        }
+
+        constexpr std::uint32_t getHandleGeneration(TriggerHandle handle)
+        {
+            return static_cast<std::uint32_t>(handle >> 32);
+        }
+
+        constexpr TriggerHandle makeHandle(std::uint32_t slot, std::uint32_t generation)
+        {
+            return (static_cast<TriggerHandle>(generation) << 32) | slot;
+        }
+
+        // Same as Trigger::getTriggerLuaTableName
+        std::string makeTriggerKey(const std::string& space, const std::string& group,
+            const std::string& trigger)
+        {
+            return space + "__" + group + "__" + trigger;
+        }
+
+        constexpr std::uint32_t NoScheduler = std::numeric_limits<std::uint32_t>::max();
+
+        std::uint64_t toTimerTicks(Time::TimeUnit amount)
+        {
+            // Ticks are milliseconds, the epsilon keeps 0.1s from becoming 101ms
+            return static_cast<std::uint64_t>(
+                std::max(std::ceil(amount / Time::milliseconds - 1e-6), 0.0));
+        }
+    }
+
     TriggerManager::TriggerManager(sol::state_view lua)
-        : m_lua(lua)
+        : m_timers(static_cast<std::uint64_t>(Time::now() / Time::milliseconds))
+        , m_lua(lua)
     {
         Debug::Log->debug("<TriggerManager> Initializing TriggerManager");
         m_databaseChrono.start();
     }
 
+    TriggerManager::~TriggerManager()
+    {
+        this->clearQueue();
+    }
+
+    void TriggerManager::attachTrigger(Trigger& trigger)
+    {
+        if (const auto handle = m_triggerHandles.find(trigger.getTriggerLuaTableName());
+            handle != m_triggerHandles.end())
+        {
+            // A Trigger added again with the same name replaces the previous one
+            m_handleSlots[getHandleSlot(handle->second)].first = &trigger;
+            return;
+        }
+        std::uint32_t slot;
+        if (!m_freeHandleSlots.empty())
+        {
+            slot = m_freeHandleSlots.back();
+            m_freeHandleSlots.pop_back();
+            m_handleSlots[slot].first = &trigger;
+        }
+        else
+        {
+            slot = static_cast<std::uint32_t>(m_handleSlots.size());
+            m_handleSlots.emplace_back(&trigger, 0);
+        }
+        const TriggerHandle handle = makeHandle(slot, m_handleSlots[slot].second);
+        m_triggerHandles.emplace(trigger.getTriggerLuaTableName(), handle);
+    }
+
+    void TriggerManager::detachTrigger(const Trigger& trigger)
+    {
+        const auto handle = m_triggerHandles.find(trigger.getTriggerLuaTableName());
+        if (handle == m_triggerHandles.end())
+            return;
+        const std::uint32_t slot = getHandleSlot(handle->second);
+        if (m_handleSlots[slot].first != &trigger)
+            return;
+        // The generation makes the handles of the removed Trigger invalid
+        m_handleSlots[slot].first = nullptr;
+        m_handleSlots[slot].second++;
+        m_freeHandleSlots.push_back(slot);
+        m_triggerHandles.erase(handle);
+    }
+
     std::weak_ptr<Trigger> TriggerManager::getTrigger(
         const std::string& space, const std::string& group, const std::string& trigger)
     {
+        const auto handle = m_triggerHandles.find(makeTriggerKey(space, group, trigger));
+        if (handle != m_triggerHandles.end())
+            return m_handleSlots[getHandleSlot(handle->second)].first->weak_from_this();
+        // Unknown Triggers are looked up again to report what is missing
         if (m_allTriggers.find(space) != m_allTriggers.end())
         {
             if (m_allTriggers[space].find(group) != m_allTriggers[space].end())
@@ -30,6 +117,115 @@ namespace obe::Triggers
         throw Exceptions::UnknownTriggerNamespace(space, namespaces, EXC_INFO);
     }
 
+    TriggerHandle TriggerManager::getTriggerHandle(
+        const std::string& space, const std::string& group, const std::string& trigger)
+    {
+        const auto handle = m_triggerHandles.find(makeTriggerKey(space, group, trigger));
+        if (handle != m_triggerHandles.end())
+            return handle->second;
+        // Throws the errors explaining which part of the name is unknown
+        this->getTrigger(space, group, trigger);
+        // Triggers are attached when they are added to a TriggerGroup of this
+        // TriggerManager, which detaches them when they are removed, handles to
+        // any other Trigger could outlive it
+        throw Exceptions::UnknownTrigger(space, group, trigger,
+            this->getAllTriggersNameFromTriggerGroup(space, group), EXC_INFO);
+    }
+
+    Trigger* TriggerManager::findTrigger(TriggerHandle handle)
+    {
+        const std::uint32_t slot = getHandleSlot(handle);
+        if (slot >= m_handleSlots.size()
+            || m_handleSlots[slot].second != getHandleGeneration(handle))
+        {
+            return nullptr;
+        }
+        return m_handleSlots[slot].first;
+    }
+
+    Trigger& TriggerManager::getTrigger(TriggerHandle handle)
+    {
+        if (Trigger* trigger = this->findTrigger(handle))
+            return *trigger;
+        throw Exceptions::UnknownTriggerHandle(handle, EXC_INFO);
+    }
+
+    void TriggerManager::trigger(TriggerHandle handle)
+    {
+        this->getTrigger(handle).execute();
+    }
+
+    void TriggerManager::enqueue(
+        TriggerHandle handle, std::function<void(TriggerManager&)> pushParameters)
+    {
+        auto* queued = new QueuedTrigger { handle, std::move(pushParameters) };
+        queued->next = m_queue.load(std::memory_order_relaxed);
+        while (!m_queue.compare_exchange_weak(
+            queued->next, queued, std::memory_order_release, std::memory_order_relaxed))
+            ;
+    }
+
+    void TriggerManager::dispatchQueue()
+    {
+        QueuedTrigger* queued = m_queue.exchange(nullptr, std::memory_order_acquire);
+        if (!queued)
+            return;
+        OBE_PROFILE_ZONE("TriggerManager::dispatchQueue");
+        // Triggers queued while dispatching wait for the next dispatch
+        std::vector<std::unique_ptr<QueuedTrigger>> batch;
+        while (queued)
+        {
+            QueuedTrigger* next = queued->next;
+            batch.emplace_back(queued);
+            queued = next;
+        }
+        std::reverse(batch.begin(), batch.end());
+        std::unordered_map<TriggerHandle, std::size_t> lastExecutions;
+        for (std::size_t i = 0; i < batch.size(); i++)
+        {
+            const Trigger* trigger = this->findTrigger(batch[i]->trigger);
+            if (trigger && trigger->isCoalesced())
+                lastExecutions[batch[i]->trigger] = i;
+        }
+        for (std::size_t i = 0; i < batch.size(); i++)
+        {
+            Trigger* trigger = this->findTrigger(batch[i]->trigger);
+            if (!trigger)
+            {
+                Debug::Log->warn("<TriggerManager> Dropping queued execution of "
+                                 "removed Trigger (handle {})",
+                    batch[i]->trigger);
+                continue;
+            }
+            // A failing execution does not drop the rest of the batch
+            try
+            {
+                if (batch[i]->pushParameters)
+                    batch[i]->pushParameters(*this);
+                const auto lastExecution = lastExecutions.find(batch[i]->trigger);
+                if (lastExecution == lastExecutions.end() || lastExecution->second == i)
+                    trigger->execute();
+            }
+            catch (const std::exception& e)
+            {
+                Debug::Log->error("<TriggerManager> Queued execution of Trigger {} "
+                                  "failed : {}",
+                    trigger->getTriggerLuaTableName(), e.what());
+            }
+        }
+    }
+
+    void TriggerManager::clearQueue()
+    {
+        QueuedTrigger* queued = m_queue.exchange(nullptr, std::memory_order_acquire);
+        while (queued)
+        {
+            QueuedTrigger* next = queued->next;
+            delete queued;
+            queued = next;
+        }
+    }
+
     void TriggerManager::createNamespace(const std::string& space)
     {
         Debug::Log->debug(
@@ -59,6 +255,7 @@ namespace obe::Triggers
             {
                 TriggerGroupPtr newGroup(new TriggerGroup(m_lua, space, group),
                     [this](TriggerGroup* ptr) { this->removeTriggerGroup(ptr); });
+                newGroup->m_manager = this;
                 m_allTriggers[space][group] = newGroup;
                 return newGroup;
             }
@@ -156,6 +353,8 @@ namespace obe::Triggers
     {
         Debug::Log->debug("<TriggerManager> Removing TriggerGroup {0} from Namespace {1}",
             trgGroup->getName(), trgGroup->getNamespace());
+        for (const Trigger* trigger : trgGroup->getTriggers())
+            this->detachTrigger(*trigger);
         m_allTriggers[trgGroup->getNamespace()].erase(trgGroup->getName());
     }
 
@@ -177,38 +376,130 @@ namespace obe::Triggers
     void TriggerManager::update()
     {
         Debug::Log->trace("<TriggerManager> Updating TriggerManager");
-        for (auto& scheduler : m_schedulers)
+        m_dueTimers.clear();
+        m_timers.advance(this->getTimersTick(), m_dueTimers);
+        // Callbacks can stop or create other CallbackSchedulers, the due ones
+        // are looked up again by handle before each execution
+        m_dueSchedulers.clear();
+        for (const std::uint32_t slot : m_dueTimers)
+            m_dueSchedulers.push_back(makeHandle(slot, m_schedulers[slot].second));
+        for (const CallbackHandle handle : m_dueSchedulers)
         {
-            if (scheduler->m_state == CallbackSchedulerState::Ready)
+            CallbackScheduler* scheduler = this->findScheduler(handle);
+            if (!scheduler || scheduler->m_state != CallbackSchedulerState::Ready)
+                continue;
+            const std::uint32_t slot = getHandleSlot(handle);
+            m_executingScheduler = slot;
+            scheduler->execute();
+            m_executingScheduler = NoScheduler;
+            if (scheduler->m_state != CallbackSchedulerState::Ready)
+                this->freeScheduler(slot);
+            else if (!m_timers.contains(slot))
             {
-                const Time::TimeUnit elapsed = Time::epoch() - scheduler->m_start;
-                if ((scheduler->m_wait && elapsed >= scheduler->m_after)
-                    || (scheduler->m_repeat && elapsed >= scheduler->m_every))
-                {
-                    scheduler->execute();
-                }
+                // Next deadline is based on the previous one so that repeated
+                // callbacks do not drift, unless they are late
+                scheduler->m_deadline = std::max(
+                    scheduler->m_deadline + toTimerTicks(scheduler->m_every),
+                    m_timers.getCurrentTick());
+                m_timers.insert(slot, scheduler->m_deadline);
             }
         }
-        m_schedulers.erase(std::remove_if(m_schedulers.begin(), m_schedulers.end(),
-                               [](auto& scheduler) {
-                                   return scheduler->m_state
-                                       == CallbackSchedulerState::Done;
-                               }),
-            m_schedulers.end());
     }
 
     void TriggerManager::clear()
     {
         Debug::Log->debug("<TriggerManager> Clearing TriggerManager");
         m_databaseChrono.stop();
+        this->clearQueue();
         m_allTriggers.clear();
         m_databaseChrono.start();
         // Need to delete Map-only stuff !!
     }
 
+    CallbackScheduler* TriggerManager::findScheduler(CallbackHandle handle)
+    {
+        const std::uint32_t slot = getHandleSlot(handle);
+        if (slot >= m_schedulers.size()
+            || m_schedulers[slot].second != getHandleGeneration(handle))
+        {
+            return nullptr;
+        }
+        return m_schedulers[slot].first.get();
+    }
+
+    std::uint64_t TriggerManager::getTimersTick() const
+    {
+        return static_cast<std::uint64_t>(Time::now() / Time::milliseconds);
+    }
+
+    void TriggerManager::startScheduler(CallbackScheduler& scheduler)
+    {
+        // CallbackSchedulers not created by schedule() are never executed
+        if (this->findScheduler(scheduler.m_handle) != &scheduler)
+            return;
+        const Time::TimeUnit delay = scheduler.m_wait
+            ? scheduler.m_after
+            : (scheduler.m_repeat ? scheduler.m_every : 0);
+        scheduler.m_deadline = this->getTimersTick() + toTimerTicks(delay);
+        m_timers.insert(getHandleSlot(scheduler.m_handle), scheduler.m_deadline);
+    }
+
+    void TriggerManager::stopScheduler(CallbackScheduler& scheduler)
+    {
+        if (this->findScheduler(scheduler.m_handle) == &scheduler)
+            this->cancel(scheduler.m_handle);
+        else
+            scheduler.m_state = CallbackSchedulerState::Done;
+    }
+
+    void TriggerManager::freeScheduler(std::uint32_t slot)
+    {
+        m_timers.remove(slot);
+        m_schedulers[slot].first.reset();
+        m_schedulers[slot].second++;
+        m_freeSchedulerSlots.push_back(slot);
+    }
+
     CallbackScheduler& TriggerManager::schedule()
     {
-        m_schedulers.push_back(std::make_unique<CallbackScheduler>(*this));
-        return *m_schedulers.back().get();
+        std::uint32_t slot;
+        if (!m_freeSchedulerSlots.empty())
+        {
+            slot = m_freeSchedulerSlots.back();
+            m_freeSchedulerSlots.pop_back();
+        }
+        else
+        {
+            slot = static_cast<std::uint32_t>(m_schedulers.size());
+            m_schedulers.emplace_back(nullptr, 0);
+        }
+        auto& [scheduler, generation] = m_schedulers[slot];
+        scheduler = std::make_unique<CallbackScheduler>(*this);
+        scheduler->m_handle = makeHandle(slot, generation);
+        return *scheduler;
+    }
+
+    bool TriggerManager::cancel(CallbackHandle handle)
+    {
+        CallbackScheduler* scheduler = this->findScheduler(handle);
+        if (!scheduler || scheduler->m_state == CallbackSchedulerState::Done)
+            return false;
+        scheduler->m_state = CallbackSchedulerState::Done;
+        m_timers.remove(getHandleSlot(handle));
+        // A CallbackScheduler stopping itself is freed once its callback returns
+        if (getHandleSlot(handle) != m_executingScheduler)
+            this->freeScheduler(getHandleSlot(handle));
+        return true;
+    }
+
+    bool TriggerManager::isScheduled(CallbackHandle handle)
+    {
+        return this->findScheduler(handle)
+            && m_timers.contains(getHandleSlot(handle));
+    }
+
+    std::size_t TriggerManager::getScheduledAmount() const
+    {
+        return m_timers.size();
     }
 } // namespace obe::Triggers
\ No newline at end of file
@@ -1,7 +1,14 @@
+#include <atomic>
+
 #include <Types/Identifiable.hpp>
 
 namespace obe::Types
 {
+    namespace
+    {
+        std::atomic<std::size_t> RenameCount = 0;
+    }
+
     Identifiable::Identifiable(const std::string& id)
     {
         m_id = id;
@@ -9,11 +16,19 @@ namespace obe::Types
 
     void Identifiable::setId(const std::string& id)
     {
+        if (id == m_id)
+            return;
         m_id = id;
+        RenameCount++;
     }
 
     std::string Identifiable::getId() const
     {
         return m_id;
     }
+
+    std::size_t Identifiable::GetRenameCount()
+    {
+        return RenameCount;
+    }
 } // namespace obe::Types
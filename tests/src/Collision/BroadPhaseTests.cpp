@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Collision/BroadPhase.hpp>
+#include <Collision/PolygonalCollider.hpp>
+
+using namespace obe::Collision;
+using obe::Transform::UnitVector;
+
+namespace
+{
+    // Reference implementation : walks the whole Pool and keeps the colliders
+    // of the BroadPhase whose bounds overlap the area
+    std::vector<PolygonalCollider*> getOverlappingColliders(
+        const BroadPhase& broadPhase, const AABB& area)
+    {
+        std::vector<PolygonalCollider*> overlapping;
+        for (PolygonalCollider* collider : PolygonalCollider::Pool)
+        {
+            if (collider->getBroadPhase() == &broadPhase
+                && collider->getBounds().intersects(area))
+                overlapping.push_back(collider);
+        }
+        std::sort(overlapping.begin(), overlapping.end());
+        return overlapping;
+    }
+
+    void addRectangle(PolygonalCollider& collider, const UnitVector& position,
+        const UnitVector& size)
+    {
+        collider.addPoint(position);
+        collider.addPoint(position + UnitVector(size.x, 0));
+        collider.addPoint(position + size);
+        collider.addPoint(position + UnitVector(0, size.y));
+    }
+}
+
+TEST_CASE("BroadPhases return the same colliders as a brute force scan",
+    "[obe.Collision.BroadPhase]")
+{
+    UnitVector::Init(1000, 1000);
+    UnitVector::View = { 10, 10, 0, 0 };
+    const BroadPhaseType type
+        = GENERATE(BroadPhaseType::AABBTree, BroadPhaseType::UniformGrid);
+    std::unique_ptr<BroadPhase> broadPhase = makeBroadPhase(type);
+    // The AABBTree returns every leaf whose fattened bounds overlap the area
+    const bool exact = type == BroadPhaseType::UniformGrid;
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> position(-20, 20);
+    std::uniform_real_distribution<double> size(0.05, 1.5);
+    std::vector<std::unique_ptr<PolygonalCollider>> colliders;
+    for (int i = 0; i < 300; i++)
+    {
+        auto collider
+            = std::make_unique<PolygonalCollider>("collider" + std::to_string(i));
+        addRectangle(*collider, UnitVector(position(generator), position(generator)),
+            UnitVector(size(generator), size(generator)));
+        collider->attachBroadPhase(broadPhase.get());
+        colliders.push_back(std::move(collider));
+    }
+    // A huge collider covering more cells than a UniformGrid stores
+    colliders.front()->get(1).move(UnitVector(30, 0));
+    colliders.front()->get(2).move(UnitVector(30, 30));
+    colliders.front()->get(3).move(UnitVector(0, 30));
+    REQUIRE(broadPhase->size() == colliders.size());
+
+    const auto checkQueries = [&]() {
+        for (int i = 0; i < 50; i++)
+        {
+            const double x = position(generator);
+            const double y = position(generator);
+            const AABB area(x, y, x + size(generator) * 4, y + size(generator) * 4);
+            std::vector<PolygonalCollider*> found;
+            broadPhase->query(area, found);
+            std::sort(found.begin(), found.end());
+            REQUIRE(std::adjacent_find(found.begin(), found.end()) == found.end());
+            const std::vector<PolygonalCollider*> expected
+                = getOverlappingColliders(*broadPhase, area);
+            if (exact)
+                REQUIRE(found == expected);
+            else
+            {
+                REQUIRE(std::includes(
+                    found.begin(), found.end(), expected.begin(), expected.end()));
+                for (const PolygonalCollider* collider : found)
+                    REQUIRE(collider->getBroadPhase() == broadPhase.get());
+            }
+        }
+    };
+
+    SECTION("Static colliders")
+    {
+        checkQueries();
+    }
+    SECTION("Moved and resized colliders")
+    {
+        for (std::size_t i = 0; i < colliders.size(); i += 2)
+            colliders[i]->move(UnitVector(position(generator), position(generator)));
+        for (std::size_t i = 1; i < colliders.size(); i += 4)
+            colliders[i]->get(2).move(UnitVector(size(generator), size(generator)));
+        // Grows a collider past the cells limit and brings it back
+        colliders[3]->get(2).move(UnitVector(25, 25));
+        checkQueries();
+        colliders[3]->get(2).move(UnitVector(-25, -25));
+        checkQueries();
+    }
+    SECTION("Removed colliders are no longer returned")
+    {
+        for (std::size_t i = 0; i < colliders.size(); i += 3)
+            colliders[i]->attachBroadPhase(nullptr);
+        REQUIRE(broadPhase->size() == colliders.size() - (colliders.size() + 2) / 3);
+        checkQueries();
+        // Destroyed colliders unregister themselves
+        const std::size_t indexed = broadPhase->size();
+        colliders.erase(colliders.begin() + 1);
+        REQUIRE(broadPhase->size() == indexed - 1);
+        checkQueries();
+        // Removed proxies are reused by the next insertions
+        colliders[0]->attachBroadPhase(broadPhase.get());
+        REQUIRE(broadPhase->size() == indexed);
+        checkQueries();
+    }
+}
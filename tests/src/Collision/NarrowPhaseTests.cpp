@@ -0,0 +1,127 @@
+#include <cmath>
+
+#include <catch/catch.hpp>
+
+#include <Collision/NarrowPhase.hpp>
+#include <Collision/PolygonalCollider.hpp>
+
+using namespace obe::Collision;
+using obe::Transform::UnitVector;
+
+namespace
+{
+    ConvexVertices makeRectangle(double minX, double minY, double maxX, double maxY)
+    {
+        ConvexVertices rectangle;
+        rectangle.push(minX, minY);
+        rectangle.push(maxX, minY);
+        rectangle.push(maxX, maxY);
+        rectangle.push(minX, maxY);
+        rectangle.computeNormals();
+        return rectangle;
+    }
+}
+
+TEST_CASE("Convexity of a polygon", "[obe.Collision.NarrowPhase.isConvex]")
+{
+    REQUIRE(isConvex({ 0, 1, 1, 0 }, { 0, 0, 1, 1 }));
+    // Collinear points on an edge
+    REQUIRE(isConvex({ 0, 1, 2, 2, 0 }, { 0, 0, 0, 1, 1 }));
+    // L-shape
+    REQUIRE_FALSE(isConvex({ 0, 2, 2, 1, 1, 0 }, { 0, 0, 1, 1, 2, 2 }));
+}
+
+TEST_CASE("Separating Axis Test between two convex polygons",
+    "[obe.Collision.NarrowPhase.testSeparatingAxes]")
+{
+    const ConvexVertices square = makeRectangle(0, 0, 1, 1);
+    Penetration penetration;
+
+    SECTION("Crossing edges overlap without any vertex inside the other shape")
+    {
+        const ConvexVertices horizontal = makeRectangle(0, 4, 10, 6);
+        const ConvexVertices vertical = makeRectangle(4, 0, 6, 10);
+        REQUIRE(testSeparatingAxes(horizontal, vertical, 0, 0, &penetration));
+        REQUIRE(penetration.colliding);
+        REQUIRE(penetration.depth == Approx(6));
+    }
+    SECTION("Touching shapes do not collide, separated shapes neither")
+    {
+        const ConvexVertices right = makeRectangle(1, 0, 2, 1);
+        REQUIRE_FALSE(testSeparatingAxes(square, right, 0, 0, &penetration));
+        REQUIRE_FALSE(penetration.colliding);
+        REQUIRE_FALSE(testSeparatingAxes(square, right, 1e-9, 0));
+        REQUIRE_FALSE(testSeparatingAxes(square, right, -0.5, 0));
+        REQUIRE(testSeparatingAxes(square, right, 0.5, 0));
+    }
+    SECTION("Depth and normal push the first shape out of the second one")
+    {
+        const ConvexVertices wall = makeRectangle(0.75, -1, 3, 2);
+        REQUIRE(testSeparatingAxes(square, wall, 0, 0, &penetration));
+        REQUIRE(penetration.depth == Approx(0.25));
+        REQUIRE(penetration.normal.x == Approx(-1));
+        REQUIRE(penetration.normal.y == Approx(0));
+        REQUIRE(testSeparatingAxes(square, wall, 0, -1.875, &penetration));
+        REQUIRE(penetration.depth == Approx(0.125));
+        REQUIRE(penetration.normal.x == Approx(0));
+        REQUIRE(penetration.normal.y == Approx(-1));
+    }
+}
+
+TEST_CASE("Time of impact between two convex polygons",
+    "[obe.Collision.NarrowPhase.castConvex]")
+{
+    const ConvexVertices square = makeRectangle(0, 0, 1, 1);
+    const ConvexVertices wall = makeRectangle(2, 0, 3, 1);
+    ConvexVertices buffer;
+    ImpactData impact;
+
+    SECTION("Moving polygons stop on the first hit surface")
+    {
+        REQUIRE(castConvex(square, wall, 2, 0, buffer, impact));
+        REQUIRE(impact.time == Approx(0.5));
+        REQUIRE(impact.normalX == Approx(-1));
+        REQUIRE(impact.normalY == Approx(0));
+        REQUIRE_FALSE(castConvex(square, wall, -2, 0, buffer, impact));
+        REQUIRE(impact.time == 1);
+    }
+    SECTION("A null displacement only hits touching polygons")
+    {
+        const ConvexVertices touching = makeRectangle(1, 0, 2, 1);
+        REQUIRE(castConvex(square, touching, 0, 0, buffer, impact));
+        REQUIRE(impact.time == 0);
+        REQUIRE(impact.normalX == Approx(-1));
+        REQUIRE(impact.normalY == Approx(0));
+        REQUIRE_FALSE(castConvex(square, wall, 0, 0, buffer, impact));
+        const ConvexVertices overlapping = makeRectangle(0.5, 0, 1.5, 1);
+        REQUIRE_FALSE(castConvex(square, overlapping, 0, 0, buffer, impact));
+        REQUIRE(impact.normalX == 0);
+        REQUIRE(impact.normalY == 0);
+    }
+}
+
+TEST_CASE("Concave colliders are tested through their convex hull",
+    "[obe.Collision.NarrowPhase]")
+{
+    UnitVector::Init(1000, 1000);
+    UnitVector::View = { 10, 10, 0, 0 };
+    PolygonalCollider corner("corner");
+    for (const auto& [x, y] : { std::make_pair(0.0, 0.0), std::make_pair(2.0, 0.0),
+             std::make_pair(2.0, 1.0), std::make_pair(1.0, 1.0),
+             std::make_pair(1.0, 2.0), std::make_pair(0.0, 2.0) })
+        corner.addPoint(UnitVector(x, y));
+    PolygonalCollider box("box");
+    box.addPoint(UnitVector(3, 3));
+    box.addPoint(UnitVector(3.5, 3));
+    box.addPoint(UnitVector(3.5, 3.5));
+    box.addPoint(UnitVector(3, 3.5));
+
+    // The notch of the corner belongs to its hull
+    REQUIRE(box.getPenetration(corner, UnitVector(-1.8, -1.8)).colliding);
+    REQUIRE_FALSE(box.getPenetration(corner, UnitVector(-0.9, -0.9)).colliding);
+    const CastResult result = box.castCollider(UnitVector(-2, -2));
+    REQUIRE(result.collider == &corner);
+    REQUIRE(result.timeOfImpact == Approx(0.75));
+    REQUIRE(result.normal.x == Approx(std::sqrt(0.5)));
+    REQUIRE(result.normal.y == Approx(std::sqrt(0.5)));
+}
@@ -0,0 +1,69 @@
+#include <catch/catch.hpp>
+
+#include <Collision/AABBTree.hpp>
+#include <Collision/PolygonalCollider.hpp>
+
+using namespace obe::Collision;
+using namespace obe::Transform;
+
+TEST_CASE("Swept queries between two squares",
+    "[obe.Collision.PolygonalCollider.castCollider]")
+{
+    UnitVector::Init(1000, 1000);
+    UnitVector::View = { 10, 10, 0, 0 };
+    PolygonalCollider moving("moving");
+    moving.addPoint(UnitVector(0, 0));
+    moving.addPoint(UnitVector(1, 0));
+    moving.addPoint(UnitVector(1, 1));
+    moving.addPoint(UnitVector(0, 1));
+    PolygonalCollider wall("wall");
+    wall.addPoint(UnitVector(2, 0));
+    wall.addPoint(UnitVector(3, 0));
+    wall.addPoint(UnitVector(3, 1));
+    wall.addPoint(UnitVector(2, 1));
+
+    SECTION("Head-on movement stops on the wall")
+    {
+        const CastResult result = moving.castCollider(UnitVector(2, 0));
+        REQUIRE(result.collider == &wall);
+        REQUIRE(result.timeOfImpact == Approx(0.5));
+        REQUIRE(result.normal.x == Approx(-1));
+        REQUIRE(result.normal.y == Approx(0));
+        REQUIRE(result.offset.to<Units::SceneUnits>().x == Approx(1));
+    }
+    SECTION("Diagonal movement slides along the wall")
+    {
+        const CastResult result = moving.castCollider(UnitVector(2, 0.5));
+        REQUIRE(result.collider == &wall);
+        REQUIRE(result.timeOfImpact == Approx(0.5));
+        const UnitVector slide = result.slide.to<Units::SceneUnits>();
+        REQUIRE(slide.x == Approx(0).margin(1e-9));
+        REQUIRE(slide.y == Approx(0.25));
+    }
+    SECTION("Movement away from the wall does not hit it")
+    {
+        const CastResult result = moving.castCollider(UnitVector(-2, 0));
+        REQUIRE(result.collider == nullptr);
+        REQUIRE(result.timeOfImpact == 1);
+    }
+    SECTION("Movement along a touching wall is not blocked")
+    {
+        moving.move(UnitVector(1, 0));
+        REQUIRE(moving.castCollider(UnitVector(0, 2)).collider == nullptr);
+        REQUIRE(moving.castCollider(UnitVector(0.5, 0)).timeOfImpact == 0);
+    }
+    SECTION("Colliders only hit the colliders of their BroadPhase")
+    {
+        AABBTree broadPhase;
+        moving.attachBroadPhase(&broadPhase);
+        REQUIRE(moving.getBroadPhase() == &broadPhase);
+        REQUIRE(moving.castCollider(UnitVector(2, 0)).collider == nullptr);
+        wall.attachBroadPhase(&broadPhase);
+        REQUIRE(moving.castCollider(UnitVector(2, 0)).collider == &wall);
+        wall.attachBroadPhase(nullptr);
+        REQUIRE(moving.castCollider(UnitVector(2, 0)).collider == nullptr);
+        moving.attachBroadPhase(nullptr);
+        REQUIRE(moving.getBroadPhase() == nullptr);
+        REQUIRE(moving.castCollider(UnitVector(2, 0)).collider == &wall);
+    }
+}
@@ -0,0 +1,131 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Config/CompiledFile.hpp>
+#include <Config/Exceptions.hpp>
+#include <Debug/Logger.hpp>
+#include <System/MountablePath.hpp>
+
+#include <fswrapper/fswrapper.hpp>
+#include <vili/node.hpp>
+
+using namespace obe::Config;
+
+namespace
+{
+    constexpr const char* ViliFile = "obe_compiled_file_test.map.vili";
+    constexpr const char* CompiledPath = "obe_compiled_file_test.map.vilc";
+
+    vili::node makeData()
+    {
+        vili::node data = vili::object {};
+        data["Meta"] = vili::object { { "name", "Test" }, { "empty", "" } };
+        data["Sprites"] = vili::object {};
+        for (int i = 0; i < 50; i++)
+        {
+            data["Sprites"]["sprite" + std::to_string(i)] = vili::object {
+                { "rect",
+                    vili::object { { "x", i * 0.5 }, { "y", -i * 1.25 },
+                        { "width", 1.0 }, { "height", 2.0 } } },
+                { "layer", vili::integer(i - 25) }, { "visible", i % 2 == 0 },
+                { "tags", vili::array { "tile", vili::integer(i), vili::array {} } }
+            };
+        }
+        data["Limits"]
+            = vili::array { vili::integer(9223372036854775807LL), -1e300, false };
+        data["Nothing"] = vili::node();
+        return data;
+    }
+
+    void writeFile(const std::string& path, const std::string& content)
+    {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << content;
+    }
+}
+
+TEST_CASE("Compiled files give back the vili tree they were compiled from",
+    "[obe.Config.CompiledFile]")
+{
+    if (!obe::Debug::Log)
+        obe::Debug::Log = std::make_shared<spdlog::logger>("Log");
+    REQUIRE(GetCompiledPath("Data/Maps/Level.map.vili") == "Data/Maps/Level.map.vilc");
+
+    const vili::node data = makeData();
+    const std::string compiled = CompileNode(data);
+    writeFile(CompiledPath, compiled);
+    {
+        const CompiledFile file(CompiledPath);
+        const CompiledNode root = file.getRoot();
+        REQUIRE(root.getType() == vili::node_type::object);
+        REQUIRE(root.size() == data.size());
+        REQUIRE(root.getChild(0).getKey() == "Meta");
+        REQUIRE(root.getChild(0).getChild(0).asString() == "Test");
+        REQUIRE(root.toNode().dump() == data.dump());
+    }
+
+    SECTION("Keys are stored once")
+    {
+        const std::string key = "visible";
+        std::size_t occurrences = 0;
+        for (std::size_t i = compiled.find(key); i != std::string::npos;
+             i = compiled.find(key, i + 1))
+            occurrences++;
+        REQUIRE(occurrences == 1);
+    }
+    SECTION("Corrupted files are rejected")
+    {
+        std::string corrupted = compiled;
+        corrupted[4] = static_cast<char>(CompiledFileVersion + 1);
+        writeFile(CompiledPath, corrupted);
+        REQUIRE_THROWS_AS(CompiledFile(CompiledPath), Exceptions::InvalidCompiledFile);
+        writeFile(CompiledPath, compiled.substr(0, compiled.size() - 1));
+        REQUIRE_THROWS_AS(CompiledFile(CompiledPath), Exceptions::InvalidCompiledFile);
+        // The first child of the root pointing to the root
+        corrupted = compiled;
+        corrupted[16 + 8] = 0;
+        writeFile(CompiledPath, corrupted);
+        REQUIRE_THROWS_AS(CompiledFile(CompiledPath), Exceptions::InvalidCompiledFile);
+    }
+    SECTION("Vili files are parsed when their compiled version can not be used")
+    {
+        writeFile(ViliFile, "Meta:\n    name: \"Parsed\"\n");
+        // Both files are written in the same instant, their times are set
+        const std::filesystem::file_time_type compiledTime
+            = std::filesystem::last_write_time(CompiledPath);
+        std::filesystem::last_write_time(
+            ViliFile, compiledTime - std::chrono::seconds(10));
+        REQUIRE(OpenCompiledFile(ViliFile) != nullptr);
+        REQUIRE(LoadFile(ViliFile)["Meta"]["name"].as<vili::string>() == "Test");
+        std::filesystem::last_write_time(
+            ViliFile, compiledTime + std::chrono::seconds(10));
+        REQUIRE(OpenCompiledFile(ViliFile) == nullptr);
+        REQUIRE(LoadFile(ViliFile)["Meta"]["name"].as<vili::string>() == "Parsed");
+        writeFile(CompiledPath, compiled.substr(0, 8));
+        std::filesystem::last_write_time(
+            CompiledPath, compiledTime + std::chrono::seconds(20));
+        REQUIRE(OpenCompiledFile(ViliFile) == nullptr);
+        REQUIRE(LoadFile(ViliFile)["Meta"]["name"].as<vili::string>() == "Parsed");
+        std::remove(CompiledPath);
+        REQUIRE(LoadFile(ViliFile)["Meta"]["name"].as<vili::string>() == "Parsed");
+        std::remove(ViliFile);
+    }
+    SECTION("Compiled files are found without their vili file")
+    {
+        using obe::System::MountablePath;
+        const std::vector<MountablePath> mounts
+            = { MountablePath(obe::System::MountablePathType::Path, ".") };
+        obe::System::Path path(mounts);
+        path.set(ViliFile);
+        const std::string found = FindFile(path);
+        REQUIRE(found == std::string("./") + ViliFile);
+        REQUIRE(LoadFile(found)["Meta"]["name"].as<vili::string>() == "Test");
+        std::remove(CompiledPath);
+        REQUIRE(FindFile(path).empty());
+    }
+    std::remove(CompiledPath);
+}
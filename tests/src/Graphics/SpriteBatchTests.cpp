@@ -0,0 +1,93 @@
+#include <catch/catch.hpp>
+
+#include <Graphics/Exceptions.hpp>
+#include <Graphics/SpriteBatch.hpp>
+
+using namespace obe::Graphics;
+
+namespace
+{
+    std::array<sf::Vertex, 4> makeQuad(float x, float y)
+    {
+        return { sf::Vertex(sf::Vector2f(x, y)), sf::Vertex(sf::Vector2f(x, y + 1)),
+            sf::Vertex(sf::Vector2f(x + 1, y)), sf::Vertex(sf::Vector2f(x + 1, y + 1)) };
+    }
+}
+
+TEST_CASE("Consecutive Sprites sharing a Texture are merged",
+    "[obe.Graphics.SpriteBatch]")
+{
+    const sf::Texture first;
+    const sf::Texture second;
+    SpriteBatch batch;
+
+    SECTION("An empty batch has no draw call")
+    {
+        REQUIRE(batch.getDrawCallCount() == 0);
+        REQUIRE(batch.getVertexCount() == 0);
+        REQUIRE(batch.getSpriteCount() == 0);
+    }
+    SECTION("Sprites with the same Texture share a single run")
+    {
+        for (int i = 0; i < 10; i++)
+            batch.add(makeQuad(i, 0), &first, nullptr);
+        REQUIRE(batch.getDrawCallCount() == 1);
+        REQUIRE(batch.getSpriteCount() == 10);
+        REQUIRE(batch.getVertexCount() == 60);
+        REQUIRE(batch.getRun(0).texture == &first);
+        REQUIRE(batch.getRun(0).spriteCount == 10);
+        REQUIRE(batch.getRun(0).vertices.getVertexCount() == 60);
+    }
+    SECTION("Drawing order is kept when Textures alternate")
+    {
+        batch.add(makeQuad(0, 0), &first, nullptr);
+        batch.add(makeQuad(1, 0), &first, nullptr);
+        batch.add(makeQuad(2, 0), &second, nullptr);
+        batch.add(makeQuad(3, 0), &first, nullptr);
+        REQUIRE(batch.getDrawCallCount() == 3);
+        REQUIRE(batch.getRun(0).texture == &first);
+        REQUIRE(batch.getRun(0).spriteCount == 2);
+        REQUIRE(batch.getRun(1).texture == &second);
+        REQUIRE(batch.getRun(1).spriteCount == 1);
+        REQUIRE(batch.getRun(2).texture == &first);
+        REQUIRE(batch.getRun(2).spriteCount == 1);
+        REQUIRE(batch.getRun(2).vertices[0].position.x == Approx(3));
+    }
+    SECTION("Sprites using another Shader start a new run")
+    {
+        Shader shader;
+        batch.add(makeQuad(0, 0), &first, nullptr);
+        batch.add(makeQuad(1, 0), &first, &shader);
+        batch.add(makeQuad(2, 0), &first, &shader);
+        REQUIRE(batch.getDrawCallCount() == 2);
+        REQUIRE(batch.getRun(1).shader == &shader);
+        REQUIRE(batch.getRun(1).spriteCount == 2);
+    }
+    SECTION("Quads are split in two triangles")
+    {
+        batch.add(makeQuad(5, 7), &first, nullptr);
+        const sf::VertexArray& vertices = batch.getRun(0).vertices;
+        REQUIRE(vertices.getPrimitiveType() == sf::Triangles);
+        const float expected[6][2]
+            = { { 5, 7 }, { 5, 8 }, { 6, 7 }, { 6, 7 }, { 5, 8 }, { 6, 8 } };
+        for (std::size_t i = 0; i < 6; i++)
+        {
+            REQUIRE(vertices[i].position.x == Approx(expected[i][0]));
+            REQUIRE(vertices[i].position.y == Approx(expected[i][1]));
+        }
+    }
+    SECTION("Clearing the batch resets the counters")
+    {
+        batch.add(makeQuad(0, 0), &first, nullptr);
+        batch.add(makeQuad(1, 0), &second, nullptr);
+        batch.clear();
+        REQUIRE(batch.getDrawCallCount() == 0);
+        REQUIRE(batch.getVertexCount() == 0);
+        // The runs of the previous batch are kept for their buffers only
+        REQUIRE_THROWS_AS(batch.getRun(0), Exceptions::SpriteBatchRunIndexOverflow);
+        batch.add(makeQuad(0, 0), &second, nullptr);
+        REQUIRE(batch.getDrawCallCount() == 1);
+        REQUIRE(batch.getRun(0).texture == &second);
+        REQUIRE(batch.getRun(0).vertices.getVertexCount() == 6);
+    }
+}
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteIndex.hpp>
+
+using namespace obe::Graphics;
+using obe::Transform::Referential;
+using obe::Transform::UnitVector;
+
+namespace
+{
+    // Reference implementation : transforms the corners of every Sprite like
+    // Sprite::draw does and keeps the ones overlapping the screen
+    std::vector<Sprite*> getVisibleSprites(
+        const std::vector<std::unique_ptr<Sprite>>& sprites, const UnitVector& camera)
+    {
+        std::vector<Sprite*> visible;
+        for (const auto& sprite : sprites)
+        {
+            const PositionTransformer transformer = sprite->getPositionTransformer();
+            double minX = 0, minY = 0, maxX = 0, maxY = 0;
+            bool first = true;
+            for (const Referential& ref : { Referential::TopLeft, Referential::TopRight,
+                     Referential::BottomLeft, Referential::BottomRight })
+            {
+                const UnitVector corner
+                    = transformer(sprite->getPosition(ref), camera, sprite->getLayer());
+                minX = first ? corner.x : std::min(minX, corner.x);
+                minY = first ? corner.y : std::min(minY, corner.y);
+                maxX = first ? corner.x : std::max(maxX, corner.x);
+                maxY = first ? corner.y : std::max(maxY, corner.y);
+                first = false;
+            }
+            if (maxX >= 0 && minX <= UnitVector::View.w && maxY >= 0
+                && minY <= UnitVector::View.h)
+                visible.push_back(sprite.get());
+        }
+        return visible;
+    }
+}
+
+TEST_CASE("SpriteIndex returns the same Sprites as the brute force culling",
+    "[obe.Graphics.SpriteIndex]")
+{
+    InitPositionTransformer();
+    UnitVector::Init(1000, 1000);
+    UnitVector::View = { 2, 2, 0, 0 };
+
+    std::mt19937 generator(13);
+    std::uniform_real_distribution<double> position(-20, 20);
+    std::uniform_real_distribution<double> size(0.05, 1.5);
+    std::uniform_real_distribution<double> angle(0, 360);
+    std::uniform_int_distribution<int> layer(1, 5);
+    std::uniform_int_distribution<int> transformer(0, 2);
+    const std::vector<std::string> transformers = { "Camera", "Parallax", "Position" };
+
+    SpriteIndex index;
+    std::vector<std::unique_ptr<Sprite>> sprites;
+    for (int i = 0; i < 400; i++)
+    {
+        auto sprite = std::make_unique<Sprite>("sprite" + std::to_string(i));
+        sprite->setPosition(UnitVector(position(generator), position(generator)));
+        sprite->setSize(UnitVector(size(generator), size(generator)));
+        if (i % 3 == 0)
+            sprite->setRotation(angle(generator));
+        sprite->setLayer(layer(generator));
+        sprite->setPositionTransformer(PositionTransformer(
+            transformers[transformer(generator)], transformers[transformer(generator)]));
+        sprite->attachSpriteIndex(&index);
+        index.setDrawOrder(sprite->getSpriteIndexProxy(), sprites.size());
+        sprites.push_back(std::move(sprite));
+    }
+    // A huge background Sprite bypassing the grid cells
+    sprites.front()->setSize(UnitVector(30, 30));
+    REQUIRE(index.size() == sprites.size());
+
+    const auto checkCameras = [&]() {
+        for (int i = 0; i < 50; i++)
+        {
+            const UnitVector camera(position(generator), position(generator));
+            std::vector<Sprite*> found;
+            const UnitVector viewSize(UnitVector::View.w, UnitVector::View.h);
+            index.query(camera, viewSize, found);
+            REQUIRE(found == getVisibleSprites(sprites, camera));
+        }
+    };
+
+    SECTION("Static Sprites")
+    {
+        checkCameras();
+    }
+    SECTION("Moved, resized and regrouped Sprites")
+    {
+        for (std::size_t i = 0; i < sprites.size(); i += 2)
+        {
+            sprites[i]->move(UnitVector(position(generator), position(generator)));
+            sprites[i]->scale(UnitVector(2, 0.5));
+        }
+        for (std::size_t i = 1; i < sprites.size(); i += 4)
+        {
+            sprites[i]->setLayer(layer(generator));
+            sprites[i]->setPositionTransformer(PositionTransformer("Parallax", "Camera"));
+        }
+        checkCameras();
+    }
+    SECTION("Removed Sprites are no longer returned")
+    {
+        for (std::size_t i = 0; i < sprites.size(); i += 3)
+            sprites[i]->attachSpriteIndex(nullptr);
+        REQUIRE(index.size() == sprites.size() - (sprites.size() + 2) / 3);
+        for (std::size_t i = 0; i < sprites.size(); i += 3)
+            sprites[i]->setPosition(UnitVector(0, 0));
+        std::vector<Sprite*> found;
+        index.query(UnitVector(0, 0), UnitVector(40, 40), found);
+        for (std::size_t i = 0; i < sprites.size(); i += 3)
+        {
+            const Sprite* removed = sprites[i].get();
+            REQUIRE(std::find(found.begin(), found.end(), removed) == found.end());
+        }
+        // Destroyed Sprites unregister themselves
+        const std::size_t indexed = index.size();
+        sprites.erase(sprites.begin() + 1);
+        REQUIRE(index.size() == indexed - 1);
+    }
+    SECTION("Sprites with a custom CoordinateTransformer are never culled")
+    {
+        Transformers["Fixed"] = [](double pos, double, int) { return pos; };
+        sprites[1]->setPositionTransformer(PositionTransformer("Fixed", "Camera"));
+        sprites[1]->setPosition(UnitVector(1000, 1000));
+        std::vector<Sprite*> found;
+        index.query(UnitVector(0, 0), UnitVector(1, 1), found);
+        REQUIRE(std::find(found.begin(), found.end(), sprites[1].get()) != found.end());
+        Transformers.erase("Fixed");
+    }
+}
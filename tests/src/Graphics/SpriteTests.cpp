@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Graphics/Sprite.hpp>
+
+using namespace obe::Graphics;
+using obe::Transform::Referential;
+using obe::Transform::UnitVector;
+using obe::Transform::Units;
+
+namespace
+{
+    // Checks the batched quad of a Sprite against the corners given by Rect and
+    // transformed through the CoordinateTransformers
+    void checkQuad(const SpriteBatch& batch, std::size_t index, const Sprite& sprite,
+        const UnitVector& camera)
+    {
+        const std::array<Referential, 4> corners = { Referential::TopLeft,
+            Referential::BottomLeft, Referential::TopRight, Referential::BottomRight };
+        const std::array<std::size_t, 4> vertices = { 0, 1, 2, 5 };
+        const PositionTransformer transformer = sprite.getPositionTransformer();
+        for (std::size_t i = 0; i < corners.size(); i++)
+        {
+            const UnitVector expected
+                = transformer(sprite.getPosition(corners[i]), camera, sprite.getLayer())
+                      .to<Units::ScenePixels>();
+            const sf::Vertex& vertex = batch.getRun(0).vertices[index * 6 + vertices[i]];
+            REQUIRE(vertex.position.x == Approx(expected.x).margin(1e-2));
+            REQUIRE(vertex.position.y == Approx(expected.y).margin(1e-2));
+        }
+    }
+}
+
+TEST_CASE("Sprite quads follow the changes of their Rect", "[obe.Graphics.Sprite]")
+{
+    InitPositionTransformer();
+    Transformers["Scaled"]
+        = [](double position, double camera, int layer) { return position * 2 - camera; };
+    UnitVector::Init(1000, 800);
+    UnitVector::View = { 2, 1.6, 0, 0 };
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> position(-10, 10);
+    std::uniform_real_distribution<double> size(0.05, 2);
+    std::uniform_real_distribution<double> angle(0, 360);
+    std::uniform_int_distribution<int> layer(1, 5);
+    const std::vector<std::string> transformers
+        = { "Camera", "Parallax", "Position", "Scaled" };
+    std::uniform_int_distribution<std::size_t> transformer(0, transformers.size() - 1);
+
+    std::vector<std::unique_ptr<Sprite>> sprites;
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        auto sprite = std::make_unique<Sprite>("sprite" + std::to_string(i));
+        sprite->setPosition(UnitVector(position(generator), position(generator)));
+        sprite->setSize(UnitVector(size(generator), size(generator)));
+        sprite->setRotation(angle(generator));
+        sprite->setLayer(layer(generator));
+        sprite->setPositionTransformer(PositionTransformer(
+            transformers[transformer(generator)], transformers[transformer(generator)]));
+        sprites.push_back(std::move(sprite));
+    }
+
+    SpriteBatch batch;
+    const UnitVector camera = UnitVector(position(generator), position(generator))
+                                  .to<Units::ScenePixels>();
+    const auto drawAll = [&]() {
+        batch.clear();
+        for (const auto& sprite : sprites)
+            sprite->addToBatch(batch, camera, 1);
+        REQUIRE(batch.getSpriteCount() == sprites.size());
+        for (std::size_t i = 0; i < sprites.size(); i++)
+            checkQuad(batch, i, *sprites[i], camera);
+
+        // Sorted by layer like the Scene does so runs of Sprites share a
+        // transformation
+        std::vector<Sprite*> sorted;
+        for (const auto& sprite : sprites)
+            sorted.push_back(sprite.get());
+        std::stable_sort(sorted.begin(), sorted.end(), [](Sprite* first, Sprite* second) {
+            return first->getLayer() < second->getLayer();
+        });
+        batch.clear();
+        batch.addSprites(sorted, camera);
+        REQUIRE(batch.getSpriteCount() == sorted.size());
+        for (std::size_t i = 0; i < sorted.size(); i++)
+            checkQuad(batch, i, *sorted[i], camera);
+    };
+    drawAll();
+
+    SECTION("Moved Sprites")
+    {
+        for (const auto& sprite : sprites)
+            sprite->move(UnitVector(position(generator), position(generator)));
+        drawAll();
+    }
+    SECTION("Resized Sprites")
+    {
+        for (const auto& sprite : sprites)
+            sprite->setSize(UnitVector(size(generator), size(generator)),
+                Referential::Center);
+        drawAll();
+    }
+    SECTION("Rotated Sprites")
+    {
+        for (const auto& sprite : sprites)
+            sprite->rotate(angle(generator));
+        drawAll();
+    }
+    SECTION("Sprites placed from another Referential")
+    {
+        for (const auto& sprite : sprites)
+        {
+            sprite->setPosition(
+                UnitVector(position(generator) * 100, position(generator) * 100,
+                    Units::ScenePixels),
+                Referential::BottomRight);
+        }
+        drawAll();
+    }
+    Transformers.erase("Scaled");
+}
+
+TEST_CASE("PositionTransformer kernels match their CoordinateTransformer",
+    "[obe.Graphics.PositionTransformer]")
+{
+    InitPositionTransformer();
+    Transformers["Scaled"]
+        = [](double position, double camera, int layer) { return position * 2 - camera; };
+    UnitVector::Init(1280, 720);
+    UnitVector::View = { 3.5, 2, 0, 0 };
+
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> coordinate(-50, 50);
+    std::vector<double> x(1000);
+    std::vector<double> y(1000);
+    for (std::size_t i = 0; i < x.size(); i++)
+    {
+        x[i] = coordinate(generator);
+        y[i] = coordinate(generator);
+    }
+    const UnitVector camera = UnitVector(coordinate(generator), coordinate(generator))
+                                  .to<Units::ScenePixels>();
+
+    const std::vector<std::string> transformers
+        = { "Camera", "Parallax", "Position", "Scaled" };
+    std::vector<float> transformedX(x.size());
+    std::vector<float> transformedY(y.size());
+    for (const std::string& xTransformer : transformers)
+    {
+        for (const std::string& yTransformer : transformers)
+        {
+            const PositionTransformer transformer(xTransformer, yTransformer);
+            REQUIRE(transformer.hasSameKernels(transformer)
+                == (xTransformer != "Scaled" && yTransformer != "Scaled"));
+            for (int layer = 1; layer <= 3; layer++)
+            {
+                transformer.transform(x.data(), y.data(), transformedX.data(),
+                    transformedY.data(), x.size(), camera, layer);
+                const UnitVector localCamera = camera.to<Units::SceneUnits>();
+                const CoordinateTransformer& transformX = Transformers[xTransformer];
+                const CoordinateTransformer& transformY = Transformers[yTransformer];
+                for (std::size_t i = 0; i < x.size(); i++)
+                {
+                    const UnitVector expected
+                        = UnitVector(transformX(x[i], localCamera.x, layer),
+                            transformY(y[i], localCamera.y, layer))
+                              .to<Units::ScenePixels>();
+                    REQUIRE(transformedX[i] == Approx(expected.x).margin(1e-2));
+                    REQUIRE(transformedY[i] == Approx(expected.y).margin(1e-2));
+                }
+            }
+        }
+    }
+    Transformers.erase("Scaled");
+}
+
+TEST_CASE("PositionTransformer kernels are only used for stock CoordinateTransformers",
+    "[obe.Graphics.PositionTransformer]")
+{
+    InitPositionTransformer();
+    const UnitVector position(4, 2);
+    const UnitVector camera(1, 1);
+
+    PositionTransformer transformer("Camera", "Parallax");
+    REQUIRE(transformer.getXKernel() == TransformerKernel::Camera);
+    REQUIRE(transformer.getYKernel() == TransformerKernel::Parallax);
+    // Reading a CoordinateTransformer keeps the kernel
+    REQUIRE(transformer.getXTransformer()(4, 1, 1) == 3);
+    REQUIRE(transformer.getXKernel() == TransformerKernel::Camera);
+    transformer.setYTransformer(Position);
+    REQUIRE(transformer.getYKernel() == TransformerKernel::Custom);
+    REQUIRE(transformer(position, camera, 2).y == Approx(2));
+
+    // A replaced built-in CoordinateTransformer is not applied by its kernel
+    Transformers["Camera"] = Position;
+    const PositionTransformer replaced("Camera", "Camera");
+    REQUIRE(replaced.getXKernel() == TransformerKernel::Custom);
+    REQUIRE(replaced(position, camera, 1).x == Approx(4));
+    InitPositionTransformer();
+    REQUIRE(PositionTransformer().getXKernel() == TransformerKernel::Camera);
+}
@@ -0,0 +1,59 @@
+#include <random>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Graphics/TextureAtlas.hpp>
+
+using namespace obe::Graphics;
+
+TEST_CASE("Rectangles are packed without overlapping", "[obe.Graphics.SkylinePacker]")
+{
+    SkylinePacker packer(256, 256);
+
+    SECTION("Rectangles larger than the area are rejected")
+    {
+        REQUIRE_FALSE(packer.insert(257, 10));
+        REQUIRE_FALSE(packer.insert(10, 257));
+        REQUIRE_FALSE(packer.insert(0, 10));
+    }
+    SECTION("Identical tiles fill the whole area")
+    {
+        for (int i = 0; i < 16; i++)
+            REQUIRE(packer.insert(64, 64));
+        REQUIRE(packer.getOccupancy() == Approx(1));
+        REQUIRE_FALSE(packer.insert(1, 1));
+        packer.clear();
+        REQUIRE(packer.getOccupancy() == Approx(0));
+        REQUIRE(packer.insert(256, 256));
+    }
+    SECTION("Random rectangles stay inside the area and never overlap")
+    {
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> size(1, 48);
+        std::vector<sf::IntRect> packed;
+        for (int i = 0; i < 200; i++)
+        {
+            if (const auto rect = packer.insert(size(generator), size(generator)))
+                packed.push_back(*rect);
+        }
+        REQUIRE(packed.size() > 50);
+        for (std::size_t i = 0; i < packed.size(); i++)
+        {
+            const sf::IntRect& rect = packed[i];
+            REQUIRE(rect.left >= 0);
+            REQUIRE(rect.top >= 0);
+            REQUIRE(rect.left + rect.width <= 256);
+            REQUIRE(rect.top + rect.height <= 256);
+            for (std::size_t j = i + 1; j < packed.size(); j++)
+            {
+                const sf::IntRect& other = packed[j];
+                const bool separated = rect.left + rect.width <= other.left
+                    || other.left + other.width <= rect.left
+                    || rect.top + rect.height <= other.top
+                    || other.top + other.height <= rect.top;
+                REQUIRE(separated);
+            }
+        }
+    }
+}
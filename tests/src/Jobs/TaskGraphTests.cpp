@@ -0,0 +1,119 @@
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Jobs/Exceptions.hpp>
+#include <Jobs/TaskGraph.hpp>
+
+using namespace obe::Jobs;
+
+TEST_CASE("Tasks start once their dependencies are done", "[obe.Jobs.TaskGraph]")
+{
+    ThreadPool pool(GENERATE(0, 1, 4));
+    TaskGraph graph;
+    std::atomic<std::size_t> clock = 0;
+
+    SECTION("Random graph")
+    {
+        // Each task records when it ran, dependencies always go from a lower
+        // id to a higher one so the graph has no cycle
+        constexpr std::size_t TasksAmount = 500;
+        std::vector<std::size_t> startedAt(TasksAmount);
+        std::vector<std::size_t> endedAt(TasksAmount);
+        for (std::size_t i = 0; i < TasksAmount; i++)
+        {
+            graph.add([i, &clock, &startedAt, &endedAt]() {
+                startedAt[i] = clock++;
+                endedAt[i] = clock++;
+            });
+        }
+        std::mt19937 generator(42);
+        std::vector<std::pair<std::size_t, std::size_t>> dependencies;
+        for (std::size_t i = 1; i < TasksAmount; i++)
+        {
+            std::uniform_int_distribution<std::size_t> before(0, i - 1);
+            for (int j = 0; j < 3; j++)
+            {
+                const std::size_t task = before(generator);
+                graph.precede(task, i);
+                dependencies.emplace_back(task, i);
+            }
+        }
+        // A TaskGraph can be run again
+        for (int run = 0; run < 2; run++)
+        {
+            graph.run(pool);
+            for (const auto& [task, successor] : dependencies)
+                REQUIRE(endedAt[task] < startedAt[successor]);
+        }
+    }
+    SECTION("Diamond")
+    {
+        std::vector<std::size_t> order(4);
+        const auto record = [&order, &clock](std::size_t task) {
+            return [task, &order, &clock]() { order[task] = clock++; };
+        };
+        const TaskGraph::TaskId load = graph.add(record(0));
+        const TaskGraph::TaskId left = graph.add(record(1));
+        const TaskGraph::TaskId right = graph.add(record(2));
+        const TaskGraph::TaskId merge = graph.add(record(3));
+        graph.precede(load, left);
+        graph.precede(load, right);
+        graph.precede(left, merge);
+        graph.precede(right, merge);
+        graph.run(pool);
+        REQUIRE(order[0] == 0);
+        REQUIRE(order[3] == 3);
+    }
+}
+
+TEST_CASE("Invalid TaskGraphs are rejected", "[obe.Jobs.TaskGraph]")
+{
+    ThreadPool pool(2);
+    TaskGraph graph;
+    bool executed = false;
+    const TaskGraph::TaskId first = graph.add([&executed]() { executed = true; });
+    const TaskGraph::TaskId second = graph.add([&executed]() { executed = true; });
+    REQUIRE_THROWS_AS(graph.precede(first, 2), Exceptions::UnknownTask);
+
+    graph.precede(first, second);
+    graph.precede(second, first);
+    REQUIRE_THROWS_AS(graph.run(pool), Exceptions::CyclicTaskGraph);
+    REQUIRE_FALSE(executed);
+}
+
+TEST_CASE("A failing task skips the tasks depending on it", "[obe.Jobs.TaskGraph]")
+{
+    ThreadPool pool(2);
+    TaskGraph graph;
+    bool executed = false;
+    const TaskGraph::TaskId failing
+        = graph.add([]() { throw std::runtime_error("task failed"); });
+    graph.precede(failing, graph.add([&executed]() { executed = true; }));
+    REQUIRE_THROWS_AS(graph.run(pool), std::runtime_error);
+    REQUIRE_FALSE(executed);
+}
+
+TEST_CASE("Tasks continue on the main thread", "[obe.Jobs.ThreadPool]")
+{
+    ThreadPool pool(2);
+    std::atomic<int> computed = 0;
+    std::vector<int> results;
+    TaskGraph graph;
+    for (int i = 0; i < 10; i++)
+    {
+        graph.add([i, &pool, &computed, &results]() {
+            computed++;
+            pool.postToMainThread([i, &results]() { results.push_back(i); });
+        });
+    }
+    graph.run(pool);
+    REQUIRE(computed == 10);
+    REQUIRE(results.empty());
+    REQUIRE(pool.runMainThreadTasks() == 10);
+    REQUIRE(results.size() == 10);
+    REQUIRE(pool.runMainThreadTasks() == 0);
+}
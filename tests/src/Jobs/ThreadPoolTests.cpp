@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Debug/Logger.hpp>
+#include <Jobs/ThreadPool.hpp>
+
+using obe::Jobs::ThreadPool;
+
+TEST_CASE("parallelFor processes each index once", "[obe.Jobs.ThreadPool]")
+{
+    ThreadPool pool(GENERATE(0, 1, 4));
+    std::vector<int> visits(10007, 0);
+    pool.parallelFor(visits.size(), 64, [&visits](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++)
+            visits[i]++;
+    });
+    REQUIRE(std::all_of(
+        visits.begin(), visits.end(), [](int visit) { return visit == 1; }));
+
+    SECTION("Nested loops from the workers")
+    {
+        std::atomic<std::size_t> total = 0;
+        pool.parallelFor(16, 1, [&pool, &total](std::size_t, std::size_t) {
+            pool.parallelFor(100, 10, [&total](std::size_t begin, std::size_t end) {
+                total += end - begin;
+            });
+        });
+        REQUIRE(total == 1600);
+    }
+}
+
+TEST_CASE("parallelFor rethrows the exceptions of its chunks", "[obe.Jobs.ThreadPool]")
+{
+    ThreadPool pool(3);
+    std::atomic<std::size_t> processed = 0;
+    REQUIRE_THROWS_AS(pool.parallelFor(1000, 1,
+                          [&processed](std::size_t begin, std::size_t) {
+                              if (begin == 10)
+                                  throw std::runtime_error("chunk failed");
+                              processed++;
+                          }),
+        std::runtime_error);
+    REQUIRE(processed < 1000);
+
+    // The pool is still usable afterwards
+    processed = 0;
+    pool.parallelFor(
+        1000, 1, [&processed](std::size_t, std::size_t) { processed++; });
+    REQUIRE(processed == 1000);
+}
+
+TEST_CASE("Submitted tasks all run before the pool is destroyed", "[obe.Jobs.ThreadPool]")
+{
+    std::atomic<int> done = 0;
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 1000; i++)
+            pool.submit([&done]() { done++; });
+    }
+    REQUIRE(done == 1000);
+}
+
+TEST_CASE("Exceptions escaping submitted tasks do not stop the workers",
+    "[obe.Jobs.ThreadPool]")
+{
+    if (!obe::Debug::Log)
+        obe::Debug::Log = std::make_shared<spdlog::logger>("Log");
+    std::atomic<int> done = 0;
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 100; i++)
+        {
+            pool.submit([]() { throw std::runtime_error("task failed"); });
+            pool.submit([]() { throw 0; });
+            pool.submit([&done]() { done++; });
+        }
+    }
+    REQUIRE(done == 100);
+}
@@ -0,0 +1,110 @@
+#include <catch/catch.hpp>
+
+#include <Time/FramePacer.hpp>
+
+using namespace obe::Time;
+
+namespace
+{
+    constexpr TimeUnit SpinStep = 10 * microseconds;
+
+    // Fake clock only moving when the FramePacer sleeps (or when a frame works),
+    // sleeps overshoot like the ones of the system scheduler
+    struct FakeClock
+    {
+        TimeUnit time = 10;
+        TimeUnit oversleep = 0;
+        std::size_t sleeps = 0;
+
+        FramePacer makePacer()
+        {
+            return FramePacer([this]() { return time; },
+                [this](TimeUnit duration) {
+                    if (duration > 0)
+                    {
+                        time += duration + oversleep;
+                        sleeps++;
+                    }
+                    else
+                        time += SpinStep;
+                });
+        }
+    };
+}
+
+TEST_CASE("Frames start at their deadline", "[obe.Time.FramePacer]")
+{
+    FakeClock clock;
+    clock.oversleep = 1.5 * milliseconds;
+    FramePacer pacer = clock.makePacer();
+    const TimeUnit interval = 1.0 / 144.0;
+    pacer.setInterval(interval);
+
+    SECTION("Sleeps overshooting less than the spin threshold")
+    {
+        TimeUnit deadline = pacer.waitForNextFrame() + interval;
+        for (int frame = 0; frame < 300; frame++)
+        {
+            // Frames doing some work for a varying amount of time
+            clock.time += (frame % 5) * milliseconds;
+            REQUIRE(pacer.getNextDeadline() == Approx(deadline));
+            const TimeUnit start = pacer.waitForNextFrame();
+            REQUIRE(start >= deadline);
+            REQUIRE(start - deadline <= SpinStep);
+            deadline += interval;
+        }
+        const FrameStatistics statistics = pacer.getStatistics();
+        REQUIRE(statistics.frames == 240);
+        REQUIRE(statistics.mean == Approx(interval).margin(SpinStep));
+        REQUIRE(statistics.p99 - interval <= SpinStep);
+        REQUIRE(statistics.jitter <= SpinStep);
+        REQUIRE(statistics.lateness <= SpinStep);
+    }
+    SECTION("Sleeping without spinning misses the deadlines")
+    {
+        pacer.setSpinThreshold(0);
+        pacer.waitForNextFrame();
+        for (int frame = 0; frame < 100; frame++)
+            pacer.waitForNextFrame();
+        REQUIRE(pacer.getStatistics().lateness
+            == Approx(clock.oversleep).margin(SpinStep));
+    }
+    SECTION("Idle task runs before sleeping")
+    {
+        pacer.waitForNextFrame();
+        TimeUnit available = 0;
+        pacer.waitForNextFrame([&](TimeUnit time) {
+            available = time;
+            clock.time += time / 2;
+        });
+        REQUIRE(available
+            == Approx(interval - pacer.getSpinThreshold()).margin(SpinStep));
+        REQUIRE(clock.sleeps == 1);
+    }
+}
+
+TEST_CASE("Late frames do not make the next frames rush", "[obe.Time.FramePacer]")
+{
+    FakeClock clock;
+    FramePacer pacer = clock.makePacer();
+    const TimeUnit interval = 1.0 / 60.0;
+    pacer.setInterval(interval);
+    pacer.waitForNextFrame();
+
+    // A frame taking 3 intervals: the next one starts right away, the
+    // following ones are paced again from it
+    clock.time += 3 * interval;
+    const TimeUnit lateStart = pacer.waitForNextFrame();
+    REQUIRE(pacer.getNextDeadline() == Approx(lateStart + interval));
+    REQUIRE(pacer.waitForNextFrame() == Approx(lateStart + interval).margin(SpinStep));
+
+    SECTION("Frames are not paced without interval")
+    {
+        pacer.setInterval(0);
+        const std::size_t sleeps = clock.sleeps;
+        const TimeUnit start = clock.time;
+        REQUIRE(pacer.waitForNextFrame() == start);
+        REQUIRE(pacer.waitForNextFrame() == start);
+        REQUIRE(clock.sleeps == sleeps);
+    }
+}
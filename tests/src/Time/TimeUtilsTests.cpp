@@ -0,0 +1,36 @@
+#include <catch/catch.hpp>
+
+#include <Time/Chronometer.hpp>
+#include <Time/TimeUtils.hpp>
+
+using namespace obe::Time;
+
+TEST_CASE("The frame time only changes when a frame is stamped", "[obe.Time.TimeUtils]")
+{
+    const TimeUnit frameTime = advanceFrame();
+    REQUIRE(now() == frameTime);
+    const TimeUnit preciseTime = precise();
+    while (precise() == preciseTime)
+        continue;
+    REQUIRE(now() == frameTime);
+    REQUIRE(advanceFrame() > frameTime);
+}
+
+TEST_CASE("The engine clock is deterministic in fixed step mode", "[obe.Time.TimeUtils]")
+{
+    setFixedStep(0.25);
+    REQUIRE(getFixedStep() == 0.25);
+    const TimeUnit start = advanceFrame();
+    Chronometer chronometer;
+    chronometer.start();
+    for (int i = 0; i < 4; i++)
+        advanceFrame();
+    REQUIRE(now() - start == Approx(1));
+    REQUIRE(chronometer.getTime() == Approx(1));
+
+    // Going back to the real time does not make the clock jump
+    setFixedStep(0);
+    const TimeUnit fixedTime = now();
+    REQUIRE(advanceFrame() >= fixedTime);
+    REQUIRE(now() - fixedTime < 0.25);
+}
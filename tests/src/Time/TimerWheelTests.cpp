@@ -0,0 +1,76 @@
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Time/TimerWheel.hpp>
+
+using obe::Time::TimerWheel;
+
+TEST_CASE("Timers are due at their deadline", "[obe.Time.TimerWheel]")
+{
+    TimerWheel wheel;
+    std::vector<TimerWheel::TimerId> due;
+
+    SECTION("Timers of every level")
+    {
+        // One deadline in each level of the wheel and one past all of them
+        const std::vector<TimerWheel::Tick> deadlines
+            = { 1, 63, 64, 65, 4095, 4096, 300000, 16777216, 20000000 };
+        for (std::size_t i = 0; i < deadlines.size(); i++)
+            wheel.insert(static_cast<TimerWheel::TimerId>(i), deadlines[i]);
+        REQUIRE(wheel.size() == deadlines.size());
+        for (std::size_t i = 0; i < deadlines.size(); i++)
+        {
+            wheel.advance(deadlines[i] - 1, due);
+            REQUIRE(due.empty());
+            wheel.advance(deadlines[i], due);
+            REQUIRE(due == std::vector<TimerWheel::TimerId> { TimerWheel::TimerId(i) });
+            due.clear();
+        }
+        REQUIRE(wheel.size() == 0);
+    }
+    SECTION("Advancing over several deadlines at once")
+    {
+        wheel.insert(0, 5000);
+        wheel.insert(1, 10);
+        wheel.insert(2, 70);
+        wheel.insert(3, 10);
+        wheel.advance(6000, due);
+        REQUIRE(due == std::vector<TimerWheel::TimerId> { 1, 3, 2, 0 });
+        REQUIRE(wheel.getCurrentTick() == 6000);
+    }
+    SECTION("Timers inserted after the wheel moved")
+    {
+        wheel.advance(1000, due);
+        wheel.insert(0, 1100);
+        wheel.insert(1, 1000);
+        wheel.advance(1000, due);
+        REQUIRE(due == std::vector<TimerWheel::TimerId> { 1 });
+        wheel.advance(1099, due);
+        REQUIRE(due.size() == 1);
+        wheel.advance(1100, due);
+        REQUIRE(due == std::vector<TimerWheel::TimerId> { 1, 0 });
+    }
+}
+
+TEST_CASE("Timers can be removed and moved", "[obe.Time.TimerWheel]")
+{
+    TimerWheel wheel;
+    std::vector<TimerWheel::TimerId> due;
+    wheel.insert(0, 100);
+    wheel.insert(1, 100);
+    wheel.insert(2, 100);
+    wheel.remove(1);
+    wheel.remove(1);
+    REQUIRE_FALSE(wheel.contains(1));
+    wheel.insert(2, 200);
+    REQUIRE(wheel.size() == 2);
+
+    wheel.advance(150, due);
+    REQUIRE(due == std::vector<TimerWheel::TimerId> { 0 });
+    REQUIRE_FALSE(wheel.contains(0));
+    REQUIRE(wheel.contains(2));
+    wheel.advance(200, due);
+    REQUIRE(due == std::vector<TimerWheel::TimerId> { 0, 2 });
+    REQUIRE(wheel.size() == 0);
+}
@@ -0,0 +1,85 @@
+#include <catch/catch.hpp>
+
+#include <Transform/Polygon.hpp>
+
+using namespace obe::Transform;
+
+namespace
+{
+    class ChangesCounter : public Polygon
+    {
+    protected:
+        void onPointsChanged() override
+        {
+            changes++;
+        }
+
+    public:
+        int changes = 0;
+    };
+}
+
+TEST_CASE("Cached vertices of a Polygon", "[obe.Transform.Polygon.getVertices]")
+{
+    UnitVector::Init(1000, 1000);
+    UnitVector::View = { 10, 10, 0, 0 };
+    Polygon square;
+    square.addPoint(UnitVector(0, 0));
+    square.addPoint(UnitVector(1, 0));
+    square.addPoint(UnitVector(1, 1));
+    square.addPoint(UnitVector(0, 1));
+
+    SECTION("Vertices are stored in ScenePixels")
+    {
+        const PolygonVertices& vertices = square.getVertices();
+        REQUIRE(vertices.x.size() == 4);
+        REQUIRE(vertices.x[2] == Approx(100));
+        REQUIRE(vertices.y[2] == Approx(100));
+        REQUIRE(vertices.maxX == Approx(100));
+        REQUIRE(vertices.centroidX == Approx(50));
+        REQUIRE(vertices.centroidY == Approx(50));
+    }
+    SECTION("Vertices are only rebuilt when needed")
+    {
+        const std::size_t revision = square.getVertices().revision;
+        REQUIRE(square.getVertices().revision == revision);
+        square.move(UnitVector(1, 0));
+        REQUIRE(square.getVertices().revision == revision + 1);
+        REQUIRE(square.getVertices().minX == Approx(100));
+        REQUIRE(square.getCentroid().x == Approx(1.5));
+    }
+    SECTION("Points moved one by one update the vertices")
+    {
+        const std::size_t revision = square.getVertices().revision;
+        square.get(2).set(3, 1);
+        REQUIRE(square.getVertices().revision == revision + 1);
+        REQUIRE(square.getVertices().maxX == Approx(300));
+        square.get(2).set(UnitVector(1, 4));
+        REQUIRE(square.getVertices().maxX == Approx(100));
+        REQUIRE(square.getVertices().maxY == Approx(400));
+        square.get(0).move(UnitVector(-2, 0));
+        REQUIRE(square.getVertices().minX == Approx(-200));
+        REQUIRE(square.getVertices().revision == revision + 3);
+    }
+    SECTION("Rotating a Polygon notifies it once")
+    {
+        ChangesCounter counted;
+        counted.addPoint(UnitVector(0, 0));
+        counted.addPoint(UnitVector(1, 0));
+        counted.addPoint(UnitVector(1, 1));
+        counted.changes = 0;
+        counted.rotate(90, UnitVector(0, 0));
+        REQUIRE(counted.changes == 1);
+        REQUIRE(counted.get(1).x == Approx(0).margin(1e-9));
+        REQUIRE(counted.get(1).y == Approx(-1));
+        REQUIRE(counted.getVertices().minY == Approx(-100));
+    }
+    SECTION("Vertices follow the View scale")
+    {
+        square.getVertices();
+        UnitVector::View = { 20, 20, 0, 0 };
+        REQUIRE(square.getVertices().maxX == Approx(50));
+        REQUIRE(square.findClosestPoint(UnitVector(0.9, 0.9)).index == 2);
+        UnitVector::View = { 10, 10, 0, 0 };
+    }
+}
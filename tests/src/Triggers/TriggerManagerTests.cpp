@@ -0,0 +1,294 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch/catch.hpp>
+#include <sol/sol.hpp>
+
+#include <Debug/Logger.hpp>
+#include <Triggers/TriggerManager.hpp>
+
+using namespace obe::Triggers;
+
+namespace
+{
+    // Every execution of the Triggers is appended to the "log" table
+    constexpr const char* ObjectScript = R"(
+        log = {};
+        function Event.Network.DataReceived(content)
+            table.insert(log, "DataReceived:" .. tostring(content));
+        end
+        function Event.Network.Connected(client)
+            if client == 0 then
+                error("connection failed");
+            end
+            table.insert(log, "Connected:" .. tostring(client));
+        end
+    )";
+
+    // The TriggerManager logs from its constructor
+    bool initLogger()
+    {
+        if (!obe::Debug::Log)
+            obe::Debug::Log = std::make_shared<spdlog::logger>("Log");
+        return true;
+    }
+
+    struct TriggerFixture
+    {
+        bool logger = initLogger();
+        sol::state lua;
+        TriggerManager triggers { lua };
+        TriggerGroupPtr network;
+        sol::environment environment;
+        bool active = true;
+
+        TriggerFixture()
+        {
+            lua.open_libraries(sol::lib::base, sol::lib::table);
+            lua["__TRIGGERS"].get_or_create<sol::table>();
+            triggers.createNamespace("Event");
+            network = triggers.createTriggerGroup("Event", "Network");
+            network->add("DataReceived").add("Connected");
+            environment = sol::environment(lua, sol::create, lua.globals());
+            lua.safe_script("Event = { Network = {} }", environment);
+            lua.safe_script(ObjectScript, environment);
+            for (const std::string trigger : { "DataReceived", "Connected" })
+            {
+                network->get(trigger).lock()->registerEnvironment(
+                    "object", environment, "Event.Network." + trigger, &active);
+            }
+        }
+
+        std::vector<std::string> getLog()
+        {
+            return environment["log"].get<std::vector<std::string>>();
+        }
+    };
+}
+
+TEST_CASE("Trigger handles stay valid until the Trigger is removed",
+    "[obe.Triggers.TriggerManager]")
+{
+    TriggerFixture fixture;
+    TriggerManager& triggers = fixture.triggers;
+    const TriggerHandle handle
+        = triggers.getTriggerHandle("Event", "Network", "DataReceived");
+    REQUIRE(&triggers.getTrigger(handle)
+        == triggers.getTrigger("Event", "Network", "DataReceived").lock().get());
+    REQUIRE(handle != triggers.getTriggerHandle("Event", "Network", "Connected"));
+
+    fixture.network->remove("DataReceived");
+    REQUIRE_THROWS(triggers.getTrigger(handle));
+    fixture.network->add("DataReceived");
+    const TriggerHandle newHandle
+        = triggers.getTriggerHandle("Event", "Network", "DataReceived");
+    REQUIRE(newHandle != handle);
+    REQUIRE_THROWS(triggers.getTrigger(handle));
+    REQUIRE_NOTHROW(triggers.getTrigger(newHandle));
+
+    // Destroying the TriggerGroup invalidates the handles of its Triggers
+    fixture.network.reset();
+    REQUIRE_THROWS(triggers.getTrigger(newHandle));
+    REQUIRE_THROWS(triggers.getTriggerHandle("Event", "Network", "DataReceived"));
+}
+
+TEST_CASE("Queued Triggers are executed when the queue is dispatched",
+    "[obe.Triggers.TriggerManager]")
+{
+    TriggerFixture fixture;
+    TriggerManager& triggers = fixture.triggers;
+    const TriggerHandle dataReceived
+        = triggers.getTriggerHandle("Event", "Network", "DataReceived");
+    const TriggerHandle connected
+        = triggers.getTriggerHandle("Event", "Network", "Connected");
+    const std::size_t content
+        = triggers.getTrigger(dataReceived).getArgumentId("content");
+    const std::size_t client = triggers.getTrigger(connected).getArgumentId("client");
+
+    const auto pushContent = [dataReceived, content](const std::string& value) {
+        return [dataReceived, content, value](TriggerManager& triggers) {
+            triggers.pushParameter(dataReceived, content, value);
+        };
+    };
+
+    SECTION("Queued executions keep their order and parameters")
+    {
+        triggers.enqueue(dataReceived, pushContent("a"));
+        triggers.enqueue(connected,
+            [connected, client](TriggerManager& triggers) {
+                triggers.pushParameter(connected, client, 1);
+            });
+        triggers.enqueue(dataReceived, pushContent("b"));
+        REQUIRE(fixture.getLog().empty());
+        triggers.dispatchQueue();
+        REQUIRE(fixture.getLog()
+            == std::vector<std::string> {
+                "DataReceived:a", "Connected:1", "DataReceived:b" });
+        triggers.dispatchQueue();
+        REQUIRE(fixture.getLog().size() == 3);
+    }
+    SECTION("Coalesced Triggers are executed once at their last position")
+    {
+        triggers.getTrigger(dataReceived).setCoalesced(true);
+        triggers.enqueue(dataReceived, pushContent("a"));
+        triggers.enqueue(connected);
+        triggers.enqueue(dataReceived, pushContent("b"));
+        triggers.dispatchQueue();
+        REQUIRE(fixture.getLog()
+            == std::vector<std::string> { "Connected:nil", "DataReceived:b" });
+    }
+    SECTION("A queued TriggerGroup queues its parameters with the execution")
+    {
+        fixture.network->setQueued(true);
+        fixture.network->pushParameter("DataReceived", "content", std::string("a"));
+        fixture.network->trigger("DataReceived");
+        fixture.network->trigger("DataReceived");
+        REQUIRE(fixture.getLog().empty());
+        triggers.dispatchQueue();
+        REQUIRE(fixture.getLog()
+            == std::vector<std::string> { "DataReceived:a", "DataReceived:nil" });
+    }
+    SECTION("A failing execution does not stop the dispatch")
+    {
+        triggers.enqueue(connected,
+            [connected, client](TriggerManager& triggers) {
+                triggers.pushParameter(connected, client, 0);
+            });
+        triggers.enqueue(dataReceived, pushContent("a"));
+        REQUIRE_NOTHROW(triggers.dispatchQueue());
+        REQUIRE(fixture.getLog() == std::vector<std::string> { "DataReceived:a" });
+    }
+    SECTION("A failing execution does not leave its Trigger in use")
+    {
+        triggers.enqueue(connected,
+            [connected, client](TriggerManager& triggers) {
+                triggers.pushParameter(connected, client, 0);
+            });
+        triggers.enqueue(connected);
+        triggers.dispatchQueue();
+        REQUIRE(fixture.getLog() == std::vector<std::string> { "Connected:nil" });
+        // Environments are no longer unregistered as if the Trigger was running
+        triggers.getTrigger(connected).unregisterEnvironment(fixture.environment);
+        triggers.enqueue(connected);
+        triggers.dispatchQueue();
+        REQUIRE(fixture.getLog().size() == 1);
+    }
+    SECTION("Executions of removed Triggers are dropped")
+    {
+        triggers.enqueue(connected);
+        fixture.network->remove("Connected");
+        REQUIRE_NOTHROW(triggers.dispatchQueue());
+        REQUIRE(fixture.getLog().empty());
+    }
+    SECTION("Triggers can be queued from several threads")
+    {
+        constexpr std::size_t ThreadsAmount = 4;
+        constexpr std::size_t ExecutionsAmount = 1000;
+        std::vector<std::thread> threads;
+        for (std::size_t thread = 0; thread < ThreadsAmount; thread++)
+        {
+            threads.emplace_back([&, thread]() {
+                for (std::size_t i = 0; i < ExecutionsAmount; i++)
+                {
+                    triggers.enqueue(dataReceived,
+                        pushContent(std::to_string(thread) + "-" + std::to_string(i)));
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+            thread.join();
+        triggers.dispatchQueue();
+
+        const std::vector<std::string> log = fixture.getLog();
+        REQUIRE(log.size() == ThreadsAmount * ExecutionsAmount);
+        // Executions queued by the same thread keep their order
+        std::vector<std::size_t> nextExecution(ThreadsAmount, 0);
+        for (const std::string& entry : log)
+        {
+            const std::string value = entry.substr(entry.find(':') + 1);
+            const std::size_t thread = std::stoul(value.substr(0, value.find('-')));
+            const std::size_t i = std::stoul(value.substr(value.find('-') + 1));
+            REQUIRE(i == nextExecution[thread]++);
+        }
+    }
+}
+
+TEST_CASE("CallbackSchedulers can be cancelled with their handle",
+    "[obe.Triggers.TriggerManager]")
+{
+    TriggerFixture fixture;
+    TriggerManager& triggers = fixture.triggers;
+    unsigned int executions = 0;
+    const auto count = [&executions]() { executions++; };
+
+    SECTION("A callback without delay is executed on the next update")
+    {
+        const CallbackHandle handle = triggers.schedule().run(count);
+        REQUIRE(triggers.isScheduled(handle));
+        triggers.update();
+        REQUIRE(executions == 1);
+        REQUIRE_FALSE(triggers.isScheduled(handle));
+        REQUIRE_FALSE(triggers.cancel(handle));
+    }
+    SECTION("A repeated callback is executed the given amount of times")
+    {
+        triggers.schedule().every(0).repeat(3).run(count);
+        for (int i = 0; i < 5; i++)
+            triggers.update();
+        REQUIRE(executions == 3);
+        REQUIRE(triggers.getScheduledAmount() == 0);
+    }
+    SECTION("Cancelled callbacks are never executed")
+    {
+        const CallbackHandle delayed = triggers.schedule().after(3600).run(count);
+        const CallbackHandle repeated = triggers.schedule().every(0).run(count);
+        triggers.update();
+        REQUIRE(executions == 1);
+        REQUIRE(triggers.cancel(delayed));
+        REQUIRE(triggers.cancel(repeated));
+        triggers.update();
+        REQUIRE(executions == 1);
+        REQUIRE(triggers.getScheduledAmount() == 0);
+        // Handles of done CallbackSchedulers are never given to another one
+        const CallbackHandle handle = triggers.schedule().after(3600).run(count);
+        REQUIRE(handle != delayed);
+        REQUIRE(handle != repeated);
+        REQUIRE_FALSE(triggers.cancel(repeated));
+        REQUIRE(triggers.isScheduled(handle));
+    }
+    SECTION("A callback can stop its own CallbackScheduler")
+    {
+        CallbackScheduler& scheduler = triggers.schedule();
+        scheduler.every(0).run([&]() {
+            if (++executions == 2)
+                scheduler.stop();
+        });
+        for (int i = 0; i < 4; i++)
+            triggers.update();
+        REQUIRE(executions == 2);
+        REQUIRE(triggers.getScheduledAmount() == 0);
+    }
+}
+
+TEST_CASE("CallbackSchedulers follow the engine clock", "[obe.Triggers.TriggerManager]")
+{
+    TriggerFixture fixture;
+    TriggerManager& triggers = fixture.triggers;
+    unsigned int executions = 0;
+    obe::Time::setFixedStep(0.01);
+    obe::Time::advanceFrame();
+    triggers.schedule().after(0.05).run([&executions]() { executions++; });
+    const auto runFrames = [&triggers](int amount) {
+        for (int i = 0; i < amount; i++)
+        {
+            obe::Time::advanceFrame();
+            triggers.update();
+        }
+    };
+    runFrames(4);
+    REQUIRE(executions == 0);
+    runFrames(2);
+    REQUIRE(executions == 1);
+    obe::Time::setFixedStep(0);
+}